@@ -0,0 +1,233 @@
+#!/bin/bash
+
+################
+usage() {
+    echo "Usage: $0 [-e <executable>] [-s <scale>] [-r <runs>] [-w <workloads>] [-o <results>] [-b <baseline>] [-t <tolerance>]"
+    echo "    -e <executable>   The cppfront executable to measure (default: ../cppfront.exe)"
+    echo "    -s <scale>        Multiplies the size of every generated workload (default: 1)"
+    echo "    -r <runs>         Runs per workload; the fastest run is reported (default: 3)"
+    echo "    -w <workloads>    Runs only the provided, comma-separated workloads"
+    echo "                      If the argument is not used all workloads are run"
+    echo "    -o <results>      Where to write the JSON results (default: results.json)"
+    echo "    -b <baseline>     Compare against an earlier results file and fail if a"
+    echo "                      workload got slower or bigger by more than the tolerance"
+    echo "    -t <tolerance>    Allowed regression in percent (default: 20)"
+    exit 1
+}
+
+################
+# Synthetic workloads
+#
+# Each gen_ function writes a .cpp2 file of roughly the given size to
+# stdout. They exercise shapes of code that have been slow before: many
+# declarations, deep nesting, big metafunction-generated types, mixed
+# Cpp1/Cpp2 sources, and very long lines.
+
+# Many small functions
+gen_functions () {
+    for (( i = 0; i < $1 * 10000; i++ )); do
+        printf 'f%d: (x: int) -> int = {\n    y := x * %d;\n    return y + 1;\n}\n\n' $i $i
+    done
+    printf 'main: () -> int = f0(1);\n'
+}
+
+# Deeply nested parenthesized expressions
+gen_nested_expressions () {
+    depth=$(( $1 * 200 ))
+    open=$(printf '(%.0s' $(seq $depth))
+    close=$(printf ')%.0s' $(seq $depth))
+    for (( i = 0; i < 50; i++ )); do
+        printf 'n%d: (x: int) -> int = %sx + %d%s;\n' $i "$open" $i "$close"
+    done
+    printf 'main: () -> int = n0(1);\n'
+}
+
+# One huge @enum
+gen_enum () {
+    printf 'big: @enum type = {\n'
+    for (( i = 0; i < $1 * 5000; i++ )); do
+        printf '    e%d;\n' $i
+    done
+    printf '}\n\nmain: () -> int = big::e0.get_raw_value();\n'
+}
+
+# One huge @union
+gen_union () {
+    printf 'big: @union type = {\n'
+    for (( i = 0; i < $1 * 300; i++ )); do
+        printf '    a%d: int;\n' $i
+    done
+    printf '}\n\nmain: () -> int = { u: big = (); u.set_a0(1); return u.a0(); }\n'
+}
+
+# Many @regex members
+gen_regex () {
+    printf 'patterns: @regex type = {\n'
+    for (( i = 0; i < $1 * 200; i++ )); do
+        printf '    regex_%d := R"(ab+c%d[0-9]*(x|y)?)";\n' $i $i
+    done
+    printf '}\n\nmain: () -> int = 0;\n'
+}
+
+# Alternating Cpp1 and Cpp2 functions
+gen_mixed () {
+    printf '#include <iostream>\n\n'
+    for (( i = 0; i < $1 * 5000; i++ )); do
+        printf 'int c%d(int x) {\n    return x + %d;\n}\n\n' $i $i
+        printf 'p%d: (x: int) -> int = {\n    return c%d(x) * 2;\n}\n\n' $i $i
+    done
+    printf 'int main() { return p0(1); }\n'
+}
+
+# 80K-character lines, of string literals and of long expressions
+gen_long_lines () {
+    literal=$(printf 'a%.0s' $(seq 80000))
+    terms=$(printf ' + x%.0s' $(seq 1000))
+    for (( i = 0; i < $1 * 20; i++ )); do
+        printf 's%d: () -> std::string_view = "%s";\n' $i "$literal"
+    done
+    for (( i = 0; i < $1 * 5; i++ )); do
+        printf 'l%d: (x: int) -> int = x%s;\n' $i "$terms"
+    done
+    printf 'main: () -> int = l0(1);\n'
+}
+
+all_workloads="functions,nested_expressions,enum,union,regex,mixed,long_lines"
+
+################
+# Print the value of a numeric "key": field on a one-line JSON object
+json_number () {
+    echo "$1" | sed -n "s/.*\"$2\":\([0-9.]*\).*/\1/p"
+}
+
+################
+cppfront_executable=../cppfront.exe
+scale=1
+runs=3
+workloads="$all_workloads"
+results=results.json
+baseline=
+tolerance=20
+while getopts ":e:s:r:w:o:b:t:" opt; do
+    case ${opt} in
+    e ) cppfront_executable="$OPTARG" ;;
+    s ) scale="$OPTARG" ;;
+    r ) runs="$OPTARG" ;;
+    w ) workloads="$OPTARG" ;;
+    o ) results="$OPTARG" ;;
+    b ) baseline="$OPTARG" ;;
+    t ) tolerance="$OPTARG" ;;
+    \? ) usage ;;
+    esac
+done
+
+if [[ ! -x "$cppfront_executable" ]]; then
+    echo "cppfront executable not found: $cppfront_executable"
+    usage
+fi
+cppfront_executable=$(realpath "$cppfront_executable")
+if [[ -n "$baseline" && ! -f "$baseline" ]]; then
+    echo "Baseline results not found: $baseline"
+    usage
+fi
+
+work_dir=$(mktemp -d)
+trap 'rm -rf "$work_dir"' EXIT
+
+echo "Measuring $("$cppfront_executable" -version | sed -n 2p) at scale $scale, best of $runs runs"
+echo
+
+entries=()
+for workload in ${workloads//,/ }; do
+    if [[ ",$all_workloads," != *",$workload,"* ]]; then
+        echo "Unknown workload: $workload (the workloads are $all_workloads)"
+        exit 1
+    fi
+
+    source_file="$work_dir/bench-$workload.cpp2"
+    "gen_$workload" "$scale" > "$source_file"
+    lines=$(wc -l < "$source_file")
+
+    # Time each run, and keep the phase timings of the fastest
+    best_ns=
+    for (( run = 0; run < runs; run++ )); do
+        start_ns=$(date +%s%N)
+        ( cd "$work_dir" && "$cppfront_executable" -quiet -time-trace trace.json "$(basename "$source_file")" ) > /dev/null 2> "$work_dir/errors.txt"
+        status=$?
+        end_ns=$(date +%s%N)
+        if [[ $status -ne 0 ]]; then
+            echo "cppfront failed on workload $workload:"
+            head -20 "$work_dir/errors.txt"
+            exit 1
+        fi
+        if [[ -z "$best_ns" || $(( end_ns - start_ns )) -lt $best_ns ]]; then
+            best_ns=$(( end_ns - start_ns ))
+            phases=$(grep '"phases_us"' "$work_dir/trace.json" \
+                | sed -e 's/^{"file":"[^"]*",//' -e 's/},*$//' -e 's/"process_peak_rss_kb":{/"phase_process_peak_rss_kb":{/')
+        fi
+    done
+
+    # Each run compiles just this workload, so the process's peak when
+    # "compile" ended is this workload's peak; per-phase memory growth is
+    # in the "rss_delta_kb" object
+    peak_rss_kb=$(echo "$phases" | sed -n 's/.*"phase_process_peak_rss_kb":{"compile":\([0-9]*\).*/\1/p')
+    read seconds lines_per_sec < <(awk -v ns="$best_ns" -v lines="$lines" 'BEGIN { s = ns / 1e9; printf "%.4f %.1f\n", s, lines / s }')
+    printf "%-20s %8d lines %10.4f s %10s lines/s %8s KB process peak RSS\n" "$workload" "$lines" "$seconds" "$lines_per_sec" "${peak_rss_kb:-?}"
+
+    entries+=("{\"workload\":\"$workload\",\"lines\":$lines,\"seconds\":$seconds,\"lines_per_sec\":$lines_per_sec,\"peak_rss_kb\":${peak_rss_kb:-null},$phases}")
+done
+
+# One workload per line, so results are easy to diff and to read back
+{
+    echo "{"
+    echo "\"cppfront\": \"$("$cppfront_executable" -version | sed -n 2p)\","
+    echo "\"scale\": $scale,"
+    echo "\"workloads\": ["
+    for (( i = 0; i < ${#entries[@]}; i++ )); do
+        separator=","
+        [[ $i -eq $(( ${#entries[@]} - 1 )) ]] && separator=""
+        echo "${entries[$i]}$separator"
+    done
+    echo "]"
+    echo "}"
+} > "$results"
+echo
+echo "Results written to $results"
+
+################
+# Compare against the baseline
+if [[ -z "$baseline" ]]; then
+    exit 0
+fi
+
+baseline_scale=$(sed -n 's/^"scale": \([0-9]*\),$/\1/p' "$baseline")
+if [[ "$baseline_scale" != "$scale" ]]; then
+    echo "Baseline $baseline was measured at scale $baseline_scale, not $scale - not comparing"
+    exit 1
+fi
+
+echo
+echo "Compared to $baseline (tolerance $tolerance%):"
+failure=0
+for entry in "${entries[@]}"; do
+    workload=$(echo "$entry" | sed -n 's/^{"workload":"\([^"]*\)".*/\1/p')
+    old=$(grep "^{\"workload\":\"$workload\"" "$baseline")
+    if [[ -z "$old" ]]; then
+        printf "%-20s not in baseline\n" "$workload"
+        continue
+    fi
+    verdict=$(awk \
+        -v new_lps="$(json_number "$entry" lines_per_sec)" -v old_lps="$(json_number "$old" lines_per_sec)" \
+        -v new_rss="$(json_number "$entry" peak_rss_kb)"   -v old_rss="$(json_number "$old" peak_rss_kb)" \
+        -v tolerance="$tolerance" '
+        BEGIN {
+            speed = old_lps > 0 ? new_lps / old_lps : 1
+            size  = old_rss > 0 && new_rss > 0 ? new_rss / old_rss : 1
+            result = (speed < 1 - tolerance / 100 || size > 1 + tolerance / 100) ? "REGRESSION" : "ok"
+            printf "%.2fx speed %.2fx peak RSS  %s\n", speed, size, result
+        }')
+    printf "%-20s %s\n" "$workload" "$verdict"
+    [[ "$verdict" == *REGRESSION ]] && failure=1
+done
+
+exit $failure
@@ -318,6 +318,19 @@ for test_file in $tests; do
     # The C++1 generation output has to exist and to be tracked by git
     check_file "$expected_output" "Cpp1 generation output file"
 
+    ########
+    # Parsing and lowering on several threads has to generate the same code
+    jobs_src="$test_name.jobs.cpp"
+    jobs_output="$test_name.jobs.output"
+    ./"$cppfront_cmd" "$test_file" -o "$jobs_src" $opt -jobs 4 > "$jobs_output" 2>&1
+    if ! cmp -s "$expected_output" "$jobs_output" ||
+       ( [[ -f "$expected_src" || -f "$jobs_src" ]] && ! cmp -s "$expected_src" "$jobs_src" ); then
+        echo "            Cpp1 generation with -jobs 4 does not match the serial generation:"
+        echo "                $jobs_src"
+        failure=1
+    fi
+    rm -f "$jobs_src" "$jobs_output"
+
     ########
     # Check the generated code
     if [ -f "$expected_src" ]; then
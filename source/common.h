@@ -47,6 +47,12 @@
 #include <chrono>
 #include <iomanip>
 #include <unordered_map>
+#include <unordered_set>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/resource.h>
+    #include <unistd.h>
+#endif
 
 namespace cpp2 {
 
@@ -866,6 +872,7 @@ public:
     )
         -> void
     {
+        args.clear();
         for (auto i = 1; i < argc; ++i) {
             args.emplace_back( i, argv[i] );
         }
@@ -980,6 +987,10 @@ static cmdline_processor::register_flag cmd_print_colon_errors(
     []{ flag_print_colon_errors = true; }
 );
 
+//  Where compile-time console output (such as from @print) goes for the
+//  current compilation - the driver redirects it when compiling in parallel
+thread_local std::ostream* compile_time_out = &std::cout;
+
 
 //-----------------------------------------------------------------------
 //
@@ -1344,7 +1355,7 @@ public:
     }
 };
 
-static std::unordered_map<std::string_view, timer> timers;  // global named timers
+thread_local std::unordered_map<std::string_view, timer> timers;  // named timers for the current compilation
 
 auto scope_timer(std::string_view name) {
     timers[name].start();
@@ -1360,6 +1371,127 @@ auto scope_timer(std::string_view name) {
 #define CPP2_SCOPE_TIMER(name)
 #endif
 
+
+//-----------------------------------------------------------------------
+//
+//  trace_span: a span of compiler work recorded for -time-trace
+//
+//  Use trace_scope("name") to record a span for the rest of the current
+//  scope, or trace_begin/trace_end for spans that don't match a scope.
+//  Recording is off (and nearly free) unless the driver has pointed
+//  trace_spans at somewhere to record spans for the current compilation.
+//
+//-----------------------------------------------------------------------
+//
+
+//  The process's current resident set size, or -1 if unknown
+//
+auto current_rss_kb()
+    -> long
+{
+#if defined(__linux__)
+    auto resident_pages = 0L;
+    if (auto statm = std::fopen("/proc/self/statm", "r"))
+    {
+        auto read = std::fscanf(statm, "%*d %ld", &resident_pages);
+        std::fclose(statm);
+        if (read == 1) {
+            return resident_pages * (sysconf(_SC_PAGESIZE) / 1024);
+        }
+    }
+#endif
+    return -1;
+}
+
+//  The process's peak resident set size so far, or -1 if unknown
+//
+//  This never goes down and includes everything the process did earlier
+//  (e.g., compiling previous files), so it is not a per-phase number
+//
+auto peak_rss_kb()
+    -> long
+{
+#if defined(__unix__) || defined(__APPLE__)
+    auto usage = rusage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    #if defined(__APPLE__)
+        return usage.ru_maxrss / 1024;  // bytes on macOS
+    #else
+        return usage.ru_maxrss;         // kilobytes elsewhere
+    #endif
+    }
+#endif
+    return -1;
+}
+
+struct trace_span
+{
+    using clock = std::chrono::steady_clock;
+
+    std::string_view                      name;
+    std::string                           detail;           // e.g., the metafunction name
+    int                                   line     = -1;    // the source line, if any
+    clock::time_point                     start    = clock::now();
+    std::optional<clock::duration>        duration = {};    // empty if not yet ended
+    long                                  start_rss_kb        = current_rss_kb();
+    long                                  rss_delta_kb        = 0;  // change in current RSS over the span
+    long                                  process_peak_rss_kb = -1; // process peak RSS so far when it ended
+
+    auto end(clock::time_point end_time = clock::now())
+        -> void
+    {
+        duration = end_time - start;
+        if (
+            auto rss = current_rss_kb();
+            rss >= 0
+            && start_rss_kb >= 0
+            )
+        {
+            rss_delta_kb = rss - start_rss_kb;
+        }
+        process_peak_rss_kb = peak_rss_kb();
+    }
+};
+
+thread_local std::vector<trace_span>* trace_spans = {};  // spans for the current compilation, if tracing
+
+auto trace_begin(
+    std::string_view name,
+    std::string_view detail = {},
+    int              line   = -1
+)
+    -> int
+{
+    if (!trace_spans) {
+        return -1;
+    }
+    trace_spans->push_back({ name, std::string{detail}, line });
+    return unchecked_narrow<int>(std::ssize(*trace_spans) - 1);
+}
+
+auto trace_end(int index)
+    -> void
+{
+    if (
+        trace_spans
+        && index >= 0
+        && index < std::ssize(*trace_spans)
+        )
+    {
+        (*trace_spans)[index].end();
+    }
+}
+
+auto trace_scope(
+    std::string_view name,
+    std::string_view detail = {},
+    int              line   = -1
+)
+{
+    auto index = trace_begin(name, detail, line);
+    return finally( [=]{ trace_end(index); } );
+}
+
 }
 
 #endif
@@ -11,6 +11,17 @@
 //===========================================================================
 
 #include "to_cpp1.h"
+#include <atomic>
+#include <condition_variable>
+#include <sstream>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <csignal>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
 
 static auto flag_debug_output = false;
 static cpp2::cmdline_processor::register_flag cmd_debug(
@@ -28,21 +39,799 @@ static cpp2::cmdline_processor::register_flag cmd_quiet(
     []{ flag_quiet = true; }
 );
 
-auto main(
-    int   argc,
-    char* argv[]
+static auto flag_bodies_on_demand = false;
+static cpp2::cmdline_processor::register_flag cmd_bodies_on_demand(
+    9,
+    "bodies-on-demand",
+    "Parse each function body only when lowering it, to use less memory",
+    []{ flag_bodies_on_demand = true; }
+);
+
+static auto flag_jobs = 1;
+static cpp2::cmdline_processor::register_flag cmd_jobs(
+    9,
+    "jobs N",
+    "Compile up to N files in parallel (0 = one per hardware thread)",
+    nullptr,
+    [](std::string const& n) { flag_jobs = std::atoi(n.c_str()); }
+);
+
+
+//-----------------------------------------------------------------------
+//
+//  Compile cache
+//
+//  With '-cache dir', each successful compilation is recorded in dir,
+//  keyed by a hash of everything that can affect its result: the source
+//  text, the .h2 files it #includes, the options that affect code
+//  generation, the cppfront version and build, and the source and
+//  working directory paths. When the key matches an earlier compilation,
+//  its outputs and console output are replayed without loading, lexing,
+//  parsing, checking, or lowering the source.
+//
+//  Either way, output files whose contents would not change are not
+//  rewritten, so their timestamps don't trigger downstream rebuilds.
+//
+//-----------------------------------------------------------------------
+//
+static auto flag_cache = std::string{};
+static cpp2::cmdline_processor::register_flag cmd_cache(
+    9,
+    "cache dir",
+    "Reuse the results of identical earlier compilations recorded in dir",
+    nullptr,
+    [](std::string const& dir) { flag_cache = dir; }
+);
+
+//  64-bit FNV-1a, which is plenty to tell versions of a file apart
+//
+auto hash_text(std::string_view text, std::uint64_t hash = 14695981039346656037ull)
+    -> std::uint64_t
+{
+    for (unsigned char c : text) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+auto to_hex(std::uint64_t n)
+    -> std::string
+{
+    auto ret = std::string(16, '0');
+    for (auto i = 15; n; --i, n >>= 4) {
+        ret[i] = "0123456789abcdef"[n & 0xf];
+    }
+    return ret;
+}
+
+auto read_file(std::filesystem::path const& path)
+    -> std::optional<std::string>
+{
+    auto file = std::ifstream{path, std::ios::binary};
+    if (!file) {
+        return {};
+    }
+    return std::string{ std::istreambuf_iterator<char>{file}, {} };
+}
+
+
+//-----------------------------------------------------------------------
+//  cache_key: Describe everything the result of compiling filename
+//  depends on, or nothing if the compilation should not be cached
+//
+auto cache_key(std::string const& filename)
+    -> std::optional<std::string>
+{
+    using namespace cpp2;
+
+    if (
+        flag_cache.empty()
+        || filename == "stdin"
+        || flag_cpp1_filename == "stdout"
+        || flag_debug_output
+        || flag_verbose
+        )
+    {
+        return {};
+    }
+
+    auto text = read_file(filename);
+    if (!text) {
+        return {};
+    }
+
+    auto key = std::string{
+        "cppfront "
+        #include "version.info"
+        " build "
+        #include "build.info"
+    };
+    key += "\ncwd " + std::filesystem::current_path().string();
+    key += "\nsource " + filename + " " + to_hex(hash_text(*text));
+
+    //  The .h2 files this source #includes, by path relative to the source
+    auto dir = std::filesystem::path{filename}.parent_path();
+    for (auto line = std::string_view{*text}; !line.empty(); ) {
+        auto eol  = line.find('\n');
+        auto this_line = line.substr(0, eol);
+        line.remove_prefix(eol == line.npos ? line.size() : eol + 1);
+
+        this_line.remove_prefix(std::min(this_line.find_first_not_of(" \t"), this_line.size()));
+        if (
+            this_line.starts_with("#include")
+            && this_line.find(".h2\"") != this_line.npos
+            )
+        {
+            auto open  = this_line.find('"');
+            auto close = this_line.find(".h2\"", open) + 3;
+            auto include = std::string{this_line.substr(open + 1, close - open - 1)};
+            auto contents = read_file(dir / include);
+            key += "\ninclude " + include + " " + (contents ? to_hex(hash_text(*contents)) : "missing");
+        }
+    }
+
+    //  The options that affect code generation
+    key += "\noptions";
+    for (auto [name, value] : std::initializer_list<std::pair<char const*, bool>>{
+        { "emit-cppfront-info",   flag_emit_cppfront_info },
+        { "clean-cpp1",           flag_clean_cpp1         },
+        { "line-paths",           flag_line_paths         },
+        { "source-map",           flag_source_map         },
+        { "import-cpp2-util",     flag_import_cpp2_util   },
+        { "import-std",           flag_import_std         },
+        { "include-std",          flag_include_std        },
+        { "pure-cpp2",            flag_cpp2_only          },
+        { "null-checks",          flag_safe_null_pointers },
+        { "div-zero-checks",      flag_safe_zero_division },
+        { "subscript-checks",     flag_safe_subscripts    },
+        { "comparison-checks",    flag_safe_comparisons   },
+        { "fno-exceptions",       flag_no_exceptions      },
+        { "fno-rtti",             flag_no_rtti            },
+        { "format-colon-errors",  flag_print_colon_errors },
+    })
+    {
+        key += std::string{" "} + name + "=" + (value ? "1" : "0");
+    }
+    key += " output=" + flag_cpp1_filename;
+
+    return key;
+}
+
+
+//-----------------------------------------------------------------------
+//  A recorded compilation
+//
+struct cache_entry
+{
+    bool has_cpp1 = false;
+    bool has_cpp2 = false;
+    std::string compile_time_output;
+    std::vector<std::pair<std::string, std::string>> files;
+};
+
+auto cache_path(std::string const& key)
+    -> std::filesystem::path
+{
+    return std::filesystem::path{flag_cache} / (to_hex(hash_text(key)) + ".cppfront-cache");
+}
+
+//  An entry is stored as the key, then length-prefixed fields
+//
+auto cache_lookup(std::string const& key)
+    -> std::optional<cache_entry>
+{
+    auto file = std::ifstream{cache_path(key), std::ios::binary};
+    auto read_string = [&](std::string& str) -> bool {
+        auto size = std::size_t{};
+        if (!(file >> size) || file.get() != '\n') {
+            return false;
+        }
+        str.resize(size);
+        return bool(file.read(str.data(), cpp2::unchecked_narrow<std::streamsize>(size)));
+    };
+
+    auto stored_key = std::string{};
+    auto ret        = cache_entry{};
+    auto num_files  = std::size_t{};
+    if (
+        !read_string(stored_key)
+        || stored_key != key
+        || !(file >> ret.has_cpp1 >> ret.has_cpp2 >> num_files)
+        || !read_string(ret.compile_time_output)
+        )
+    {
+        return {};
+    }
+    ret.files.resize(num_files);
+    for (auto& [name, contents] : ret.files) {
+        if (!read_string(name) || !read_string(contents)) {
+            return {};
+        }
+    }
+    return ret;
+}
+
+auto cache_store(std::string const& key, cache_entry const& entry)
+    -> void
+{
+    auto ec = std::error_code{};
+    std::filesystem::create_directories(flag_cache, ec);
+
+    //  Write to a unique temporary and rename it into place, so that
+    //  concurrent compilations never see a partial entry
+    auto path = cache_path(key);
+    auto temp = path;
+    temp += "." + to_hex(std::random_device{}()) + ".tmp";
+    {
+        auto file = std::ofstream{temp, std::ios::binary};
+        auto write_string = [&](std::string const& str) {
+            file << str.size() << '\n' << str;
+        };
+        write_string(key);
+        file << entry.has_cpp1 << ' ' << entry.has_cpp2 << ' ' << entry.files.size() << '\n';
+        write_string(entry.compile_time_output);
+        for (auto const& [name, contents] : entry.files) {
+            write_string(name);
+            write_string(contents);
+        }
+        if (!file) {
+            file.close();
+            std::filesystem::remove(temp, ec);
+            return;
+        }
+    }
+    std::filesystem::rename(temp, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp, ec);
+    }
+}
+
+
+//-----------------------------------------------------------------------
+//
+//  Dependency files
+//
+//  '-MD' writes a Makefile-syntax dependency file next to each output,
+//  named by appending '.d' to the output filename; '-MF file' writes it
+//  to 'file' instead. It says that the files the compilation wrote
+//  depend on the source file, which Make and Ninja can use to redo only
+//  the work a change affects.
+//
+//  The .h2 files the source #includes are not prerequisites: compiling
+//  the source doesn't read them, so its outputs don't change when they
+//  do (and aren't rewritten, see write_file_if_changed), and listing
+//  them would leave the outputs looking out of date forever. The Cpp1
+//  compile that #includes the .h generated from each .h2 depends on it
+//  through the Cpp1 compiler's own dependency file.
+//
+//-----------------------------------------------------------------------
+//
+static auto flag_md = false;
+static cpp2::cmdline_processor::register_flag cmd_md(
+    9,
+    "MD",
+    "Write a dependency file for each output file, to output.d",
+    []{ flag_md = true; }
+);
+
+static auto flag_mf = std::string{};
+static cpp2::cmdline_processor::register_flag cmd_mf(
+    9,
+    "MF file",
+    "Write the dependency file to 'file' (implies -MD)",
+    nullptr,
+    [](std::string const& file) { flag_mf = file; flag_md = true; }
+);
+
+//  Escape a filename for a Makefile rule
+//
+auto make_escaped(std::string const& filename)
+    -> std::string
+{
+    auto ret = std::string{};
+    for (auto c : filename) {
+        if (c == ' ' || c == '#') {
+            ret += '\\';
+        }
+        else if (c == '$') {
+            ret += '$';
+        }
+        ret += c;
+    }
+    return ret;
+}
+
+
+//-----------------------------------------------------------------------
+//  write_depfile: Write the dependency file for one compilation
+//
+//  sourcefile      the source file that was compiled
+//  outputs         the files the compilation wrote
+//
+//  Returns:        false if the dependency file could not be written
+//
+auto write_depfile(
+    std::string const&                                      sourcefile,
+    std::vector<std::pair<std::string, std::string>> const& outputs,
+    bool                                                    wrote_extra_build
+)
+    -> bool
+{
+    if (
+        !flag_md
+        || outputs.empty()
+        )
+    {
+        return true;
+    }
+
+    auto rule = std::string{};
+    for (auto const& [name, contents] : outputs) {
+        rule += make_escaped(name) + " ";
+    }
+    if (wrote_extra_build) {
+        rule += "cpp2_post_build.sh ";
+    }
+    rule.back() = ':';
+    rule += " " + make_escaped(sourcefile) + "\n";
+
+    auto depfile = flag_mf.empty() ? outputs.front().first + ".d" : flag_mf;
+    return cpp2::write_file_if_changed(depfile, rule);
+}
+
+
+//-----------------------------------------------------------------------
+//
+//  Time tracing
+//
+//  '-time-trace file' records when each phase of each compilation ran
+//  (see trace_span), and writes it to 'file' in Chrome trace event
+//  format for chrome://tracing or ui.perfetto.dev. The same file also
+//  has a "files" array with each file's total time per phase in
+//  microseconds and, where available, how much the process's current
+//  RSS grew during the phase and the process's peak RSS so far when the
+//  phase ended (a high-water mark for the whole process, not the phase);
+//  a phase's time and RSS growth include those of any phases that ran
+//  inside it (e.g., metafunctions run during parser::parse).
+//
+//-----------------------------------------------------------------------
+//
+static auto flag_time_trace = std::string{};
+static cpp2::cmdline_processor::register_flag cmd_time_trace(
+    9,
+    "time-trace file",
+    "Write per-phase timings to 'file' as Chrome trace JSON",
+    nullptr,
+    [](std::string const& file) { flag_time_trace = file; }
+);
+
+struct file_trace
+{
+    std::string                  filename;
+    int                          thread = 0;
+    std::vector<cpp2::trace_span> spans;
+};
+
+static auto const trace_epoch     = cpp2::trace_span::clock::now();
+static auto       trace_mutex     = std::mutex{};
+static auto       file_traces     = std::vector<file_trace>{};
+static auto       trace_threads   = std::atomic<int>{0};
+
+auto record_file_trace(
+    std::string const&              filename,
+    std::vector<cpp2::trace_span>&& spans
+)
+    -> void
+{
+    thread_local auto const thread = ++trace_threads;
+
+    //  Any span still open (e.g., after an error) ends now
+    for (auto now = cpp2::trace_span::clock::now(); auto& span : spans) {
+        if (!span.duration) {
+            span.end(now);
+        }
+    }
+
+    auto lock = std::lock_guard{trace_mutex};
+    file_traces.push_back({ filename, thread, std::move(spans) });
+}
+
+
+//-----------------------------------------------------------------------
+//  write_time_trace: Write the recorded spans to flag_time_trace
+//
+//  Returns:    false if the file could not be written
+//
+auto write_time_trace()
+    -> bool
+{
+    using std::chrono::duration_cast, std::chrono::microseconds, cpp2::json_quoted;
+    auto us = [](auto d) { return duration_cast<microseconds>(d).count(); };
+
+    auto lock = std::lock_guard{trace_mutex};
+    auto json = std::ofstream{flag_time_trace};
+
+    json << "{\n\"traceEvents\": [";
+    auto first = true;
+    for (auto const& file : file_traces) {
+        for (auto const& span : file.spans) {
+            json << (first ? "\n" : ",\n")
+                << "{\"name\":" << json_quoted(span.name)
+                << ",\"cat\":\"cppfront\",\"ph\":\"X\""
+                << ",\"ts\":" << us(span.start - trace_epoch)
+                << ",\"dur\":" << us(*span.duration)
+                << ",\"pid\":1,\"tid\":" << file.thread
+                << ",\"args\":{\"file\":" << json_quoted(file.filename);
+            if (!span.detail.empty()) {
+                json << ",\"detail\":" << json_quoted(span.detail);
+            }
+            if (span.line >= 0) {
+                json << ",\"line\":" << span.line;
+            }
+            if (span.start_rss_kb >= 0) {
+                json << ",\"rss_delta_kb\":" << span.rss_delta_kb;
+            }
+            if (span.process_peak_rss_kb >= 0) {
+                json << ",\"process_peak_rss_kb\":" << span.process_peak_rss_kb;
+            }
+            json << "}}";
+            first = false;
+        }
+    }
+    json << "\n],\n\"displayTimeUnit\": \"ms\",\n\"files\": [";
+
+    //  Per-file totals, with each phase in the order it first ran, and
+    //  phases with details (e.g., each metafunction) counted separately
+    first = true;
+    for (auto const& file : file_traces) {
+        struct phase {
+            std::string name;
+            long long   total_us            = 0;
+            long        rss_delta_kb        = 0;
+            bool        has_rss_delta       = false;
+            long        process_peak_rss_kb = -1;
+        };
+        auto phases = std::vector<phase>{};
+        for (auto const& span : file.spans) {
+            auto name = std::string{span.name};
+            if (!span.detail.empty()) {
+                name += " " + span.detail;
+            }
+            auto it = std::find_if(phases.begin(), phases.end(), [&](auto const& p) { return p.name == name; });
+            if (it == phases.end()) {
+                it = phases.insert(phases.end(), { name });
+            }
+            it->total_us            += us(*span.duration);
+            it->rss_delta_kb        += span.rss_delta_kb;
+            it->has_rss_delta       |= span.start_rss_kb >= 0;
+            it->process_peak_rss_kb  = std::max(it->process_peak_rss_kb, span.process_peak_rss_kb);
+        }
+
+        json << (first ? "\n" : ",\n")
+            << "{\"file\":" << json_quoted(file.filename) << ",\"phases_us\":{";
+        for (auto sep = ""; auto const& p : phases) {
+            json << sep << json_quoted(p.name) << ":" << p.total_us;
+            sep = ",";
+        }
+        json << "},\"rss_delta_kb\":{";
+        for (auto sep = ""; auto const& p : phases) {
+            if (p.has_rss_delta) {
+                json << sep << json_quoted(p.name) << ":" << p.rss_delta_kb;
+                sep = ",";
+            }
+        }
+        json << "},\"process_peak_rss_kb\":{";
+        for (auto sep = ""; auto const& p : phases) {
+            if (p.process_peak_rss_kb >= 0) {
+                json << sep << json_quoted(p.name) << ":" << p.process_peak_rss_kb;
+                sep = ",";
+            }
+        }
+        json << "}}";
+        first = false;
+    }
+    json << "\n]\n}\n";
+
+    json.close();
+    return !json.fail();
+}
+
+
+//-----------------------------------------------------------------------
+//  compile_file: Load, lex, parse, check, and lower one source file
+//
+//  filename    the source file to compile
+//  out         where to write progress and statistics (normally std::cout)
+//  err         where to write diagnostics (normally std::cerr)
+//  jobs        the number of threads that may parse its Cpp2 sections,
+//              and lower its declarations
+//
+//  Returns:    EXIT_SUCCESS or EXIT_FAILURE
+//
+auto compile_file(
+    std::string const& filename,
+    std::ostream&      out,
+    std::ostream&      err,
+    int                jobs = 1
 )
     -> int
 {
     using namespace cpp2;
 
-    cmdline.set_args(argc, argv);
-    cmdline.process_flags();
+    cpp2::timer t;
+    t.start();
 
-    if (cmdline.help_was_requested()) {
+    //  With -time-trace, record spans for this compilation (the first
+    //  span, covering all of it, is "compile")
+    auto spans = std::vector<trace_span>{};
+    if (!flag_time_trace.empty()) {
+        trace_spans = &spans;
+        trace_begin("compile");
+    }
+    auto record_trace = finally([&]{
+        if (trace_spans) {
+            trace_spans = {};
+            record_file_trace(filename, std::move(spans));
+        }
+    });
+
+    auto& progress = flag_cpp1_filename != "stdout" ? out : err;
+
+    if (
+        !flag_quiet
+        && filename != "stdin"
+        && flag_cpp1_filename != "stdout"
+        )
+    {
+        progress << filename << "...";
+    }
+
+    auto key    = cache_key(filename);
+    auto cached = key ? cache_lookup(*key) : std::nullopt;
+
+    //  If this exact compilation was done before, just replay it
+    if (cached)
+    {
+        for (auto const& [name, contents] : cached->files) {
+            if (!write_file_if_changed(name, contents)) {
+                cached.reset();
+                break;
+            }
+        }
+    }
+    if (cached)
+    {
+        out << cached->compile_time_output;
+        if (!write_depfile(filename, cached->files, false)) {
+            err << "\ncppfront: error: could not write dependency file for " << filename << "\n\n";
+            return EXIT_FAILURE;
+        }
+        if (!flag_quiet) {
+            if (!cached->has_cpp1) {
+                progress << " ok (all Cpp2, passes safety checks)\n";
+            }
+            else if (cached->has_cpp2) {
+                progress << " ok (mixed Cpp1/Cpp2, Cpp2 code passes safety checks)\n";
+            }
+            else {
+                progress << " ok (all Cpp1)\n";
+            }
+            progress << "\n";
+        }
         return EXIT_SUCCESS;
     }
 
+    //  Capture compile-time output (e.g., from @print) so it can be cached
+    auto compile_time_output = std::ostringstream{};
+    compile_time_out = &compile_time_output;
+
+    //  Load + lex + parse + sema (-debug's dumps need a serial parse,
+    //  since they include the tokens generated while parsing, and need
+    //  all the function bodies)
+    auto const bodies_on_demand = flag_bodies_on_demand && !flag_debug_output;
+    auto compilation = std::make_unique<cppfront>(filename, flag_debug_output ? 1 : jobs, bodies_on_demand);
+
+    //  Generate Cpp1 (this may catch additional late errors)
+    auto count = compilation->lower_to_cpp1();
+
+    //  With bodies parsed on demand, errors in them are found later than
+    //  others, and the parser reports some errors only if there are no
+    //  errors yet, so compile again normally to report the same errors
+    if (
+        bodies_on_demand
+        && !compilation->had_no_errors()
+        )
+    {
+        compilation->discard_output();
+        compilation.reset();
+        compile_time_output.str({});
+        compilation = std::make_unique<cppfront>(filename, flag_debug_output ? 1 : jobs);
+        count = compilation->lower_to_cpp1();
+    }
+    auto& c = *compilation;
+
+    compile_time_out = &out;
+    out << compile_time_output.view();
+
+    auto exit_status = EXIT_SUCCESS;
+
+    //  If there were no errors, say so and generate Cpp1
+    if (c.had_no_errors())
+    {
+        if (
+            key
+            && !c.has_extra_build()
+            )
+        {
+            cache_store(*key, { c.has_cpp1(), c.has_cpp2(), std::move(compile_time_output).str(), c.get_written_files() });
+        }
+
+        if (!write_depfile(filename, c.get_written_files(), c.has_extra_build())) {
+            err << "\ncppfront: error: could not write dependency file for " << filename << "\n\n";
+            return EXIT_FAILURE;
+        }
+
+        if (
+            !flag_quiet
+            && flag_cpp1_filename != "stdout"
+            )
+        {
+            if (!c.has_cpp1()) {
+                progress << " ok (all Cpp2, passes safety checks)\n";
+            }
+            else if (c.has_cpp2()) {
+                progress << " ok (mixed Cpp1/Cpp2, Cpp2 code passes safety checks)\n";
+            }
+            else {
+                progress << " ok (all Cpp1)\n";
+            }
+
+            if (flag_verbose) {
+                auto total = count.cpp1_lines + count.cpp2_lines;
+                auto total_lines = print_with_thousands(total);
+                progress << "   Cpp1  "
+                    << std::right << std::setw(unchecked_narrow<int>(total_lines.size()))
+                    << print_with_thousands(count.cpp1_lines) << " line" << (count.cpp1_lines != 1 ? "s" : "");
+                progress << "\n   Cpp2  "
+                    << std::right << std::setw(unchecked_narrow<int>(total_lines.size()))
+                    << print_with_thousands(count.cpp2_lines) << " line" << (count.cpp2_lines != 1 ? "s" : "");
+                if (total > 0) {
+                    progress << " (";
+                    if (count.cpp1_lines == 0) {
+                        progress << 100;
+                    }
+                    else if (count.cpp2_lines / count.cpp1_lines > 25) {
+                        progress << std::setprecision(3)
+                            << 100.0 * count.cpp2_lines / total;
+                    }
+                    else {
+                        progress << 100 * count.cpp2_lines / total;
+                    }
+                    progress << "%)";
+                }
+
+                t.stop();
+                auto total_time = print_with_thousands(t.elapsed().count());
+                out << "\n   Time  " << total_time << " ms";
+
+                std::multimap< long long, std::string_view, std::greater<> > sorted_timers;
+                for (auto [name, t] : timers) {
+                    sorted_timers.insert({t.elapsed().count(), name});
+                }
+
+                for (auto [elapsed, name] : sorted_timers) {
+                    out
+                        << "\n         "
+                        << std::right << std::setw(unchecked_narrow<int>(total_time.size()))
+                        << print_with_thousands(elapsed) << " ms" << " in " << name;
+                }
+            }
+
+            progress << "\n";
+        }
+    }
+    //  Otherwise, print the errors
+    else
+    {
+        err << "\n";
+        c.print_errors(err);
+        err << "\n";
+        exit_status = EXIT_FAILURE;
+    }
+
+    //  And, if requested, the debug information
+    if (flag_debug_output) {
+        c.debug_print();
+    }
+
+    return exit_status;
+}
+
+
+//-----------------------------------------------------------------------
+//  compile_files_in_parallel: Compile the files on a pool of worker
+//  threads, printing each file's output in the original order
+//
+//  filenames   the source files to compile
+//  jobs        the number of worker threads to use
+//
+//  Returns:    EXIT_SUCCESS, or EXIT_FAILURE if any file failed
+//
+auto compile_files_in_parallel(
+    std::vector<std::string> const& filenames,
+    int                             jobs
+)
+    -> int
+{
+    //  Each file's output is buffered until all earlier files' output
+    //  has been printed, so diagnostics stay together and in order
+    struct result {
+        std::ostringstream out;
+        std::ostringstream err;
+        int                exit_status = EXIT_SUCCESS;
+        bool               done        = false;
+    };
+    auto results = std::vector<result>(filenames.size());
+
+    auto next_file = std::atomic<std::ptrdiff_t>{0};
+    auto mutex     = std::mutex{};
+    auto file_done = std::condition_variable{};
+
+    auto worker = [&]
+    {
+        for (
+            auto i = next_file++;
+            i < std::ssize(filenames);
+            i = next_file++
+            )
+        {
+            auto status = compile_file(filenames[i], results[i].out, results[i].err);
+
+            auto lock = std::lock_guard{mutex};
+            results[i].exit_status = status;
+            results[i].done        = true;
+            file_done.notify_all();
+        }
+    };
+
+    auto pool = std::vector<std::thread>{};
+    for (auto i = 0; i < std::min<std::ptrdiff_t>(jobs, std::ssize(filenames)); ++i) {
+        pool.emplace_back(worker);
+    }
+
+    auto exit_status = EXIT_SUCCESS;
+    for (auto& r : results)
+    {
+        {
+            auto lock = std::unique_lock{mutex};
+            file_done.wait(lock, [&]{ return r.done; });
+        }
+        std::cout << r.out.str() << std::flush;
+        std::cerr << r.err.str() << std::flush;
+        if (r.exit_status != EXIT_SUCCESS) {
+            exit_status = EXIT_FAILURE;
+        }
+    }
+
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    return exit_status;
+}
+
+
+//-----------------------------------------------------------------------
+//  compile_arguments: Compile the source files named on the command line
+//
+//  Returns:    EXIT_SUCCESS, or EXIT_FAILURE if any file failed
+//
+auto compile_arguments()
+    -> int
+{
+    using namespace cpp2;
+
     if (cmdline.arguments().empty()) {
         std::cerr << "cppfront: error: no input files (try -help)\n";
         return EXIT_FAILURE;
@@ -52,8 +841,8 @@ auto main(
         std::filesystem::current_path(flag_cwd);
     }
 
-    //  For each Cpp2 source file
-    int exit_status = EXIT_SUCCESS;
+    //  Everything left on the command line should be a Cpp2 source file
+    auto filenames = std::vector<std::string>{};
     for (auto const& arg : cmdline.arguments())
     {
         if (
@@ -73,108 +862,558 @@ auto main(
             }
             return EXIT_FAILURE;
         }
+        filenames.push_back(arg.text);
+    }
+
+    if (
+        !flag_mf.empty()
+        && std::ssize(filenames) > 1
+        )
+    {
+        std::cerr << "cppfront: error: -MF can be used with only one input file (use -MD instead)\n";
+        return EXIT_FAILURE;
+    }
 
-        cpp2::timer t;
-        t.start();
+    //  A source map is written next to its Cpp1 file, so there must be one
+    if (
+        flag_source_map
+        && (
+            flag_cpp1_filename == "stdout"
+            || (
+                flag_cpp1_filename.empty()
+                && std::find(filenames.begin(), filenames.end(), "stdin") != filenames.end()
+                )
+            )
+        )
+    {
+        std::cerr << "cppfront: error: -source-map can't be used when the output is stdout (use -output to name an output file)\n";
+        return EXIT_FAILURE;
+    }
 
-        auto& out = flag_cpp1_filename != "stdout" ? std::cout : std::cerr;
+    auto exit_status = EXIT_SUCCESS;
 
-        if (
-            !flag_quiet
-            && arg.text != "stdin"
-            && flag_cpp1_filename != "stdout"
-            ) 
+    //  Compile in parallel only when the files don't share stdin/stdout
+    auto jobs = flag_jobs > 0 ? flag_jobs : std::max(1, unchecked_narrow<int>(std::thread::hardware_concurrency()));
+    if (
+        jobs > 1
+        && std::ssize(filenames) > 1
+        && flag_cpp1_filename != "stdout"
+        && std::find(filenames.begin(), filenames.end(), "stdin") == filenames.end()
+        )
+    {
+        exit_status = compile_files_in_parallel(filenames, jobs);
+    }
+
+    //  Otherwise, for each Cpp2 source file (using the jobs to parse
+    //  its Cpp2 sections and lower its declarations in parallel instead)
+    else
+    {
+        for (auto const& filename : filenames)
         {
-            out << arg.text << "...";
+            if (compile_file(filename, std::cout, std::cerr, jobs) != EXIT_SUCCESS) {
+                exit_status = EXIT_FAILURE;
+            }
         }
+    }
+
+    if (
+        !flag_time_trace.empty()
+        && !write_time_trace()
+        )
+    {
+        std::cerr << "cppfront: error: could not write time trace file " << flag_time_trace << "\n";
+        exit_status = EXIT_FAILURE;
+    }
+
+    //if (flag_internal_debug) {
+    //    stackinstr::print_deepest();
+    //    stackinstr::print_largest();
+    //}
+
+    return exit_status;
+}
+
 
-        //  Load + lex + parse + sema
-        cppfront c(arg.text);
+//-----------------------------------------------------------------------
+//
+//  Mapping diagnostics back to Cpp2
+//
+//  'cppfront -map-diagnostics' copies a Cpp1 compiler's diagnostics from
+//  stdin to stdout, rewriting each 'file:line:col' or 'file(line,col)'
+//  position whose file has a -source-map map next to it to the Cpp2
+//  position the text came from. For example:
+//
+//      cppfront -source-map hello.cpp2
+//      g++ -std=c++20 -c hello.cpp 2>&1 | cppfront -map-diagnostics
+//
+//-----------------------------------------------------------------------
+//
+static auto flag_map_diagnostics = false;
+static cpp2::cmdline_processor::register_flag cmd_map_diagnostics(
+    9,
+    "map-diagnostics",
+    "Map Cpp1 positions in diagnostics on stdin back to Cpp2 via -source-map maps",
+    []{ flag_map_diagnostics = true; }
+);
+
+//-----------------------------------------------------------------------
+//  map_diagnostics: Copy in to out, mapping positions through source maps
+//
+auto map_diagnostics(
+    std::istream& in,
+    std::ostream& out
+)
+    -> int
+{
+    using namespace cpp2;
 
-        //  Generate Cpp1 (this may catch additional late errors)
-        auto count = c.lower_to_cpp1();
+    //  Each file's map, loaded the first time the file is mentioned
+    auto maps = std::unordered_map<std::string, std::optional<source_map>>{};
+    auto map_for = [&](std::string const& file)
+        -> source_map const*
+    {
+        auto [entry, inserted] = maps.try_emplace(file);
+        if (inserted) {
+            if (auto text = read_file(file + ".map")) {
+                entry->second = source_map::from_json(*text);
+            }
+        }
+        return entry->second ? &*entry->second : nullptr;
+    };
 
-        //  If there were no errors, say so and generate Cpp1
-        if (c.had_no_errors())
+    auto line = std::string{};
+    while (std::getline(in, line))
+    {
+        auto mapped     = std::string{};
+        auto copied     = std::size_t{0};   // how much of line is in mapped
+        auto word_start = std::size_t{0};   // where a filename could start
+
+        for (auto i = std::size_t{0}; i < line.size(); ++i)
         {
             if (
-                !flag_quiet
-                && flag_cpp1_filename != "stdout"
+                std::isspace(static_cast<unsigned char>(line[i]))
+                || line[i] == '\''
+                || line[i] == '"'
                 )
             {
-                if (!c.has_cpp1()) {
-                    out << " ok (all Cpp2, passes safety checks)\n";
-                }
-                else if (c.has_cpp2()) {
-                    out << " ok (mixed Cpp1/Cpp2, Cpp2 code passes safety checks)\n";
-                }
-                else {
-                    out << " ok (all Cpp1)\n";
+                word_start = i+1;
+                continue;
+            }
+
+            //  Look for a filename followed by :line[:col] or (line[,col])
+            if (
+                (line[i] != ':' && line[i] != '(')
+                || i == word_start
+                || i+1 >= line.size()
+                || !is_digit(line[i+1])
+                )
+            {
+                continue;
+            }
+            auto map = map_for(line.substr(word_start, i - word_start));
+            if (!map) {
+                continue;
+            }
+
+            //  A line or column too big to be a position stays unmapped
+            auto end     = i+1;
+            auto lineno  = source_map::read_number(line, end);
+            auto colno   = std::optional<colno_t>{1};
+            auto has_col = false;
+            if (
+                end+1 < line.size()
+                && line[end] == (line[i] == ':' ? ':' : ',')
+                && is_digit(line[end+1])
+                )
+            {
+                ++end;
+                colno   = source_map::read_number(line, end);
+                has_col = true;
+            }
+
+            if (
+                auto source_pos = lineno && colno
+                    ? map->lookup({ *lineno, *colno })
+                    : std::nullopt
+                )
+            {
+                mapped += line.substr(copied, word_start - copied);
+                mapped += map->source;
+                mapped += line[i] + std::to_string(source_pos->lineno);
+                if (has_col) {
+                    mapped += (line[i] == ':' ? ':' : ',') + std::to_string(source_pos->colno);
                 }
+                copied = end;
+            }
+            i = end-1;
+        }
 
-                if (flag_verbose) {
-                    auto total = count.cpp1_lines + count.cpp2_lines;
-                    auto total_lines = print_with_thousands(total);
-                    out << "   Cpp1  "
-                        << std::right << std::setw(unchecked_narrow<int>(total_lines.size()))
-                        << print_with_thousands(count.cpp1_lines) << " line" << (count.cpp1_lines != 1 ? "s" : "");
-                    out << "\n   Cpp2  "
-                        << std::right << std::setw(unchecked_narrow<int>(total_lines.size()))
-                        << print_with_thousands(count.cpp2_lines) << " line" << (count.cpp2_lines != 1 ? "s" : "");
-                    if (total > 0) {
-                        out << " (";
-                        if (count.cpp1_lines == 0) {
-                            out << 100;
-                        }
-                        else if (count.cpp2_lines / count.cpp1_lines > 25) {
-                            out << std::setprecision(3)
-                                << 100.0 * count.cpp2_lines / total;
-                        }
-                        else {
-                            out << 100 * count.cpp2_lines / total;
-                        }
-                        out << "%)";
-                    }
+        out << mapped << std::string_view{line}.substr(copied) << '\n';
+    }
 
-                    t.stop();
-                    auto total_time = print_with_thousands(t.elapsed().count());
-                    std::cout << "\n   Time  " << total_time << " ms";
+    return EXIT_SUCCESS;
+}
 
-                    std::multimap< long long, std::string_view, std::greater<> > sorted_timers;
-                    for (auto [name, t] : timers) {
-                        sorted_timers.insert({t.elapsed().count(), name});
-                    }
 
-                    for (auto [elapsed, name] : sorted_timers) {
-                        std::cout
-                            << "\n         "
-                            << std::right << std::setw(unchecked_narrow<int>(total_time.size()))
-                            << print_with_thousands(elapsed) << " ms" << " in " << name;
-                    }
-                }
+//-----------------------------------------------------------------------
+//
+//  Compile server
+//
+//  'cppfront -server socket' stays resident and listens on a local
+//  Unix socket. 'cppfront -connect socket <normal arguments>' forwards
+//  its command line, current directory, and stdin/stdout/stderr to the
+//  server, and exits with the compilation's exit status. If no server is
+//  listening, -connect just compiles in-process, so a build can switch
+//  to -connect unconditionally.
+//
+//  The server forks a child per request. The child starts from the
+//  server's already-initialized state (with any flags given to -server
+//  as defaults), applies the request's flags, compiles, and reports the
+//  exit status back; so no state leaks from one request to the next.
+//
+//  Protocol, over one connection per request:
+//    client -> server   u32 payload length, carrying the client's
+//                       stdin/stdout/stderr fds as SCM_RIGHTS
+//    client -> server   payload: cwd '\0' arg1 '\0' ... argN '\0'
+//    server -> client   i32 exit status
+//
+//-----------------------------------------------------------------------
+//
+static auto flag_server = std::string{};
+static cpp2::cmdline_processor::register_flag cmd_server(
+    9,
+    "server socket",
+    "Stay resident and serve compile requests on a local socket",
+    nullptr,
+    [](std::string const& path) { flag_server = path; }
+);
 
-                out << "\n";
+static auto flag_connect = std::string{};
+static cpp2::cmdline_processor::register_flag cmd_connect(
+    9,
+    "connect socket",
+    "Forward this compilation to a -server on socket, if one is running",
+    nullptr,
+    [](std::string const& path) { flag_connect = path; }
+);
+
+#if defined(__unix__) || defined(__APPLE__)
+
+//  Helpers to send and receive a complete buffer
+//
+auto write_all(int fd, void const* data, std::size_t size)
+    -> bool
+{
+    auto p = static_cast<char const*>(data);
+    while (size > 0) {
+        auto n = ::write(fd, p, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p    += n;
+        size -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+auto read_all(int fd, void* data, std::size_t size)
+    -> bool
+{
+    auto p = static_cast<char*>(data);
+    while (size > 0) {
+        auto n = ::read(fd, p, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p    += n;
+        size -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+auto make_socket_address(std::string const& path, sockaddr_un& addr)
+    -> bool
+{
+    addr = {};
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) {
+        std::cerr << "cppfront: error: socket path is too long: " << path << "\n";
+        return false;
+    }
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+
+
+//-----------------------------------------------------------------------
+//  serve_request: Handle one connection, in a forked child
+//
+auto serve_request(int conn)
+    -> void
+{
+    using namespace cpp2;
+
+    //  Receive the payload length and the client's standard streams
+    constexpr auto num_fds = 3;
+    auto payload_size      = std::uint32_t{};
+    auto iov               = iovec{ &payload_size, sizeof(payload_size) };
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * num_fds)] = {};
+
+    auto msg           = msghdr{};
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = control;
+    msg.msg_controllen = sizeof(control);
+
+    if (::recvmsg(conn, &msg, MSG_WAITALL) != sizeof(payload_size)) {
+        return;
+    }
+    auto cmsg = CMSG_FIRSTHDR(&msg);
+    if (
+        !cmsg
+        || cmsg->cmsg_level != SOL_SOCKET
+        || cmsg->cmsg_type  != SCM_RIGHTS
+        || cmsg->cmsg_len   != CMSG_LEN(sizeof(int) * num_fds)
+        )
+    {
+        return;
+    }
+    int fds[num_fds];
+    std::memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+    for (auto i = 0; i < num_fds; ++i) {
+        ::dup2(fds[i], i);
+        ::close(fds[i]);
+    }
+
+    auto payload = std::string(payload_size, '\0');
+    if (!read_all(conn, payload.data(), payload.size())) {
+        return;
+    }
+
+    //  Unpack the working directory and arguments
+    auto strings = std::vector<std::string>{};
+    for (auto pos = std::size_t{0}; pos < payload.size(); ) {
+        auto end = payload.find('\0', pos);
+        if (end == payload.npos) {
+            end = payload.size();
+        }
+        strings.push_back(payload.substr(pos, end - pos));
+        pos = end + 1;
+    }
+
+    auto exit_status = std::int32_t{EXIT_FAILURE};
+    if (
+        !strings.empty()
+        && ::chdir(strings.front().c_str()) == 0
+        )
+    {
+        auto argv = std::vector<char*>{};
+        for (auto& s : strings) {
+            argv.push_back(s.data());   // strings[0] stands in for argv[0]
+        }
+        argv.push_back(nullptr);
+
+        cmdline.set_args(unchecked_narrow<int>(std::ssize(argv) - 1), argv.data());
+        cmdline.process_flags();
+
+        exit_status = cmdline.help_was_requested() ? EXIT_SUCCESS : compile_arguments();
+    }
+    else {
+        std::cerr << "cppfront: error: server could not change to the client's directory\n";
+    }
+
+    std::cout.flush();
+    std::cerr.flush();
+    write_all(conn, &exit_status, sizeof(exit_status));
+}
+
+
+//-----------------------------------------------------------------------
+//  serve: Listen on the socket and handle compile requests until killed
+//
+auto serve(std::string const& path)
+    -> int
+{
+    auto addr = sockaddr_un{};
+    if (!make_socket_address(path, addr)) {
+        return EXIT_FAILURE;
+    }
+
+    auto listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    ::unlink(path.c_str());
+    if (
+        listener < 0
+        || ::bind(listener, reinterpret_cast<sockaddr const*>(&addr), sizeof(addr)) != 0
+        || ::listen(listener, SOMAXCONN) != 0
+        )
+    {
+        std::cerr << "cppfront: error: could not listen on socket " << path << ": " << std::strerror(errno) << "\n";
+        return EXIT_FAILURE;
+    }
+
+    //  Children report their results over the socket, so don't keep zombies
+    ::signal(SIGCHLD, SIG_IGN);
+
+    if (!flag_quiet) {
+        std::cout << "cppfront: serving compile requests on " << path << "\n";
+    }
+    std::cout.flush();
+    std::cerr.flush();
+
+    while (true)
+    {
+        auto conn = ::accept(listener, nullptr, nullptr);
+        if (conn < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
             }
+            std::cerr << "cppfront: error: accept failed: " << std::strerror(errno) << "\n";
+            return EXIT_FAILURE;
         }
-        //  Otherwise, print the errors
-        else
-        {
-            std::cerr << "\n";
-            c.print_errors();
-            std::cerr << "\n";
-            exit_status = EXIT_FAILURE;
+
+        auto pid = ::fork();
+        if (pid == 0) {
+            ::close(listener);
+            serve_request(conn);
+            ::_exit(0);
+        }
+        if (pid < 0) {
+            std::cerr << "cppfront: error: fork failed: " << std::strerror(errno) << "\n";
         }
+        ::close(conn);
+    }
+}
+
 
-        //  And, if requested, the debug information
-        if (flag_debug_output) {
-            c.debug_print();
+//-----------------------------------------------------------------------
+//  forward_to_server: Send this command line to a running server
+//
+//  Returns:    the compilation's exit status, or nothing if there is
+//              no server to talk to
+//
+auto forward_to_server(
+    std::string const& path,
+    int                argc,
+    char*              argv[]
+)
+    -> std::optional<int>
+{
+    auto addr = sockaddr_un{};
+    if (!make_socket_address(path, addr)) {
+        return {};
+    }
+
+    auto conn = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (
+        conn < 0
+        || ::connect(conn, reinterpret_cast<sockaddr const*>(&addr), sizeof(addr)) != 0
+        )
+    {
+        if (conn >= 0) {
+            ::close(conn);
         }
+        return {};
     }
+    auto close_conn = cpp2::finally([=]{ ::close(conn); });
 
-    //if (flag_internal_debug) {
-    //    stackinstr::print_deepest();
-    //    stackinstr::print_largest();
-    //}
+    auto payload = std::filesystem::current_path().string();
+    payload += '\0';
+    for (auto i = 1; i < argc; ++i) {
+        payload += argv[i];
+        payload += '\0';
+    }
+
+    //  Send the payload length along with our standard streams
+    auto payload_size = cpp2::unchecked_narrow<std::uint32_t>(payload.size());
+    auto iov          = iovec{ &payload_size, sizeof(payload_size) };
+    int  fds[]        = { 0, 1, 2 };
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(fds))] = {};
+
+    auto msg           = msghdr{};
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = control;
+    msg.msg_controllen = sizeof(control);
 
+    auto cmsg        = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type  = SCM_RIGHTS;
+    cmsg->cmsg_len   = CMSG_LEN(sizeof(fds));
+    std::memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    auto exit_status = std::int32_t{};
+    if (
+        ::sendmsg(conn, &msg, 0) != sizeof(payload_size)
+        || !write_all(conn, payload.data(), payload.size())
+        || !read_all(conn, &exit_status, sizeof(exit_status))
+        )
+    {
+        std::cerr << "cppfront: error: lost connection to compile server on " << path << "\n";
+        return EXIT_FAILURE;
+    }
     return exit_status;
 }
+
+#else
+
+auto serve(std::string const&)
+    -> int
+{
+    std::cerr << "cppfront: error: -server is not supported on this platform\n";
+    return EXIT_FAILURE;
+}
+
+auto forward_to_server(std::string const&, int, char*[])
+    -> std::optional<int>
+{
+    return {};
+}
+
+#endif
+
+
+auto main(
+    int   argc,
+    char* argv[]
+)
+    -> int
+{
+    using namespace cpp2;
+
+    cmdline.set_args(argc, argv);
+    cmdline.process_flags();
+
+    if (cmdline.help_was_requested()) {
+        return EXIT_SUCCESS;
+    }
+
+    if (flag_map_diagnostics) {
+        if (!cmdline.arguments().empty()) {
+            std::cerr << "cppfront: error: -map-diagnostics does not take input files\n";
+            return EXIT_FAILURE;
+        }
+        return map_diagnostics(std::cin, std::cout);
+    }
+
+    if (!flag_server.empty()) {
+        if (!cmdline.arguments().empty()) {
+            std::cerr << "cppfront: error: -server does not take input files\n";
+            return EXIT_FAILURE;
+        }
+        return serve(flag_server);
+    }
+
+    if (!flag_connect.empty()) {
+        if (auto exit_status = forward_to_server(flag_connect, argc, argv)) {
+            return *exit_status;
+        }
+    }
+
+    return compile_arguments();
+}
@@ -18,6 +18,12 @@
 #include <cctype>
 #include <cstddef>
 #include <span>
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define CPP2_USE_SSE2
+    #include <emmintrin.h>
+#endif
 
 
 namespace cpp2 {
@@ -30,9 +36,9 @@ namespace cpp2 {
 //  p       predicate to apply
 //
 auto move_next(
-    std::string const& line,
-    int&               i,
-    auto               p
+    std::string_view line,
+    int&             i,
+    auto             p
 )
     -> bool
 {
@@ -56,7 +62,7 @@ auto move_next(
 //
 //  line    current line being processed
 //
-auto peek_first_non_whitespace(std::string const& line)
+auto peek_first_non_whitespace(std::string_view line)
     -> char
 {
     auto i = 0;
@@ -82,8 +88,8 @@ struct is_preprocessor_ret {
     bool has_continuation;
 };
 auto is_preprocessor(
-    std::string const& line,
-    bool               first_line
+    std::string_view line,
+    bool             first_line
 )
     -> is_preprocessor_ret
 {
@@ -97,7 +103,7 @@ auto is_preprocessor(
     }
 
     //  return true iff last character is a \ continuation
-    return { true, line.back() == '\\' };
+    return { true, !line.empty() && line.back() == '\\' };
 }
 
 
@@ -561,6 +567,70 @@ auto starts_with_preprocessor_if_else_endif(
 }
 
 
+//---------------------------------------------------------------------------
+//  find_first_of_chars: returns the position of the first character in
+//  line at or after pos that is one of Chars, or ssize(line) if none
+//
+//  The line scanners below use this to jump straight to the characters
+//  that can change their state, comparing 16 characters at a time where
+//  SSE2 is available
+//
+template<char... Chars>
+auto find_first_of_chars(
+    std::string_view line,
+    int              pos
+)
+    -> int
+{
+    auto const size = unchecked_narrow<int>(std::ssize(line));
+
+#ifdef CPP2_USE_SSE2
+    for (; pos + 16 <= size; pos += 16)
+    {
+        auto block   = _mm_loadu_si128(reinterpret_cast<__m128i const*>(line.data() + pos));
+        auto matches = _mm_setzero_si128();
+        ((matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8(Chars)))), ...);
+        if (auto mask = unchecked_narrow<unsigned>(_mm_movemask_epi8(matches))) {
+            return pos + std::countr_zero(mask);
+        }
+    }
+#endif
+
+    while (
+        pos < size
+        && ((line[pos] != Chars) && ...)
+        )
+    {
+        ++pos;
+    }
+    return pos;
+}
+
+
+//---------------------------------------------------------------------------
+//  skipped_to: update the last two characters seen, prev and prev2, as
+//  if a scanner had stepped one at a time through line[from, to)
+//
+auto skipped_to(
+    std::string_view line,
+    int              from,
+    int              to,
+    char&            prev,
+    char&            prev2
+)
+    -> void
+{
+    if (to - from >= 2) {
+        prev2 = line[to-2];
+        prev  = line[to-1];
+    }
+    else if (to - from == 1) {
+        prev2 = prev;
+        prev  = line[from];
+    }
+}
+
+
 //---------------------------------------------------------------------------
 //  process_cpp_line: just enough to know what to skip over
 //
@@ -605,6 +675,36 @@ auto process_cpp_line(
     auto prev2 = ' ';
     for (auto i = colno_t{0}; i < ssize(line); ++i)
     {
+        //  Outside raw string literals, only these characters can change
+        //  the state, so skip quickly to the next one
+        if (!in_raw_string_literal)
+        {
+            auto next = find_first_of_chars<'R', '"', '{', '}', '*', '/'>(line, i);
+            if (next > i)
+            {
+                if (
+                    r.empty_line
+                    && std::any_of(&line[i], &line[i] + (next - i), [](char c) { return !isspace(c); })
+                    )
+                {
+                    r.empty_line = false;
+                }
+                if (
+                    !in_comment
+                    || in_string_literal
+                    )
+                {
+                    r.all_comment_line = false;
+                    r.all_rawstring_line = false;
+                }
+                skipped_to(line, i, next, prev, prev2);
+                i = next;
+                if (i == ssize(line)) {
+                    break;
+                }
+            }
+        }
+
         //  Local helper functions for readability
         //  Note: in_literal is for { and } and so doesn't have to work for escaped ' characters
         //
@@ -746,6 +846,19 @@ auto process_cpp2_line(
 
     for (auto i = colno_t{0}; i < ssize(line); ++i)
     {
+        //  Only these characters can change the state (including encoding
+        //  prefixes of character literals), so skip quickly to the next one
+        if (auto next = find_first_of_chars<'{', '(', '}', ')', ';', '*', '/', '"', '\'', 'u', 'U', 'L', 'R'>(line, i);
+            next > i
+            )
+        {
+            skipped_to(line, i, next, prev, prev2);
+            i = next;
+            if (i == ssize(line)) {
+                break;
+            }
+        }
+
         if (in_comment)
         {
             switch (line[i]) {
@@ -857,11 +970,6 @@ class source
     bool                      cpp1_found             = false;
     bool                      cpp2_found             = false;
 
-    static const int max_line_len = 90'000;
-        //  do not reduce this - I encountered an 80,556-char
-        //  line in real world code during testing
-    char buf[max_line_len] {0};
-
 public:
     //-----------------------------------------------------------------------
     //  Constructor
@@ -927,11 +1035,17 @@ public:
     //  filename                the source file to be loaded
     //  source                  program textual representation
     //
+    //  The whole file is read in one go and then split into lines, so
+    //  each line is copied only once, into its source_line, and there
+    //  is no limit on line length (real-world code has 80,000+ char lines)
+    //
     auto load(
         std::string const&  filename
     )
         -> bool
     {
+        auto trace = trace_scope("source::load");
+
         //  If filename is stdin, we read from stdin, otherwise we try to read the file
         //
         auto is_stdin = filename == "stdin";
@@ -942,6 +1056,35 @@ public:
             if( !fss.is_open()) { return false; }
         }
         std::istream& in = is_stdin ? std::cin : fss;
+
+        auto contents = std::ostringstream{};
+        contents << in.rdbuf();
+        if (in.bad())
+        {
+            errors.emplace_back(
+                source_position(0, 0),
+                std::string("unexpected error reading source file"),
+                false,
+                true    // a noisy fallback error
+            );
+            return false;
+        }
+        auto const text = std::move(contents).str();
+        lines.reserve( lines.size() + std::count(text.begin(), text.end(), '\n') + 1 );
+
+        //  Step through the text a line at a time, like getline
+        //
+        auto rest = std::string_view{text};
+        auto line = std::string_view{};
+        auto next_line = [&] {
+            if (rest.empty()) {
+                return false;
+            }
+            auto end = rest.find('\n');
+            line = rest.substr(0, end);
+            rest.remove_prefix(end == rest.npos ? rest.size() : end + 1);
+            return true;
+        };
     
         auto in_comment            = false;
         auto in_string_literal     = false;
@@ -951,7 +1094,7 @@ public:
         auto braces = braces_tracker(errors);
 
         auto add_preprocessor_line = [&] {
-            lines.push_back({ &buf[0], source_line::category::preprocessor });
+            lines.push_back({ line, source_line::category::preprocessor });
             if (auto pre = starts_with_preprocessor_if_else_endif(lines.back().text);
                 pre != preprocessor_conditional::none
                 )
@@ -969,11 +1112,11 @@ public:
             }
         };
 
-        while (in.getline(&buf[0], max_line_len)) {
+        while (next_line()) {
 
             //  Handle preprocessor source separately, they're outside the language
             //
-            if (auto pre = is_preprocessor(buf, true);
+            if (auto pre = is_preprocessor(line, true);
                 pre.is_preprocessor
                 && !in_comment
                 && !in_raw_string_literal
@@ -983,17 +1126,17 @@ public:
                 add_preprocessor_line();
                 while (
                     pre.has_continuation
-                    && in.getline(&buf[0], max_line_len)
+                    && next_line()
                     )
                 {
                     add_preprocessor_line();
-                    pre = is_preprocessor(buf, false);
+                    pre = is_preprocessor(line, false);
                 }
             }
 
             else
             {
-                lines.push_back({ &buf[0], source_line::category::cpp1 });
+                lines.push_back({ line, source_line::category::cpp1 });
 
                 auto starts_with_import = [&](auto& text) {
                   return starts_with_tokens(text, {"import"})
@@ -1035,10 +1178,10 @@ public:
                             unchecked_narrow<lineno_t>(std::ssize(lines)-1),
                             errors
                         )
-                        && in.getline(&buf[0], max_line_len)
+                        && next_line()
                         )
                     {
-                        lines.push_back({ &buf[0], source_line::category::cpp2 });
+                        lines.push_back({ line, source_line::category::cpp2 });
                     }
                 }
 
@@ -1092,31 +1235,6 @@ public:
             }
         }
 
-        //  Because I encountered very long lines in real-world code during testing
-        //
-        if (in.gcount() >= max_line_len-1)
-        {
-            errors.emplace_back(
-                source_position(lineno_t(std::ssize(lines)), 0),
-                std::string("source line too long - length must be less than ")
-                    + std::to_string(max_line_len)
-            );
-            return false;
-        }
-
-        //  This shouldn't be possible, so check it anyway
-        //
-        if (!in.eof())
-        {
-            errors.emplace_back(
-                source_position(lineno_t(std::ssize(lines)), 0),
-                std::string("unexpected error reading source lines - did not reach EOF"),
-                false,
-                true    // a noisy fallback error
-            );
-            return false;
-        }
-
         braces.found_eof( source_position(lineno_t(std::ssize(lines)), 0) );
 
         return true;
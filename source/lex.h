@@ -17,6 +17,9 @@
 #include <map>
 #include <climits>
 #include <cstring>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
 
 
 namespace cpp2 {
@@ -209,6 +212,75 @@ auto is_operator(lexeme l)
 }
 
 
+//-----------------------------------------------------------------------
+//
+//  Identifier atoms: each distinct identifier or keyword spelling gets a
+//  small integer, so that tokens can be compared and hashed by that
+//  instead of by their text
+//
+//  The table is shared by all threads (tokens from different threads'
+//  compilations and parsers can be compared), and each thread keeps a
+//  cache of it so that interning a known spelling doesn't take a lock
+//
+//-----------------------------------------------------------------------
+//
+class atom_table
+{
+    std::shared_mutex                             mutex;
+    std::deque<std::string>                       spellings;
+    std::unordered_map<std::string_view, index_t> atoms;
+
+public:
+    //  Returns the atom for s, and its spelling as stored in the table
+    //  (which stays valid for the life of the process)
+    //
+    auto intern(std::string_view s)
+        -> std::pair<index_t, std::string_view>
+    {
+        {
+            auto lock = std::shared_lock{mutex};
+            if (auto iter = atoms.find(s); iter != atoms.end()) {
+                return { iter->second, iter->first };
+            }
+        }
+
+        auto lock = std::unique_lock{mutex};
+        if (auto iter = atoms.find(s); iter != atoms.end()) {
+            return { iter->second, iter->first };
+        }
+        auto const& spelling = spellings.emplace_back(s);
+        auto atom = unchecked_narrow<index_t>(std::ssize(spellings));
+        atoms.emplace(spelling, atom);
+        return { atom, spelling };
+    }
+};
+
+auto intern_atom(std::string_view s)
+    -> index_t
+{
+    static auto table = atom_table{};
+    thread_local auto known = std::unordered_map<std::string_view, index_t>{};
+
+    if (auto iter = known.find(s); iter != known.end()) {
+        return iter->second;
+    }
+    auto [atom, spelling] = table.intern(s);
+    known.emplace(spelling, atom);
+    return atom;
+}
+
+auto is_identifier_like(lexeme l)
+    -> bool
+{
+    return
+        l == lexeme::Identifier
+        || l == lexeme::Keyword
+        || l == lexeme::Cpp1MultiKeyword
+        || l == lexeme::Cpp2FixedType
+        ;
+}
+
+
 //-----------------------------------------------------------------------
 //
 //  token: represents a single token
@@ -229,6 +301,7 @@ public:
       : sv      {start, unchecked_narrow<ulong>(count)}
       , pos     {pos}
       , lex_type{type}
+      , atom    {is_identifier_like(type) ? intern_atom(sv) : 0}
     {
     }
 
@@ -240,6 +313,7 @@ public:
       : sv      {sz}
       , pos     {pos}
       , lex_type{type}
+      , atom    {is_identifier_like(type) ? intern_atom(sv) : 0}
     {
     }
 
@@ -258,6 +332,9 @@ public:
     auto operator== (token const& t) const
         -> bool
     {
+        if (atom && t.atom) {
+            return atom == t.atom;
+        }
         return operator std::string_view() == t.operator std::string_view();
     }
 
@@ -292,7 +369,21 @@ public:
 
     auto type    () const -> lexeme          { return lex_type;                      }
 
-    auto set_type(lexeme l) -> void          { lex_type = l;                         }
+    auto set_type(lexeme l) -> void
+    {
+        lex_type = l;
+        if (!atom && is_identifier_like(l)) {
+            atom = intern_atom(sv);
+        }
+    }
+
+    //  The atom of this token's text, for comparing and hashing names
+    //  (interned here if this token didn't get one when it was made)
+    auto get_atom() const
+        -> index_t
+    {
+        return atom ? atom : intern_atom(sv);
+    }
 
     auto visit(auto& v, int depth) const
         -> void
@@ -310,6 +401,9 @@ public:
         {
             sv.remove_prefix(prefix.size());
             pos.colno += unchecked_narrow<colno_t>(prefix.size());
+            if (atom) {
+                atom = intern_atom(sv);
+            }
         }
     }
 
@@ -332,26 +426,32 @@ private:
     std::string_view sv;
     source_position  pos;
     lexeme           lex_type;
+    index_t          atom               = 0;
     mutable index_t  global_token_order = 0;
 };
 
 static_assert (CHAR_BIT == 8);
 
 
+//  Per-compilation state: see reset_compilation_state()
+thread_local auto position_labels = std::unordered_map<token const*, std::string>{};
+
+//  If set, each position asked to be labeled is also appended here, so
+//  that the order they're first asked for in can be checked afterwards
+thread_local auto position_label_requests = static_cast<std::vector<token const*>*>(nullptr);
+
 auto labelized_position(token const* t)
     -> std::string
 {
-    struct label {
-        std::string text;
-        label() {
-            static auto ordinal = 0;                                        // TODO: static
-            text = std::to_string(++ordinal);
-        }
-    };
-    static auto labels = std::unordered_map<token const*, label const>{};   // TODO: static
-
     assert (t);
-    return labels[t].text;
+    if (position_label_requests) {
+        position_label_requests->push_back(t);
+    }
+    auto [label, inserted] = position_labels.try_emplace(t);
+    if (inserted) {
+        label->second = std::to_string(std::ssize(position_labels));
+    }
+    return label->second;
 }
 
 auto unnamed_type_param_name(int ordinal, token const* t)
@@ -592,6 +692,232 @@ auto expand_raw_string_literal(
     return parts;
 }
 
+//-----------------------------------------------------------------------
+//  keyword_table: A fixed set of words and the lexeme of each, stored in
+//  a perfect hash table that is built at compile time
+//
+//  Looking up a word costs one hash of the word and one comparison with
+//  the single entry it can be in, however many words are in the table
+//
+struct keyword_entry
+{
+    std::string_view word = {};
+    lexeme           type = {};
+};
+
+template<std::size_t N>
+class keyword_table
+{
+    //  The words are hashed into buckets, and each bucket has a displacement
+    //  that was chosen to move all its words into otherwise unused slots
+    static constexpr auto num_buckets = std::bit_ceil(N);
+    static constexpr auto num_slots   = std::bit_ceil(N * 2);
+
+    std::array<std::uint32_t, num_buckets> displacements = {};
+    std::array<keyword_entry, num_slots>   slots         = {};
+
+    static constexpr auto hash(std::string_view word)
+        -> std::uint64_t
+    {
+        //  FNV-1a
+        auto h = std::uint64_t{14695981039346656037u};
+        for (auto c : word) {
+            h = (h ^ static_cast<unsigned char>(c)) * 1099511628211u;
+        }
+        return h;
+    }
+
+    static constexpr auto slot_of(std::uint64_t h, std::uint32_t displacement)
+        -> std::size_t
+    {
+        h ^= displacement * std::uint64_t{0x9e3779b97f4a7c15u};
+        h ^= h >> 29;
+        h *= 0xbf58476d1ce4e5b9u;
+        h ^= h >> 32;
+        return h & (num_slots - 1);
+    }
+
+public:
+    consteval keyword_table(std::array<keyword_entry, N> const& entries)
+    {
+        auto bucket_of   = std::array<std::size_t, N>{};
+        auto bucket_size = std::array<std::size_t, num_buckets>{};
+        auto max_size    = std::size_t{0};
+        for (auto i = std::size_t{0}; i < N; ++i) {
+            bucket_of[i] = hash(entries[i].word) & (num_buckets - 1);
+            max_size = std::max(max_size, ++bucket_size[bucket_of[i]]);
+        }
+
+        //  Place the fullest buckets first, while there is the most room
+        for (auto size = max_size; size > 0; --size) {
+            for (auto b = std::size_t{0}; b < num_buckets; ++b)
+            {
+                if (bucket_size[b] != size) {
+                    continue;
+                }
+
+                //  Try displacements until this bucket's words all land in
+                //  different unused slots
+                for (auto d = std::uint32_t{0};; ++d)
+                {
+                    auto placed     = std::array<std::size_t, N>{};
+                    auto num_placed = std::size_t{0};
+                    for (auto i = std::size_t{0}; i < N; ++i)
+                    {
+                        if (bucket_of[i] != b) {
+                            continue;
+                        }
+                        auto slot = slot_of(hash(entries[i].word), d);
+                        if (
+                            !slots[slot].word.empty()
+                            || std::find(placed.begin(), placed.begin() + num_placed, slot) != placed.begin() + num_placed
+                            )
+                        {
+                            break;
+                        }
+                        placed[num_placed++] = slot;
+                    }
+
+                    if (num_placed == size) {
+                        for (auto i = std::size_t{0}, j = std::size_t{0}; i < N; ++i) {
+                            if (bucket_of[i] == b) {
+                                slots[placed[j++]] = entries[i];
+                            }
+                        }
+                        displacements[b] = d;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    //  Returns the entry for word, or an entry with an empty word if
+    //  word is not in the table
+    //
+    constexpr auto find(std::string_view word) const
+        -> keyword_entry
+    {
+        auto h = hash(word);
+        auto const& slot = slots[slot_of(h, displacements[h & (num_buckets - 1)])];
+        if (slot.word == word) {
+            return slot;
+        }
+        return {};
+    }
+};
+
+
+//G keyword:
+//G     any Cpp1-and-Cpp2 keyword
+//G     one of: 'import' 'module' 'export' 'is' 'as'
+//G
+//  Cpp2 has a smaller set of the Cpp1 globally reserved keywords, but we continue to
+//  reserve all the ones Cpp1 has both for compatibility and to not give up a keyword
+//  Some keywords like "delete" and "union" are not in this list because we reject them elsewhere
+//  Cpp2 also adds a couple, notably "is" and "as"
+//
+//  The Cpp1 fundamental type keywords that can be combined into multi-token type
+//  names (e.g., "unsigned long") are lexed as Cpp1MultiKeyword to be merged later,
+//  and the Cpp2 fixed-width type alias keywords are lexed as Cpp2FixedType
+//
+constexpr auto keywords = keyword_table{ std::to_array<keyword_entry>({
+    {"alignas",          lexeme::Keyword},
+    {"alignof",          lexeme::Keyword},
+    {"asm",              lexeme::Keyword},
+    {"as",               lexeme::Keyword},
+    {"auto",             lexeme::Keyword},
+    {"bool",             lexeme::Keyword},
+    {"break",            lexeme::Keyword},
+    {"case",             lexeme::Keyword},
+    {"catch",            lexeme::Keyword},
+    {"char16_t",         lexeme::Cpp1MultiKeyword},
+    {"char32_t",         lexeme::Cpp1MultiKeyword},
+    {"char8_t",          lexeme::Cpp1MultiKeyword},
+    {"char",             lexeme::Cpp1MultiKeyword},
+    {"co_await",         lexeme::Keyword},
+    {"co_return",        lexeme::Keyword},
+    {"co_yield",         lexeme::Keyword},
+    {"concept",          lexeme::Keyword},
+    {"const_cast",       lexeme::Keyword},
+    {"consteval",        lexeme::Keyword},
+    {"constexpr",        lexeme::Keyword},
+    {"constinit",        lexeme::Keyword},
+    {"const",            lexeme::Keyword},
+    {"continue",         lexeme::Keyword},
+    {"decltype",         lexeme::Keyword},
+    {"default",          lexeme::Keyword},
+    {"double",           lexeme::Cpp1MultiKeyword},
+    {"do",               lexeme::Keyword},
+    {"dynamic_cast",     lexeme::Keyword},
+    {"else",             lexeme::Keyword},
+    {"enum",             lexeme::Keyword},
+    {"explicit",         lexeme::Keyword},
+    {"export",           lexeme::Keyword},
+    {"extern",           lexeme::Keyword},
+    {"float",            lexeme::Cpp1MultiKeyword},
+    {"for",              lexeme::Keyword},
+    {"friend",           lexeme::Keyword},
+    {"goto",             lexeme::Keyword},
+    {"if",               lexeme::Keyword},
+    {"import",           lexeme::Keyword},
+    {"inline",           lexeme::Keyword},
+    {"int",              lexeme::Cpp1MultiKeyword},
+    {"is",               lexeme::Keyword},
+    {"long",             lexeme::Cpp1MultiKeyword},
+    {"module",           lexeme::Keyword},
+    {"mutable",          lexeme::Keyword},
+    {"namespace",        lexeme::Keyword},
+    {"noexcept",         lexeme::Keyword},
+    {"operator",         lexeme::Keyword},
+    {"private",          lexeme::Keyword},
+    {"protected",        lexeme::Keyword},
+    {"public",           lexeme::Keyword},
+    {"register",         lexeme::Keyword},
+    {"reinterpret_cast", lexeme::Keyword},
+    {"requires",         lexeme::Keyword},
+    {"return",           lexeme::Keyword},
+    {"short",            lexeme::Cpp1MultiKeyword},
+    {"signed",           lexeme::Cpp1MultiKeyword},
+    {"sizeof",           lexeme::Keyword},
+    {"static_assert",    lexeme::Keyword},
+    {"static_cast",      lexeme::Keyword},
+    {"static",           lexeme::Keyword},
+    {"switch",           lexeme::Keyword},
+    {"template",         lexeme::Keyword},
+    {"this",             lexeme::Keyword},
+    {"thread_local",     lexeme::Keyword},
+    {"throws",           lexeme::Keyword},
+    {"throw",            lexeme::Keyword},
+    {"try",              lexeme::Keyword},
+    {"typedef",          lexeme::Keyword},
+    {"typeid",           lexeme::Keyword},
+    {"typename",         lexeme::Keyword},
+    {"unsigned",         lexeme::Cpp1MultiKeyword},
+    {"using",            lexeme::Keyword},
+    {"virtual",          lexeme::Keyword},
+    {"void",             lexeme::Keyword},
+    {"volatile",         lexeme::Keyword},
+    {"wchar_t",          lexeme::Keyword},
+    {"while",            lexeme::Keyword},
+    {"i8",               lexeme::Cpp2FixedType},
+    {"i16",              lexeme::Cpp2FixedType},
+    {"i32",              lexeme::Cpp2FixedType},
+    {"i64",              lexeme::Cpp2FixedType},
+    {"longdouble",       lexeme::Cpp2FixedType},
+    {"longlong",         lexeme::Cpp2FixedType},
+    {"u8",               lexeme::Cpp2FixedType},
+    {"u16",              lexeme::Cpp2FixedType},
+    {"u32",              lexeme::Cpp2FixedType},
+    {"u64",              lexeme::Cpp2FixedType},
+    {"ulonglong",        lexeme::Cpp2FixedType},
+    {"ulong",            lexeme::Cpp2FixedType},
+    {"ushort",           lexeme::Cpp2FixedType},
+    {"_schar",           lexeme::Cpp2FixedType},
+    {"_uchar",           lexeme::Cpp2FixedType}
+}) };
+
+
 //-----------------------------------------------------------------------
 //  lex: Tokenize a single line while maintaining inter-line state
 //
@@ -609,11 +935,13 @@ auto expand_raw_string_literal(
 //  A stable place to store additional text for source tokens that are merged
 //  into a whitespace-containing token (to merge the Cpp1 multi-token keywords)
 //  -- this isn't about tokens generated later, that's tokens::generated_tokens
-static auto generated_text  = stable_vector<std::string>{};                // TODO: static
-static auto generated_lines = stable_vector<std::vector<source_line>>{};   // TODO: static
+//
+//  These are per-compilation state: see reset_compilation_state()
+thread_local auto generated_text  = stable_vector<std::string>{};
+thread_local auto generated_lines = stable_vector<std::vector<source_line>>{};
 
 
-static auto multiline_raw_strings = stable_vector<multiline_raw_string>{}; // TODO: static
+thread_local auto multiline_raw_strings = stable_vector<multiline_raw_string>{};
 
 auto lex_line(
     std::string&               mutable_line,
@@ -1110,80 +1438,20 @@ auto lex_line(
         return 0;
     };
 
-    //G keyword:
-    //G     any Cpp1-and-Cpp2 keyword
-    //G     one of: 'import' 'module' 'export' 'is' 'as'
-    //G
-    auto do_is_keyword = [&](std::vector<std::string_view> const& r) {
-        auto remaining_line = std::string_view(line).substr(i);
-        auto m = std::find_if(r.begin(), r.end(), [&](std::string_view s) {
-            return remaining_line.starts_with(s);
-        });
-        if (m != r.end()) {
-            //  If we matched and what's next is EOL or a non-identifier char, we matched!
-            if (
-                i+std::ssize(*m) == std::ssize(line)                // EOL
-                || !is_identifier_continue(line[i+std::size(*m)])   // non-identifier char
-                )
-            {
-                return static_cast<int>(std::ssize(*m));
-            }
-        }
-        return 0;
-    };
-
-    auto peek_is_keyword = [&]
-    {
-        //  Cpp2 has a smaller set of the Cpp1 globally reserved keywords, but we continue to
-        //  reserve all the ones Cpp1 has both for compatibility and to not give up a keyword
-        //  Some keywords like "delete" and "union" are not in this list because we reject them elsewhere
-        //  Cpp2 also adds a couple, notably "is" and "as"
-        static const auto keys = std::vector<std::string_view>{
-            "alignas", "alignof", "asm", "as", "auto",
-            "bool", "break",
-            "case", "catch", "char16_t", "char32_t", "char8_t", "char", "co_await", "co_return",
-            "co_yield", "concept", "const_cast", "consteval", "constexpr", "constinit", "const", "continue",
-            "decltype", "default", "double", "do", "dynamic_cast",
-            "else", "enum", "explicit", "export", "extern",
-            "float", "for", "friend",
-            "goto",
-            "if", "import", "inline", "int", "is",
-            "long",
-            "module", "mutable",
-            "namespace", "noexcept",
-            "operator",
-            "private", "protected", "public",
-            "register", "reinterpret_cast", "requires", "return",
-            "short", "signed", "sizeof", "static_assert", "static_cast", "static", "switch",
-            "template", "this", "thread_local", "throws", "throw", "try", "typedef", "typeid", "typename",
-            "unsigned", "using",
-            "virtual", "void", "volatile",
-            "wchar_t", "while"
-        };
-
-        return do_is_keyword(keys);
-    };
-
-    auto peek_is_cpp2_fundamental_type_keyword = [&]
-    {
-        static const auto keys = std::vector<std::string_view>{
-            "i8", "i16", "i32", "i64", "longdouble", "longlong",
-            "u8", "u16", "u32", "u64", "ulonglong", "ulong", "ushort",
-            "_schar", "_uchar"
-        };
-
-        return do_is_keyword(keys);
-    };
-
-    auto peek_is_cpp1_multi_token_fundamental_keyword = [&]
+    //  If a keyword starts at i, returns its table entry (see `keywords`),
+    //  otherwise returns an entry with an empty word
+    auto peek_keyword = [&]()
+        -> keyword_entry
     {
-        static const auto multi_keys = std::vector<std::string_view>{
-            "char16_t", "char32_t", "char8_t", "char",
-            "double", "float",
-            "int", "long", "short",
-            "signed", "unsigned"
-        };
-        return do_is_keyword(multi_keys);
+        auto end = i;
+        while (
+            end < std::ssize(line)
+            && is_identifier_continue(line[end])
+            )
+        {
+            ++end;
+        }
+        return keywords.find( std::string_view(line).substr(i, end-i) );
     };
 
     auto reset_processing_of_the_line = [&]() {
@@ -1812,22 +2080,11 @@ auto lex_line(
                     }
                 }
 
-                //  Cpp1 multi-token fundamental type keyword
+                //  Keyword, including the Cpp1 multi-token fundamental type
+                //  keywords and the Cpp2 fixed-width type alias keywords
                 //
-                else if (auto j = peek_is_cpp1_multi_token_fundamental_keyword()) {
-                    store(j, lexeme::Cpp1MultiKeyword);
-                }
-
-                //  Cpp2 fixed-width type alias keyword
-                //
-                else if (auto j = peek_is_cpp2_fundamental_type_keyword()) {
-                    store(j, lexeme::Cpp2FixedType);
-                }
-
-                //  Other keyword
-                //
-                else if (auto j = peek_is_keyword()) {
-                    store(j, lexeme::Keyword);
+                else if (auto keyword = peek_keyword(); !keyword.word.empty()) {
+                    store(std::ssize(keyword.word), keyword.type);
 
                     if (tokens.back() == "const_cast") {
                         errors.emplace_back(
@@ -1920,21 +2177,35 @@ END:
 
 //-----------------------------------------------------------------------
 //
-//  tokens: a map of the tokens of a source file
+//  tokens: the tokens of a source file
 //
 //-----------------------------------------------------------------------
 //
 
+//  A contiguous run of Cpp2 lines and the tokens lexed from them
+//
+struct token_section
+{
+    lineno_t               lineno;      // the section's first line
+    std::span<token const> tokens;
+};
+
 class tokens
 {
     std::vector<error_entry>& errors;
 
     //  All non-comment source tokens go here, which will be parsed in the parser
-    std::map<lineno_t, std::vector<token>> grammar_map;
+    //
+    //  The tokens of all Cpp2 sections are stored back to back in one array,
+    //  in source order, and `sections` says where each section's run starts
+    //  and ends -- the parser walks each run by index
+    std::vector<token>                               all_tokens;
+    std::vector<std::pair<lineno_t, std::ptrdiff_t>> section_starts;
+    std::vector<token_section>                       sections;
 
     //  All comment source tokens go here, which are applied in the lexer
     //
-    //  We could put all the tokens in the same map, but that would mean the
+    //  We could put all the tokens in the same array, but that would mean the
     //  parsing logic would have to remember to skip comments everywhere...
     //  simpler to keep comments separate, at the smaller cost of traversing
     //  a second token stream when lowering to Cpp1 to re-interleave comments
@@ -1969,9 +2240,17 @@ public:
     )
         -> void
     {
+        auto trace = trace_scope("tokens::lex", is_generated ? "generated" : "");
+
         auto in_comment           = false;
         auto raw_string_multiline = std::optional<raw_string>();
 
+        //  Each section is lexed into `entry` first, so that lex_line's token
+        //  merging never looks back into the previous section, and then
+        //  appended to all_tokens; the section starts are kept as offsets
+        //  until all_tokens has stopped growing
+        auto entry = std::vector<token>{};
+
         assert (std::ssize(lines) > 0);
         auto line = std::begin(lines);
         while (line != std::end(lines)) {
@@ -1984,7 +2263,7 @@ public:
 
             //  At this point, we're at the first line of a Cpp2 code section
 
-            //  Create new map entry for the section starting at this line,
+            //  Create a new section starting at this line,
             //  and populate its tokens with the tokens in this section
             auto lineno = unchecked_narrow<lineno_t>(std::distance(std::begin(lines), line));
 
@@ -1994,7 +2273,8 @@ public:
                 lineno -= 10'000;
             }
 
-            auto& entry = grammar_map[lineno];
+            section_starts.emplace_back(lineno, std::ssize(all_tokens));
+            entry.clear();
             auto current_comment = std::string{};
             auto current_comment_start = source_position{};
 
@@ -2035,17 +2315,34 @@ public:
                     }
                 }
             }
+
+            all_tokens.insert( all_tokens.end(), entry.begin(), entry.end() );
+        }
+
+        //  Now that all_tokens is complete, point the sections into it
+        sections.clear();
+        sections.reserve( section_starts.size() );
+        for (auto i = 0; i < std::ssize(section_starts); ++i)
+        {
+            auto begin = section_starts[i].second;
+            auto end   = i+1 < std::ssize(section_starts)
+                            ? section_starts[i+1].second
+                            : std::ssize(all_tokens);
+            sections.push_back({
+                section_starts[i].first,
+                std::span<token const>{ all_tokens.data() + begin, unchecked_narrow<std::size_t>(end - begin) }
+            });
         }
     }
 
 
     //-----------------------------------------------------------------------
-    //  get_map: Access the token map
+    //  get_sections: Access the Cpp2 sections, in source order
     //
-    auto get_map() const
-        -> auto const&
+    auto get_sections() const
+        -> std::vector<token_section> const&
     {
-        return grammar_map;
+        return sections;
     }
 
 
@@ -2090,10 +2387,10 @@ public:
     auto debug_print(std::ostream& o) const
         -> void
     {
-        for (auto const& [lineno, entry] : grammar_map) {
+        for (auto const& [lineno, section_tokens] : sections) {
 
             o << "--- Section starting at line " << lineno << "\n";
-            for (auto const& token : entry) {
+            for (auto const& token : section_tokens) {
                 o << "    " << token << " (" << token.position().lineno
                     << "," << token.position().colno << ") "
                     << _as<std::string>(token.type()) << "\n";
@@ -2126,7 +2423,7 @@ public:
 
 };
 
-static auto generated_lexers = stable_vector<tokens>{};    // TODO: static
+thread_local auto generated_lexers = stable_vector<tokens>{};  // per-compilation, see reset_compilation_state()
 
 }
 
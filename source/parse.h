@@ -18,7 +18,7 @@
 
 namespace cpp2 {
 
-auto violates_lifetime_safety = false;
+thread_local auto violates_lifetime_safety = false;   // per-compilation, see reset_compilation_state()
 
 //-----------------------------------------------------------------------
 //  Operator categorization
@@ -97,6 +97,145 @@ auto is_assignment_operator(lexeme l)
 //-----------------------------------------------------------------------
 //
 
+//-----------------------------------------------------------------------
+//  node_arena: Where parse tree nodes are allocated
+//
+//  Nodes are carved out of large blocks, and a freed node's memory goes
+//  on a free list for its size to be reused by the next node of that size.
+//  When the last node is freed (the parse tree has been destroyed), the
+//  whole arena is recycled at once, keeping its blocks for the next tree
+//
+//  A node can be freed on a different thread than the one that allocated
+//  it (e.g., nodes from sections parsed in parallel are freed with the
+//  whole tree), as long as the two threads aren't using the arena at the
+//  same time: each block starts with a pointer to the arena that owns it,
+//  and a freed node goes back to its owner
+//
+class node_arena
+{
+    static constexpr auto block_size  = std::size_t{256 * 1024};
+    static constexpr auto granularity = alignof(std::max_align_t);
+    static constexpr auto max_pooled  = std::size_t{4096};  // larger requests use ::operator new
+
+    struct free_node {
+        free_node* next;
+    };
+
+    struct block_deleter {
+        auto operator()(std::byte* p) const -> void {
+            ::operator delete(p, std::align_val_t{block_size});
+        }
+    };
+
+    std::vector<std::unique_ptr<std::byte[], block_deleter>> blocks;
+    std::size_t                                              current_block = 0;
+    std::byte*                                               next          = nullptr;
+    std::byte*                                               end           = nullptr;
+    std::array<free_node*, max_pooled / granularity + 1>     free_lists    = {};
+    std::ptrdiff_t                                           live          = 0;
+
+    static auto size_class(std::size_t size)
+        -> std::size_t
+    {
+        return (size + granularity - 1) / granularity;
+    }
+
+public:
+    auto allocate(std::size_t size)
+        -> void*
+    {
+        if (size > max_pooled) {
+            return ::operator new(size);
+        }
+        ++live;
+
+        auto& free_list = free_lists[size_class(size)];
+        if (free_list) {
+            auto p = free_list;
+            free_list = p->next;
+            return p;
+        }
+
+        auto bytes = size_class(size) * granularity;
+        if (end - next < static_cast<std::ptrdiff_t>(bytes))
+        {
+            //  Move on to the next block, reusing one from an
+            //  earlier tree if there is one
+            if (next) {
+                ++current_block;
+            }
+            if (current_block == blocks.size()) {
+                blocks.emplace_back(
+                    static_cast<std::byte*>( ::operator new(block_size, std::align_val_t{block_size}) )
+                );
+                ::new (blocks.back().get()) node_arena*{ this };
+            }
+            next = blocks[current_block].get() + granularity;   // after the owner
+            end  = blocks[current_block].get() + block_size;
+        }
+
+        auto p = next;
+        next += bytes;
+        return p;
+    }
+
+    //  Free p, which was allocated with size by whichever arena owns it
+    //
+    static auto deallocate(void* p, std::size_t size)
+        -> void
+    {
+        if (size > max_pooled) {
+            ::operator delete(p);
+            return;
+        }
+
+        auto block = reinterpret_cast<std::uintptr_t>(p) & ~std::uintptr_t{block_size - 1};
+        (*reinterpret_cast<node_arena**>(block))->release(p, size);
+    }
+
+private:
+    auto release(void* p, std::size_t size)
+        -> void
+    {
+        auto& free_list = free_lists[size_class(size)];
+        free_list = ::new (p) free_node{ free_list };
+
+        assert (live > 0);
+        if (--live == 0)
+        {
+            current_block = 0;
+            next          = nullptr;
+            end           = nullptr;
+            free_lists    = {};
+        }
+    }
+};
+
+//  Per-thread, so that threads can allocate nodes without locking
+thread_local auto parse_tree_arena = node_arena{};
+
+
+//-----------------------------------------------------------------------
+//  arena_node: The base of every parse tree node type, so that nodes
+//  created with std::make_unique and owned by std::unique_ptr (including
+//  those parsed by metafunctions) live in parse_tree_arena
+//
+struct arena_node
+{
+    static auto operator new(std::size_t size)
+        -> void*
+    {
+        return parse_tree_arena.allocate(size);
+    }
+
+    static auto operator delete(void* p, std::size_t size)
+        -> void
+    {
+        node_arena::deallocate(p, size);
+    }
+};
+
+
 //-----------------------------------------------------------------------
 //  try_visit
 //
@@ -123,7 +262,7 @@ struct literal_node;
 struct template_argument;
 
 
-struct primary_expression_node
+struct primary_expression_node : arena_node
 {
     enum active : u8 { empty=0, expression_list, id_expression, declaration, inspect, literal };
     std::variant<
@@ -193,7 +332,7 @@ struct primary_expression_node
 };
 
 
-struct literal_node {
+struct literal_node : arena_node {
     //  A literal is represented as a sequence of tokens:
     //      - length 1: a literal (most common)
     //      - length 2: a literal and a user-defined suffix
@@ -266,7 +405,7 @@ struct literal_node {
 
 struct postfix_expression_node;
 
-struct prefix_expression_node
+struct prefix_expression_node : arena_node
 {
     std::vector<token const*>                ops;
     std::unique_ptr<postfix_expression_node> expr;
@@ -337,29 +476,97 @@ struct prefix_expression_node
 
 
 struct expression_node;
+struct is_as_expression_node;
+
+
+//-----------------------------------------------------------------------
+//  node_ref: A non-owning pointer to a parse tree node
+//
+//  Has the parts of std::unique_ptr's interface that a node's readers
+//  use, so a member can refer to a node owned elsewhere (e.g., by a
+//  flat_binary_expression) and be read the same way as an owning one
+//
+template<typename T>
+class node_ref
+{
+    T* p = nullptr;
+
+public:
+    node_ref() = default;
+
+    node_ref(T* p_)
+        : p{p_}
+    { }
+
+    auto get() const
+        -> T*
+    {
+        return p;
+    }
+
+    auto operator->() const
+        -> T*
+    {
+        assert(p);
+        return p;
+    }
+
+    auto operator*() const
+        -> T&
+    {
+        assert(p);
+        return *p;
+    }
+
+    explicit operator bool() const
+    {
+        return p;
+    }
+};
 
 
+//-----------------------------------------------------------------------
+//  binary_expression_node: One precedence level of a binary expression
+//
+//  The nodes for all the levels of an expression, from its top level
+//  (assignment-expression or logical-or-expression) down to each
+//  multiplicative-expression, are views built over one
+//  flat_binary_expression, which owns them and the operands (see there)
+//
 template<
     String   Name,
     typename Term
 >
-struct binary_expression_node
+struct binary_expression_node : arena_node
 {
-    std::unique_ptr<Term>  expr;
-    expression_node const* my_expression = {};
-
-    binary_expression_node();
+    //  The precedence level, from 0 for multiplicative-expression up
+    static constexpr auto level = []{
+        if constexpr (std::is_same_v<Term, is_as_expression_node>) {
+            return 0;
+        }
+        else {
+            return Term::level + 1;
+        }
+    }();
 
-    // Out-of-line definition of the dtor is necessary due to the forward-declared
-    // type(s) used as Term in a std::unique_ptr as a member
-    ~binary_expression_node();
+    node_ref<Term>         expr;
+    expression_node const* my_expression = {};
 
     struct term
     {
-        token const* op;
-        std::unique_ptr<Term> expr;
+        token const*   op;
+        node_ref<Term> expr;
     };
-    std::vector<term> terms;
+    std::span<term> terms;
+
+    //  These nodes are only created in, and deleted with, their
+    //  flat_binary_expression: deleting the top-level node deletes
+    //  the whole expression
+    static auto operator new(std::size_t)
+        -> void* = delete;
+
+    static auto operator delete(binary_expression_node* p, std::destroying_delete_t)
+        -> void;
 
 
     //  API
@@ -566,8 +773,6 @@ struct binary_expression_node
 };
 
 
-struct is_as_expression_node;
-
 using multiplicative_expression_node = binary_expression_node< "multiplicative" , is_as_expression_node          >;
 using additive_expression_node       = binary_expression_node< "additive"       , multiplicative_expression_node >;
 using shift_expression_node          = binary_expression_node< "shift"          , additive_expression_node       >;
@@ -582,6 +787,89 @@ using logical_or_expression_node     = binary_expression_node< "logical-or"
 using assignment_expression_node     = binary_expression_node< "assignment"     , logical_or_expression_node     >;
 
 
+//-----------------------------------------------------------------------
+//  flat_binary_expression: A binary expression as the flat sequence of
+//  its operands and the operators between them
+//
+//  The parser reads all the binary precedence levels of an expression in
+//  one loop (see parser::binary_expression) into its operands and, for
+//  each operator, the precedence level it is at. make() then builds the
+//  binary_expression_node for each level as a view over those, and puts
+//  everything in one block of memory, starting with this header:
+//
+//      header, top-level node, then for each level: its nodes (after
+//      the top level), its terms; and last, the operands
+//
+//  An operand alone (e.g., a literal) still has a node at every level,
+//  for the readers that walk the levels (to_cpp1, sema, and reflect.h2's
+//  binary_expression), but those are small views in one allocation
+//  instead of a dozen separately allocated nodes that own each other
+//
+struct flat_binary_expression
+{
+    static constexpr auto num_levels = assignment_expression_node::level + 1;
+
+    struct binary_operator {
+        token const* op;
+        int          level;     // see binary_expression_node::level
+    };
+
+    //  Build an expression with Root as its top-level node
+    //
+    //  operands    the operands, which are moved from
+    //  operators   operators[i] is between operands[i] and operands[i+1]
+    //
+    template<typename Root>
+    static auto make(
+        std::span<std::unique_ptr<is_as_expression_node>> operands,
+        std::span<binary_operator const>                  operators,
+        expression_node const*                            my_expression
+    )
+        -> std::unique_ptr<Root>;
+
+    //  Delete the expression whose top-level node is root
+    static auto destroy(void* root)
+        -> void;
+
+private:
+    std::unique_ptr<is_as_expression_node>* operands     = {};
+    int                                     num_operands = 0;
+    std::size_t                             size         = 0;   // of the whole block
+
+    //  make()'s progress in laying out and filling in the block
+    struct layout {
+        std::byte*                               block         = {};
+        std::array<int, num_levels>              nodes         = {};    // per level
+        std::array<int, num_levels>              terms         = {};
+        std::array<std::size_t, num_levels>      next_node     = {};    // offsets in block
+        std::array<std::size_t, num_levels>      next_term     = {};
+        std::unique_ptr<is_as_expression_node>*  operands      = {};
+        std::span<binary_operator const>         operators     = {};
+        expression_node const*                   my_expression = {};
+
+        template<typename T, typename... Args>
+        auto place(std::size_t& offset, Args&&... args)
+            -> T*
+        {
+            auto p = ::new (block + offset) T{ std::forward<Args>(args)... };
+            offset += sizeof(T);
+            return p;
+        }
+    };
+
+    template<typename Node>
+    using operand_of = std::remove_pointer_t<decltype(std::declval<Node&>().expr.get())>;
+
+    template<typename Node>
+    static auto lay_out(layout& l, std::size_t& size)
+        -> void;
+
+    template<typename Node>
+    static auto build(Node& n, int first, int last, layout& l)
+        -> void;
+};
+
+
 struct assignment_expression_lhs_rhs {
     postfix_expression_node*    lhs;
     logical_or_expression_node* rhs;
@@ -590,9 +878,9 @@ struct assignment_expression_lhs_rhs {
 
 struct expression_statement_node;
 
-struct expression_node
+struct expression_node : arena_node
 {
-    static inline std::vector<expression_node*> current_expressions = {};   // TODO: static ?
+    static inline thread_local std::vector<expression_node*> current_expressions = {};
 
     std::unique_ptr<assignment_expression_node> expr;
     int num_subexpressions = 0;
@@ -725,17 +1013,6 @@ struct expression_node
 };
 
 
-template<
-    String   Name,
-    typename Term
->
-binary_expression_node<Name, Term>::binary_expression_node() {
-    if (!expression_node::current_expressions.empty()) {
-        my_expression = expression_node::current_expressions.back();
-    }
-}
-
-
 template<
     String   Name,
     typename Term
@@ -779,7 +1056,7 @@ auto to_string_view(passing_style pass) -> std::string_view {
 }
 
 
-struct expression_list_node
+struct expression_list_node : arena_node
 {
     token const* open_paren  = {};
     token const* close_paren = {};
@@ -930,9 +1207,9 @@ auto primary_expression_node::get_literal() const
 }
 
 
-struct expression_statement_node
+struct expression_statement_node : arena_node
 {
-    static inline std::vector<expression_statement_node*> current_expression_statements = {};   // TODO: static ?
+    static inline thread_local std::vector<expression_statement_node*> current_expression_statements = {};
 
     std::unique_ptr<expression_node> expr;
     bool has_semicolon = false;
@@ -1025,7 +1302,7 @@ struct capture_group {
 };
 
 
-struct postfix_expression_node
+struct postfix_expression_node : arena_node
 {
     std::unique_ptr<primary_expression_node> expr;
 
@@ -1387,7 +1664,7 @@ struct template_argument
 // Used by functions that must return a reference to an empty arg list
 inline std::vector<template_argument> const no_template_args;
 
-struct unqualified_id_node
+struct unqualified_id_node : arena_node
 {
     token const* identifier      = {};  // required
 
@@ -1466,7 +1743,7 @@ struct unqualified_id_node
 };
 
 
-struct qualified_id_node
+struct qualified_id_node : arena_node
 {
     struct term {
         token const* scope_op;
@@ -1552,7 +1829,7 @@ struct qualified_id_node
 
 struct function_type_node;
 
-struct type_id_node
+struct type_id_node : arena_node
 {
     source_position pos;
 
@@ -1807,7 +2084,7 @@ auto template_argument::position() const
 }
 
 
-struct is_as_expression_node
+struct is_as_expression_node : arena_node
 {
     std::unique_ptr<prefix_expression_node> expr;
 
@@ -1984,7 +2261,7 @@ expression_node::expression_node()
 }
 
 
-struct id_expression_node
+struct id_expression_node : arena_node
 {
     source_position pos;
 
@@ -2235,7 +2512,7 @@ auto postfix_expression_node::visit(auto& v, int depth)
 
 struct statement_node;
 
-struct compound_statement_node
+struct compound_statement_node : arena_node
 {
     source_position open_brace;
     source_position close_brace;
@@ -2270,7 +2547,7 @@ struct compound_statement_node
 };
 
 
-struct selection_statement_node
+struct selection_statement_node : arena_node
 {
     bool                                        is_constexpr = false;
     token const*                                identifier   = {};
@@ -2347,7 +2624,7 @@ false;
 
 struct parameter_declaration_node;
 
-struct iteration_statement_node
+struct iteration_statement_node : arena_node
 {
     token const*                                label      = {};
     token const*                                identifier = {};
@@ -2443,7 +2720,7 @@ struct iteration_statement_node
 };
 
 
-struct return_statement_node
+struct return_statement_node : arena_node
 {
     token const*                     identifier = {};
     std::unique_ptr<expression_node> expression;
@@ -2479,7 +2756,7 @@ struct return_statement_node
 };
 
 
-struct alternative_node
+struct alternative_node : arena_node
 {
     std::unique_ptr<unqualified_id_node>     name;
     token const*                             is_as_keyword = {};
@@ -2507,7 +2784,7 @@ struct alternative_node
 };
 
 
-struct inspect_expression_node
+struct inspect_expression_node : arena_node
 {
     bool                             is_constexpr = false;
     token const*                     identifier   = {};
@@ -2548,7 +2825,7 @@ struct inspect_expression_node
 };
 
 
-struct contract_node
+struct contract_node : arena_node
 {
     //  Declared first, because it should outlive any owned
     //  postfix_expressions that could refer to it
@@ -2599,7 +2876,7 @@ struct contract_node
 };
 
 
-struct jump_statement_node
+struct jump_statement_node : arena_node
 {
     token const* keyword;
     token const* label;
@@ -2626,7 +2903,7 @@ struct jump_statement_node
 };
 
 
-struct using_statement_node
+struct using_statement_node : arena_node
 {
     bool                                export_ = false;
     token const*                        keyword = {};
@@ -2658,7 +2935,7 @@ struct using_statement_node
 
 struct parameter_declaration_list_node;
 
-struct statement_node
+struct statement_node : arena_node
 {
     std::unique_ptr<parameter_declaration_list_node> parameters;
     compound_statement_node* compound_parent = nullptr;
@@ -2805,7 +3082,7 @@ auto compound_statement_node::visit(auto& v, int depth)
 }
 
 
-struct parameter_declaration_node
+struct parameter_declaration_node : arena_node
 {
     parameter_declaration_list_node const* my_list;
 
@@ -2910,7 +3187,7 @@ struct parameter_declaration_node
 };
 
 
-struct parameter_declaration_list_node
+struct parameter_declaration_list_node : arena_node
 {
     token const* open_paren              = {};
     token const* close_paren             = {};
@@ -3028,7 +3305,7 @@ auto statement_node::visit(auto& v, int depth)
 
 struct function_returns_tag { };
 
-struct function_type_node
+struct function_type_node : arena_node
 {
     declaration_node* my_decl;
 
@@ -3395,7 +3672,7 @@ auto type_id_node::to_string() const
 }
 
 
-struct type_node
+struct type_node : arena_node
 {
     token const* type;
     bool         final = false;
@@ -3440,7 +3717,7 @@ struct type_node
 };
 
 
-struct namespace_node
+struct namespace_node : arena_node
 {
     token const* namespace_;
 
@@ -3462,7 +3739,7 @@ struct namespace_node
 };
 
 
-struct alias_node
+struct alias_node : arena_node
 {
     token const* type = {};
     std::unique_ptr<type_id_node> type_id;   // for objects
@@ -3525,8 +3802,9 @@ auto to_string(accessibility a)
 
 
 struct declaration_identifier_tag { };
+struct deferred_body_tag { declaration_node const* n; };
 
-struct declaration_node
+struct declaration_node : arena_node
 {
     //  The capture_group is declared first, because it should outlive
     //  any owned postfix_expressions that could refer to it
@@ -3554,6 +3832,17 @@ struct declaration_node
     source_position                 equal_sign = {};
     std::unique_ptr<statement_node> initializer;
 
+    //  A function body that was skipped when parsing, to be parsed only when
+    //  it's lowered (see parser::defer_function_bodies) -- until it's parsed,
+    //  initializer is an empty compound-statement with the body's braces
+    struct deferred_body_tokens {
+        declaration_node*      decl;        // this declaration, to parse the body into
+        std::span<token const> tokens;      // the tokens of the section it's in
+        int                    open_brace;  // the index of the body's '{' in tokens
+        bool                   is_parsed = false;
+    };
+    std::unique_ptr<deferred_body_tokens> deferred_body;
+
     declaration_node*               parent_declaration = {};
     statement_node*                 my_statement = {};
 
@@ -3784,6 +4073,15 @@ public:
         return initializer != nullptr;
     }
 
+    auto has_unparsed_body() const
+        -> bool
+    {
+        return
+            deferred_body
+            && !deferred_body->is_parsed
+            ;
+    }
+
     auto parameter_count() const
         -> int
     {
@@ -4674,6 +4972,13 @@ public:
     auto visit(auto& v, int depth)
         -> void
     {
+        //  A function whose body hasn't been parsed yet is visited as a whole
+        //  once it is (see sema::visit_deferred_function)
+        if (has_unparsed_body()) {
+            v.start(deferred_body_tag{this}, depth);
+            return;
+        }
+
         v.start(*this, depth);
 
         v.start(declaration_identifier_tag{}, depth);
@@ -5366,7 +5671,7 @@ auto parameter_declaration_node::visit(auto& v, int depth)
 }
 
 
-struct translation_unit_node
+struct translation_unit_node : arena_node
 {
     std::vector< std::unique_ptr<declaration_node> > declarations;
 
@@ -5399,15 +5704,149 @@ parameter_declaration_node::~parameter_declaration_node() = default;
 
 type_id_node::~type_id_node() = default;
 
-primary_expression_node::~primary_expression_node() = default;
+//-----------------------------------------------------------------------
+//  flat_binary_expression
+//
+template<typename Root>
+auto flat_binary_expression::make(
+    std::span<std::unique_ptr<is_as_expression_node>> operands,
+    std::span<binary_operator const>                  operators,
+    expression_node const*                            my_expression
+)
+    -> std::unique_ptr<Root>
+{
+    assert(
+        !operands.empty()
+        && operands.size() == operators.size() + 1
+    );
+    auto l = layout{};
+    l.operators     = operators;
+    l.my_expression = my_expression;
 
-prefix_expression_node::~prefix_expression_node() = default;
+    //  Each level has one node more than the number of operators above it
+    for (auto level = 0; level <= Root::level; ++level) {
+        l.nodes[level] = 1;
+    }
+    for (auto const& op : operators) {
+        assert(op.level <= Root::level);
+        ++l.terms[op.level];
+        for (auto level = 0; level < op.level; ++level) {
+            ++l.nodes[level];
+        }
+    }
+
+    auto size = sizeof(flat_binary_expression);
+    lay_out<Root>(l, size);
+    auto operands_offset = size;
+    size += operands.size() * sizeof(std::unique_ptr<is_as_expression_node>);
+
+    l.block = static_cast<std::byte*>(parse_tree_arena.allocate(size));
+    auto header = ::new (l.block) flat_binary_expression{};
+    header->size         = size;
+    header->num_operands = unchecked_narrow<int>(std::ssize(operands));
+    for (auto& operand : operands) {
+        auto p = l.place<std::unique_ptr<is_as_expression_node>>(operands_offset, std::move(operand));
+        if (!header->operands) {
+            header->operands = p;
+        }
+    }
+    l.operands = header->operands;
+
+    auto root = l.place<Root>(l.next_node[Root::level]);
+    assert(reinterpret_cast<std::byte*>(root) == l.block + sizeof(flat_binary_expression));
+    build(*root, 0, header->num_operands - 1, l);
+    return std::unique_ptr<Root>{ root };
+}
+
+template<typename Node>
+auto flat_binary_expression::lay_out(layout& l, std::size_t& size)
+    -> void
+{
+    l.next_node[Node::level] = size;
+    size += l.nodes[Node::level] * sizeof(Node);
+    l.next_term[Node::level] = size;
+    size += l.terms[Node::level] * sizeof(typename Node::term);
+
+    if constexpr (!std::is_same_v<operand_of<Node>, is_as_expression_node>) {
+        lay_out<operand_of<Node>>(l, size);
+    }
+}
+
+//  Fill in n, the node for operands [first, last] at its level
+//
+template<typename Node>
+auto flat_binary_expression::build(Node& n, int first, int last, layout& l)
+    -> void
+{
+    using Term = operand_of<Node>;
+    n.my_expression = l.my_expression;
+
+    //  This level's operators split [first, last] into n's terms
+    auto terms = static_cast<typename Node::term*>(nullptr);
+    auto count = 0;
+    for (auto term_first = first, i = first; i <= last; ++i)
+    {
+        if (
+            i < last
+            && l.operators[i].level != Node::level
+            )
+        {
+            continue;
+        }
+
+        auto term = node_ref<Term>{};
+        if constexpr (std::is_same_v<Term, is_as_expression_node>) {
+            assert(term_first == i);
+            term = l.operands[i].get();
+        }
+        else {
+            auto t = l.place<Term>(l.next_node[Term::level]);
+            build(*t, term_first, i, l);
+            term = t;
+        }
+
+        if (term_first == first) {
+            n.expr = term;
+        }
+        else {
+            auto t = l.place<typename Node::term>(l.next_term[Node::level], l.operators[term_first - 1].op, term);
+            if (!terms) {
+                terms = t;
+            }
+            ++count;
+        }
+        term_first = i + 1;
+    }
+    n.terms = { terms, unchecked_narrow<std::size_t>(count) };
+}
+
+auto flat_binary_expression::destroy(void* root)
+    -> void
+{
+    static_assert(std::is_trivially_destructible_v<assignment_expression_node>);
+
+    auto block  = static_cast<std::byte*>(root) - sizeof(flat_binary_expression);
+    auto header = std::launder(reinterpret_cast<flat_binary_expression*>(block));
+    auto size   = header->size;
+    std::destroy_n(header->operands, header->num_operands);
+    header->~flat_binary_expression();
+    node_arena::deallocate(block, size);
+}
 
 template<
     String   Name,
     typename Term
 >
-binary_expression_node<Name, Term>::~binary_expression_node() = default;
+auto binary_expression_node<Name, Term>::operator delete(binary_expression_node* p, std::destroying_delete_t)
+    -> void
+{
+    flat_binary_expression::destroy(p);
+}
+
+
+primary_expression_node::~primary_expression_node() = default;
+
+prefix_expression_node::~prefix_expression_node() = default;
 
 alternative_node::~alternative_node() = default;
 
@@ -5565,7 +6004,7 @@ auto primary_expression_node::to_string() const
 //-----------------------------------------------------------------------
 //  pre: Get an indentation prefix
 //
-inline static int         indent_spaces  = 2;
+inline thread_local int   indent_spaces  = 2;
 inline static std::string indent_str     = std::string( 1024, ' ' );    // "1K should be enough for everyone"
 
 auto pre(int indent)
@@ -6244,6 +6683,9 @@ auto pretty_print_visualize(namespace_node const&)
 }
 
 
+//  Per-compilation state: see reset_compilation_state()
+thread_local declaration_node const* pretty_print_last_parent_type = {};
+
 auto pretty_print_visualize(
     declaration_node const& n, 
     int                     indent, 
@@ -6315,10 +6757,9 @@ auto pretty_print_visualize(
         && !n.is_parameter()
         )
     {
-        static declaration_node const* last_parent_type = {};
         if (n.parent_is_type()) {
-            if (last_parent_type != n.get_parent()) {
-                last_parent_type = n.get_parent();
+            if (pretty_print_last_parent_type != n.get_parent()) {
+                pretty_print_last_parent_type = n.get_parent();
             }
             else {
                 ret += "\n";
@@ -6503,11 +6944,13 @@ class parser
         }
     };
 
-    std::vector<token> const* tokens           = {};
+    std::span<token const>    tokens           = {};
     stable_vector<token>*     generated_tokens = {};
     int                       pos              = 0;
     std::string               parse_kind       = {};
 
+    bool                      deferring_function_bodies = false;
+
     //  Keep track of the function bodies' locations - used to emit comments
     //  in the right pass (decide whether it's a comment that belongs with
     //  the declaration or is part of the definition)
@@ -6519,58 +6962,61 @@ class parser
 
         function_body_extent( lineno_t f, lineno_t l ): first{f}, last{l} { }
     };
-    mutable std::vector<function_body_extent> function_body_extents;
-    mutable bool                              is_function_body_extents_sorted = false;
+    std::vector<function_body_extent>         function_body_extents;
+
+    //  The union of the function_body_extents as disjoint sorted extents,
+    //  built on the first lookup after an extent is added
+    mutable std::vector<function_body_extent> merged_function_body_extents;
+    mutable bool                              is_merged_function_body_extents_current = false;
+
+    //  Where binary_expression collects an expression's operands and
+    //  operators -- an expression inside an operand (e.g., in parentheses)
+    //  uses the entries after those of the expression it's inside
+    std::vector<std::unique_ptr<is_as_expression_node>>  binary_operands;
+    std::vector<flat_binary_expression::binary_operator> binary_operators;
 
 public:
     auto is_within_function_body(source_position p) const
     {
-        //  Short circuit the empty case, so that the rest of the function
-        //  can unconditionally decrement any non-.begin() iterator once
-        if (function_body_extents.empty()) {
-            return false;
-        }
-
-        //  Ensure we are sorted
-        if (!is_function_body_extents_sorted) {
+        if (!is_merged_function_body_extents_current)
+        {
+            //  Function bodies nest (e.g., a local function or a lambda in
+            //  a function body), so coalesce overlapping extents so that a
+            //  lookup only needs to look at one of them
+            merged_function_body_extents = function_body_extents;
             std::sort(
-                function_body_extents.begin(),
-                function_body_extents.end()
+                merged_function_body_extents.begin(),
+                merged_function_body_extents.end()
             );
-            is_function_body_extents_sorted = true;
+            auto merged = merged_function_body_extents.begin();
+            for (auto const& f : merged_function_body_extents)
+            {
+                if (
+                    merged != merged_function_body_extents.begin()
+                    && f.first <= std::prev(merged)->last
+                    )
+                {
+                    std::prev(merged)->last = std::max(std::prev(merged)->last, f.last);
+                }
+                else {
+                    *merged++ = f;
+                }
+            }
+            merged_function_body_extents.erase(merged, merged_function_body_extents.end());
+            is_merged_function_body_extents_current = true;
         }
 
-        //  Find the first entry that is beyond pos, and back up one to
-        //  the last that could be a match; this also ensures iter is
-        //  dereferenceable, not .end()
+        //  Find the first extent that starts beyond pos, and check
+        //  whether the one before it (if any) includes pos
         auto iter = std::lower_bound(
-            function_body_extents.begin(),
-            function_body_extents.end(),
+            merged_function_body_extents.begin(),
+            merged_function_body_extents.end(),
             p.lineno+1
         );
-        if (iter != function_body_extents.begin()) {
-            --iter;
-        }
-
-        //  Now go backwards through the preceding entries until
-        //  one includes pos or we move before pos
-        while (
-            iter->first <= p.lineno
-            )
-        {
-            if (
-                iter->first <= p.lineno
-                && p.lineno <= iter->last
-                )
-            {
-                return true;
-            }
-            if (iter == function_body_extents.begin()) {
-                break;
-            }
-            --iter;
-        }
-        return false;
+        return
+            iter != merged_function_body_extents.begin()
+            && p.lineno <= std::prev(iter)->last
+            ;
     }
 
 
@@ -6626,15 +7072,17 @@ public:
     //  sections in a TU to build the whole TU's parse tree
     //
     auto parse(
-        std::vector<token> const&  tokens_,
-        stable_vector<token>&      generated_tokens_
+        std::span<token const>  tokens_,
+        stable_vector<token>&   generated_tokens_
     )
         -> bool
     {
+        auto trace = trace_scope("parser::parse", {}, tokens_.empty() ? -1 : tokens_.front().position().lineno);
+
         parse_kind = "source file";
 
         //  Set per-parse state for the duration of this call
-        tokens           = &tokens_;
+        tokens           = tokens_;
         generated_tokens = &generated_tokens_;
 
         //  Generate parse tree for this section as if a standalone TU
@@ -6655,6 +7103,31 @@ public:
     }
 
 
+    //-----------------------------------------------------------------------
+    //  append: Move another parser's parse tree onto the end of this one's
+    //
+    //  that    a parser that parsed later sections of the same source
+    //          (e.g., on another thread)
+    //
+    auto append(parser& that)
+        -> void
+    {
+        parse_tree->declarations.insert(
+            parse_tree->declarations.end(),
+            std::make_move_iterator(that.parse_tree->declarations.begin()),
+            std::make_move_iterator(that.parse_tree->declarations.end())
+        );
+        that.parse_tree->declarations.clear();
+
+        function_body_extents.insert(
+            function_body_extents.end(),
+            that.function_body_extents.begin(),
+            that.function_body_extents.end()
+        );
+        is_merged_function_body_extents_current = false;
+    }
+
+
     //-----------------------------------------------------------------------
     //  parse_one_declaration
     //
@@ -6664,15 +7137,15 @@ public:
     //  Each call parses one statement and returns its parse tree.
     //
     auto parse_one_declaration(
-        std::vector<token> const& tokens_,
-        stable_vector<token>&     generated_tokens_
+        std::span<token const> tokens_,
+        stable_vector<token>&  generated_tokens_
     )
         -> std::unique_ptr<statement_node>
     {
         parse_kind = "source string during code generation";
 
         //  Set per-parse state for the duration of this call
-        tokens           = &tokens_;
+        tokens           = tokens_;
         generated_tokens = &generated_tokens_;
 
         try {
@@ -6700,29 +7173,142 @@ public:
 
 
     //-----------------------------------------------------------------------
-    //  Get a set of pointers to just the declarations in the given token map section
+    //  defer_function_bodies
     //
-    auto get_parse_tree_declarations_in_range(std::vector<token> const& token_range) const
-        -> std::vector< declaration_node const* >
-    {
+    //  From now on, skip over the { } bodies of named namespace-scope
+    //  functions when parsing, so that each can be parsed just before it's
+    //  lowered with parse_deferred_body, and freed after that with
+    //  release_deferred_body -- except for bodies that use metafunctions
+    //  (e.g., on a local type), which need to be applied while parsing
+    //
+    auto defer_function_bodies()
+        -> void
+    {
+        deferring_function_bodies = true;
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  parse_deferred_body
+    //
+    //  n                   a function whose body was skipped when parsing
+    //  generated_tokens    a shared place to store generated tokens
+    //
+    //  Parses n's body into n, as parsing n would have
+    //
+    //  Returns:    false, having reported errors and leaving the body
+    //              unparsed, if the body is not valid
+    //
+    auto parse_deferred_body(
+        declaration_node const& n,
+        stable_vector<token>&   generated_tokens_
+    )
+        -> bool
+    {
+        assert(
+            n.has_unparsed_body()
+            && n.initializer
+            && n.initializer->is_compound()
+        );
+        auto& deferred = *n.deferred_body;
+        auto& body     = std::get<statement_node::compound>(n.initializer->statement);
+
+        parse_kind = "source file";
+
+        //  Set per-parse state for the duration of this call
+        tokens           = deferred.tokens;
+        generated_tokens = &generated_tokens_;
+        pos              = deferred.open_brace;
+
+        //  Function bodies nested in this one are within its extent,
+        //  which was already recorded, so don't record them again
+        auto const extents_count = std::ssize(function_body_extents);
+        auto placeholder         = std::move(body);
+        auto guard = finally([&]{
+            function_body_extents.erase(
+                function_body_extents.begin() + extents_count,
+                function_body_extents.end()
+            );
+            if (!deferred.is_parsed) {
+                body = std::move(placeholder);
+            }
+        });
+        auto guard2 = current_declarations_stack_guard(this, deferred.decl);
+
+        if (!compound_statement(body, n.equal_sign)) {
+            return false;
+        }
+        add_implicit_return(*deferred.decl);
+        deferred.is_parsed = true;
+        return true;
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  release_deferred_body
+    //
+    //  n       a function whose body was parsed by parse_deferred_body
+    //
+    //  Frees n's body, leaving it as it was before it was parsed
+    //
+    auto release_deferred_body(declaration_node const& n)
+        -> void
+    {
+        assert(
+            n.deferred_body
+            && n.deferred_body->is_parsed
+        );
+        auto& body = std::get<statement_node::compound>(n.initializer->statement);
+
+        auto placeholder = std::make_unique<compound_statement_node>();
+        placeholder->open_brace  = body->open_brace;
+        placeholder->close_brace = body->close_brace;
+        placeholder->body_indent = body->body_indent;
+
+        body = std::move(placeholder);
+        n.deferred_body->is_parsed = false;
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  Get a set of pointers to just the declarations in each of the given
+    //  token sections (in source order), in one pass over the declarations
+    //
+    auto get_parse_tree_declarations_in_sections(std::span<token_section const> sections) const
+        -> std::vector< std::vector< declaration_node const* > >
+    {
         assert (parse_tree);
-        assert (!token_range.empty());
-        auto first_line = token_range.front().position().lineno;
-        auto last_line  = token_range.back().position().lineno;
+        auto ret = std::vector< std::vector< declaration_node const* > >(sections.size());
+
+        //  A declaration belongs to the section whose lines it starts in, as
+        //  long as no earlier declaration starts after that section's last
+        //  line (the grammar and the tokens are in lineno order, so that only
+        //  happens for generated declarations, which we don't emit here)
+        auto last_line_of = [](token_section const& section) {
+            assert (!section.tokens.empty());
+            return section.tokens.back().position().lineno;
+        };
+        auto max_line_so_far = std::numeric_limits<lineno_t>::min();
 
-        auto ret = std::vector< declaration_node const* >{};
         for (auto& decl : parse_tree->declarations)
         {
             assert(decl);
+            auto lineno = decl->position().lineno;
 
-            //  The grammar and the tokens are in lineno order, so we don't
-            //  need to look further once we pass the last lineno
-            if (decl->position().lineno > last_line) {
-                break;
-            }
-            if (decl->position().lineno >= first_line) {
-                ret.push_back( decl.get() );
+            auto section = std::ranges::partition_point(
+                sections,
+                [&](auto const& s) { return last_line_of(s) < lineno; }
+            );
+            if (
+                section != sections.end()
+                && section->tokens.front().position().lineno <= lineno
+                && max_line_so_far <= last_line_of(*section)
+                )
+            {
+                ret[section - sections.begin()].push_back( decl.get() );
             }
+
+            max_line_so_far = std::max(max_line_so_far, lineno);
         }
 
         return ret;
@@ -6800,19 +7386,18 @@ private:
             throw std::runtime_error("unexpected end of " + parse_kind);
         }
 
-        return (*tokens)[pos];
+        return tokens[pos];
     }
 
     auto peek(int num) const
         -> token const*
     {
-        assert (tokens);
         if (
             pos + num >= 0
-            && pos + num < std::ssize(*tokens)
+            && pos + num < std::ssize(tokens)
             )
         {
-            return &(*tokens)[pos + num];
+            return &tokens[pos + num];
         }
         return {};
     }
@@ -6820,16 +7405,14 @@ private:
     auto done() const
         -> bool
     {
-        assert (tokens);
-        assert (pos <= std::ssize(*tokens));
-        return pos == std::ssize(*tokens);
+        assert (pos <= std::ssize(tokens));
+        return pos == std::ssize(tokens);
     }
 
     auto next(int num = 1)
         -> void
     {
-        assert (tokens);
-        pos = std::min( pos+num, _as<int>(std::ssize(*tokens)) );
+        pos = std::min( pos+num, _as<int>(std::ssize(tokens)) );
     }
 
 
@@ -7170,355 +7753,310 @@ private:
     //-----------------------------------------------------------------------
     //  Parsers for binary expressions
     //
+    //  The binary-expression grammar below has a production for each
+    //  precedence level, each made of the one below. Rather than recursing
+    //  through every level for every operand, binary_expression reads all
+    //  the levels in one loop, and flat_binary_expression builds the nodes
+    //  for the levels from the operands and operators it found
+    //
 
-    //  The general /*binary*/-expression:
-    //     /*term*/-expression { { /* operators at this precedence level */ } /*term*/-expression }*
+    //  If the next token(s) are an operator at precedence level 'level',
+    //  move past them
     //
-    template<
-        typename Binary,
-        typename ValidateOp,
-        typename TermFunc
-    >
-    auto binary_expression(
-        ValidateOp validate_op,
-        TermFunc   term
+    //  Returns:    the operator, which may be a token synthesized from
+    //              '> >', '> =', or '> > =', or null if there isn't one
+    //
+    auto binary_operator(
+        int  level,
+        bool allow_angle_operators,
+        bool allow_equality
     )
-        -> std::unique_ptr<Binary>
+        -> token const*
     {
-        auto n = std::make_unique<Binary>();
-        if ( (n->expr = term()) )
+        auto is_any_of = [&](auto... types) {
+            return ((curr().type() == types) || ...);
+        };
+        auto op = static_cast<token const*>(nullptr);
+
+        switch (level)
         {
-            while (!done())
+        //G multiplicative-expression:
+        //G     is-as-expression
+        //G     multiplicative-expression '*' is-as-expression
+        //G     multiplicative-expression '/' is-as-expression
+        //G     multiplicative-expression '%' is-as-expression
+        //G
+        break;case multiplicative_expression_node::level:
+            if (is_any_of(lexeme::Multiply, lexeme::Slash, lexeme::Modulo)) {
+                op = &curr();
+            }
+
+        //G additive-expression:
+        //G     multiplicative-expression
+        //G     additive-expression '+' multiplicative-expression
+        //G     additive-expression '-' multiplicative-expression
+        //G
+        break;case additive_expression_node::level:
+            if (is_any_of(lexeme::Plus, lexeme::Minus)) {
+                op = &curr();
+            }
+
+        //G shift-expression:
+        //G     additive-expression
+        //G     shift-expression '<<' additive-expression
+        //G     shift-expression '>>' additive-expression
+        //G
+        //  We may synthesize >> from > >
+        break;case shift_expression_node::level:
+            if (
+                !peek(1)
+                || !allow_angle_operators
+                )
             {
-                typename Binary::term t{};
-
-                //  Remember current position, because we may need to backtrack if this next
-                //  t.op might be valid but isn't followed by a valid term and so isn't for us
-                auto term_pos = pos;
-
-                //  Most of these predicates only look at the current token and return
-                //  true/false == whether this is a valid operator for this production
-                if constexpr( requires{ bool{ validate_op(curr()) }; } ) {
-                    if (!validate_op(curr())) {
-                        break;
-                    }
-                    t.op = &curr();
-                    next();
-                }
-
-                //  But for shift-expression we may synthesize >> from > >
-                //  which will return a token* == a valid operator for this production
-                //  (possibly a synthesized new token) or nullptr otherwise
-                else if constexpr( requires{ validate_op(curr(), *peek(1)); } ) {
-                    if (
-                        peek(1) == nullptr
-                        || (t.op = validate_op(curr(), *peek(1))) == nullptr
-                    )
-                    {
-                        break;
-                    }
-                    //  If we didn't consume the next token, we consumed the next two
-                    if (t.op != &curr()) {
-                        next();
-                    }
-                    next();
-                }
-
-                //  And for assignment-expression we may synthesize >>= from > > =
-                //  which will return a token* == a valid operator for this production
-                //  (possibly a synthesized new token) or nullptr otherwise
-                else if constexpr (requires{ validate_op(curr(), *peek(1), *peek(2)); }) {
-                    if (
-                        peek(1) == nullptr
-                        || peek(2) == nullptr
-                        || (t.op = validate_op(curr(), *peek(1), *peek(2))) == nullptr
-                        )
-                    {
-                        break;
-                    }
-                    //  If we didn't consume the next token, we consumed the next three
-                    if (t.op != &curr()) {
-                        next();
-                        next();
-                    }
-                    next();
-                }
-
-                //  And it shouldn't be anything else
-                else {
-                    assert (false && "ICE: validate_op should take one token and return bool, or two tokens and return token const* ");
-                }
-
-                //  At this point we may have a valid t.op, so try to parse the next term...
-                //  If it's not a valid term, then this t.op wasn't for us, pop it and return
-                //  what we found (e.g., with "requires expression = {...}" the = is a grammar
-                //  element and not an operator, it isn't and can't be part of the expression)
-                if ( !(t.expr = term()) ) {
-                    pos = term_pos;    // backtrack
-                    return n;
-                }
-
-                //  We got a term, so this op + term was for us
-                n->terms.push_back( std::move(t) );
+                break;
+            }
+            if (curr().type() == lexeme::LeftShift) {
+                op = &curr();
+            }
+            else if (
+                curr().type() == lexeme::Greater
+                && peek(1)->type() == lexeme::Greater
+                && curr().position() == source_position{ peek(1)->position().lineno, peek(1)->position().colno-1 }
+                )
+            {
+                generated_tokens->emplace_back( ">>", curr().position(), lexeme::RightShift);
+                op = &generated_tokens->back();
+                next();
             }
-            return n;
-        }
-        return {};
-    }
 
-    //G multiplicative-expression:
-    //G     is-as-expression
-    //G     multiplicative-expression '*' is-as-expression
-    //G     multiplicative-expression '/' is-as-expression
-    //G     multiplicative-expression '%' is-as-expression
-    //G
-    auto multiplicative_expression()
-        -> auto
-    {
-        return binary_expression<multiplicative_expression_node> (
-            [](token const& t){ return t.type() == lexeme::Multiply || t.type() == lexeme::Slash || t.type() == lexeme::Modulo; },
-            [this]{ return is_as_expression(); }
-            );
-    }
+        //G compare-expression:
+        //G     shift-expression
+        //G     compare-expression '<=>' shift-expression
+        //G
+        break;case compare_expression_node::level:
+            if (curr().type() == lexeme::Spaceship) {
+                op = &curr();
+            }
+
+        //G relational-expression:
+        //G     compare-expression
+        //G     relational-expression '<'  compare-expression
+        //G     relational-expression '>'  compare-expression
+        //G     relational-expression '<=' compare-expression
+        //G     relational-expression '>=' compare-expression
+        //G
+        //  We may synthesize >= from > =
+        break;case relational_expression_node::level:
+            if (
+                !peek(1)
+                || !allow_angle_operators
+                )
+            {
+                break;
+            }
+            if (
+                curr().type() == lexeme::Greater
+                && peek(1)->type() == lexeme::Assignment
+                && curr().position() == source_position{ peek(1)->position().lineno, peek(1)->position().colno - 1 }
+                )
+            {
+                generated_tokens->emplace_back(">=", curr().position(), lexeme::GreaterEq);
+                op = &generated_tokens->back();
+                next();
+            }
+            else if (is_any_of(lexeme::Less, lexeme::LessEq, lexeme::Greater)) {
+                op = &curr();
+            }
 
-    //G additive-expression:
-    //G     multiplicative-expression
-    //G     additive-expression '+' multiplicative-expression
-    //G     additive-expression '-' multiplicative-expression
-    //G
-    auto additive_expression()
-        -> auto
-    {
-        return binary_expression<additive_expression_node> (
-            [](token const& t){ return t.type() == lexeme::Plus || t.type() == lexeme::Minus; },
-            [this]{ return multiplicative_expression(); }
-        );
-    }
+        //G equality-expression:
+        //G     relational-expression
+        //G     equality-expression '==' relational-expression
+        //G     equality-expression '!=' relational-expression
+        //G
+        break;case equality_expression_node::level:
+            if (
+                (allow_equality && curr().type() == lexeme::EqualComparison)
+                || curr().type() == lexeme::NotEqualComparison
+                )
+            {
+                op = &curr();
+            }
+
+        //G bit-and-expression:
+        //G     equality-expression
+        //G     bit-and-expression '&' equality-expression
+        //G
+        break;case bit_and_expression_node::level:
+            if (curr().type() == lexeme::Ampersand) {
+                op = &curr();
+            }
+
+        //G bit-xor-expression:
+        //G     bit-and-expression
+        //G     bit-xor-expression '^' bit-and-expression
+        //G
+        break;case bit_xor_expression_node::level:
+            if (curr().type() == lexeme::Caret) {
+                op = &curr();
+            }
+
+        //G bit-or-expression:
+        //G     bit-xor-expression
+        //G     bit-or-expression '|' bit-xor-expression
+        //G
+        break;case bit_or_expression_node::level:
+            if (curr().type() == lexeme::Pipe) {
+                op = &curr();
+            }
+
+        //G logical-and-expression:
+        //G     bit-or-expression
+        //G     logical-and-expression '&&' bit-or-expression
+        //G
+        break;case logical_and_expression_node::level:
+            if (curr().type() == lexeme::LogicalAnd) {
+                op = &curr();
+            }
+
+        //  constant-expression:    // don't need intermediate production, just use:
+        //  conditional-expression: // don't need intermediate production, just use:
+        //G logical-or-expression:
+        //G     logical-and-expression
+        //G     logical-or-expression '||' logical-and-expression
+        //G
+        break;case logical_or_expression_node::level:
+            if (curr().type() == lexeme::LogicalOr) {
+                op = &curr();
+            }
+
+        //G assignment-expression:
+        //G     logical-or-expression
+        //G     assignment-expression assignment-operator logical-or-expression
+        //G
+        //  We may synthesize >>= from > > =
+        break;case assignment_expression_node::level:
+            if (
+                !peek(1)
+                || !peek(2)
+                || !allow_angle_operators
+                )
+            {
+                break;
+            }
+            if (is_assignment_operator(curr().type())) {
+                op = &curr();
+            }
+            else if (
+                curr().type() == lexeme::Greater
+                && peek(1)->type() == lexeme::Greater
+                && peek(2)->type() == lexeme::Assignment
+                && curr().position() == source_position{ peek(1)->position().lineno, peek(1)->position().colno-1 }
+                )
+            {
+                generated_tokens->emplace_back( ">>=", curr().position(), lexeme::RightShiftEq);
+                op = &generated_tokens->back();
+                next();
+                next();
+            }
 
-    //G shift-expression:
-    //G     additive-expression
-    //G     shift-expression '<<' additive-expression
-    //G     shift-expression '>>' additive-expression
-    //G
-    auto shift_expression(bool allow_angle_operators = true)
-        -> auto
-    {
-        if (allow_angle_operators) {
-            return binary_expression<shift_expression_node> (
-                [this](token const& t, token const& next) -> token const* {
-                    if (t.type() == lexeme::LeftShift) {
-                        return &t;
-                    }
-                    if (
-                        t.type() == lexeme::Greater
-                        && next.type() == lexeme::Greater
-                        && t.position() == source_position{ next.position().lineno, next.position().colno-1 }
-                        )
-                    {
-                        generated_tokens->emplace_back( ">>", t.position(), lexeme::RightShift);
-                        return &generated_tokens->back();
-                    }
-                    return nullptr;
-                },
-                [this]{ return additive_expression(); }
-            );
+        break;default:
+            assert (false && "ICE: not a binary expression precedence level");
         }
-        else {
-            return binary_expression<shift_expression_node> (
-                [](token const&, token const&) -> token const* { return nullptr; },
-                [this]{ return additive_expression(); }
-            );
+
+        if (op) {
+            next();
         }
+        return op;
     }
 
-    //G compare-expression:
-    //G     shift-expression
-    //G     compare-expression '<=>' shift-expression
-    //G
-    auto compare_expression(bool allow_angle_operators = true)
-        -> auto
+    //  Parse a binary expression whose top level is Root's
+    //
+    //  Each operator is found at the same level, after the same attempts
+    //  at other levels, as a recursive descent through the levels would:
+    //  after an operand, each level from the tightest-binding out gets a
+    //  chance at the next token(s)
+    //
+    template<typename Root>
+    auto binary_expression(
+        bool allow_angle_operators,
+        bool allow_equality
+    )
+        -> std::unique_ptr<Root>
     {
-        return binary_expression<compare_expression_node> (
-            [](token const& t){ return t.type() == lexeme::Spaceship; },
-            [=,this]{ return shift_expression(allow_angle_operators); }
-        );
-    }
+        auto first_operand  = std::ssize(binary_operands);
+        auto first_operator = std::ssize(binary_operators);
+        auto guard = finally([&]{
+            binary_operands .resize(unchecked_narrow<std::size_t>(first_operand));
+            binary_operators.resize(unchecked_narrow<std::size_t>(first_operator));
+        });
 
-    //G relational-expression:
-    //G     compare-expression
-    //G     relational-expression '<'  compare-expression
-    //G     relational-expression '>'  compare-expression
-    //G     relational-expression '<=' compare-expression
-    //G     relational-expression '>=' compare-expression
-    //G
-    auto relational_expression(bool allow_angle_operators = true)
-        -> auto
-    {
-        if (allow_angle_operators) {
-            return binary_expression<relational_expression_node> (
-                [this](token const& t, token const& next) -> token const* {
-                    if (
-                        t.type() == lexeme::Greater
-                        && next.type() == lexeme::Assignment
-                        && t.position() == source_position{ next.position().lineno, next.position().colno - 1 }
-                        )
-                    {
-                        generated_tokens->emplace_back(">=", t.position(), lexeme::GreaterEq);
-                        return &generated_tokens->back();
-                    }
-                    if (
-                        t.type() == lexeme::Less
-                        || t.type() == lexeme::LessEq
-                        || t.type() == lexeme::Greater
-                        ) {
-                        return &t;
-                    }
-                    return nullptr;
-                },
-                [=,this]{ return compare_expression(allow_angle_operators); }
-            );
+        auto my_expression = static_cast<expression_node const*>(nullptr);
+        if (!expression_node::current_expressions.empty()) {
+            my_expression = expression_node::current_expressions.back();
         }
-        else {
-            return binary_expression<relational_expression_node> (
-                [](token const&, token const&) -> token const* { return nullptr; },
-                [=,this]{ return compare_expression(allow_angle_operators); }
-            );
-        }
-    }
 
-    //G equality-expression:
-    //G     relational-expression
-    //G     equality-expression '==' relational-expression
-    //G     equality-expression '!=' relational-expression
-    //G
-    auto equality_expression(bool allow_angle_operators = true, bool allow_equality = true)
-        -> auto
-    {
-        if (allow_equality) {
-            return binary_expression<equality_expression_node> (
-                [](token const& t){ return t.type() == lexeme::EqualComparison || t.type() == lexeme::NotEqualComparison; },
-                [=,this]{ return relational_expression(allow_angle_operators); }
-            );
-        }
-        else {
-            return binary_expression<equality_expression_node> (
-                [](token const& t){ return t.type() == lexeme::NotEqualComparison; },
-                [=,this]{ return relational_expression(allow_angle_operators); }
-            );
+        auto operand = is_as_expression();
+        if (!operand) {
+            return {};
         }
-    }
+        binary_operands.push_back( std::move(operand) );
 
-    //G bit-and-expression:
-    //G     equality-expression
-    //G     bit-and-expression '&' equality-expression
-    //G
-    auto bit_and_expression(bool allow_angle_operators = true, bool allow_equality = true)
-        -> auto
-    {
-        return binary_expression<bit_and_expression_node> (
-            [](token const& t){ return t.type() == lexeme::Ampersand; },
-            [=,this]{ return equality_expression(allow_angle_operators, allow_equality); }
-        );
-    }
+        for (auto found = true; found; )
+        {
+            found = false;
+            for (
+                auto level = 0;
+                level <= Root::level && !done();
+                ++level
+                )
+            {
+                //  Remember current position, because we may need to backtrack if this next
+                //  op might be valid but isn't followed by a valid operand and so isn't for us
+                auto term_pos = pos;
 
-    //G bit-xor-expression:
-    //G     bit-and-expression
-    //G     bit-xor-expression '^' bit-and-expression
-    //G
-    auto bit_xor_expression(bool allow_angle_operators = true, bool allow_equality = true)
-        -> auto
-    {
-        return binary_expression<bit_xor_expression_node> (
-            [](token const& t){ return t.type() == lexeme::Caret; },
-            [=,this]{ return bit_and_expression(allow_angle_operators, allow_equality); }
-        );
-    }
+                auto op = binary_operator(level, allow_angle_operators, allow_equality);
+                if (!op) {
+                    continue;
+                }
 
-    //G bit-or-expression:
-    //G     bit-xor-expression
-    //G     bit-or-expression '|' bit-xor-expression
-    //G
-    auto bit_or_expression(bool allow_angle_operators = true, bool allow_equality = true)
-        -> auto
-    {
-        return binary_expression<bit_or_expression_node> (
-            [](token const& t){ return t.type() == lexeme::Pipe; },
-            [=,this]{ return bit_xor_expression(allow_angle_operators, allow_equality); }
-        );
-    }
+                //  If it's not followed by a valid operand, then this op wasn't for this
+                //  level, so backtrack and let the next level out try (e.g., with
+                //  "requires expression = {...}" the = is a grammar element and not an
+                //  operator, it isn't and can't be part of the expression)
+                if ( !(operand = is_as_expression()) ) {
+                    pos = term_pos;
+                    continue;
+                }
 
-    //G logical-and-expression:
-    //G     bit-or-expression
-    //G     logical-and-expression '&&' bit-or-expression
-    //G
-    auto logical_and_expression(bool allow_angle_operators = true, bool allow_equality = true)
-        -> auto
-    {
-        return binary_expression<logical_and_expression_node> (
-            [](token const& t){ return t.type() == lexeme::LogicalAnd; },
-            [=,this]{ return bit_or_expression(allow_angle_operators, allow_equality); }
+                binary_operators.push_back({ op, level });
+                binary_operands.push_back( std::move(operand) );
+                found = true;
+                break;
+            }
+        }
+
+        return flat_binary_expression::make<Root>(
+            std::span{ binary_operands }.subspan(unchecked_narrow<std::size_t>(first_operand)),
+            std::span{ binary_operators }.subspan(unchecked_narrow<std::size_t>(first_operator)),
+            my_expression
         );
     }
 
-    //  constant-expression:    // don't need intermediate production, just use:
-    //  conditional-expression: // don't need intermediate production, just use:
-    //G logical-or-expression:
-    //G     logical-and-expression
-    //G     logical-or-expression '||' logical-and-expression
-    //G
-    auto logical_or_expression(bool allow_angle_operators = true, bool allow_equality = true)
-        -> auto
+    auto logical_or_expression(
+        bool allow_angle_operators = true,
+        bool allow_equality        = true
+    )
+        -> std::unique_ptr<logical_or_expression_node>
     {
-        return binary_expression<logical_or_expression_node> (
-            [](token const& t){ return t.type() == lexeme::LogicalOr; },
-            [=,this]{ return logical_and_expression(allow_angle_operators, allow_equality); }
-        );
+        return binary_expression<logical_or_expression_node>(allow_angle_operators, allow_equality);
     }
 
-    //G assignment-expression:
-    //G     logical-or-expression
-    //G     assignment-expression assignment-operator logical-or-expression
-    //G
     auto assignment_expression(
         bool allow_angle_operators = true
     )
         -> std::unique_ptr<assignment_expression_node>
     {
-        auto ret = std::unique_ptr<assignment_expression_node>{};
-
-        if (allow_angle_operators)
-        {
-            ret = binary_expression<assignment_expression_node> (
-                [this](token const& t, token const& next, token const& third) -> token const* {
-                    if (is_assignment_operator(t.type())) {
-                        return &t;
-                    }
-                    if (
-                        t.type() == lexeme::Greater
-                        && next.type() == lexeme::Greater
-                        && third.type() == lexeme::Assignment
-                        && t.position() == source_position{ next.position().lineno, next.position().colno-1 }
-                        )
-                    {
-                        generated_tokens->emplace_back( ">>=", t.position(), lexeme::RightShiftEq);
-                        return &generated_tokens->back();
-                    }
-                    return nullptr;
-                },
-                [=,this]{
-                    return logical_or_expression(allow_angle_operators);
-                }
-            );
-        }
-        else
-        {
-            ret = binary_expression<assignment_expression_node> (
-                [](token const&, token const&) -> token const* { return nullptr; },
-                [=,this]{
-                    return logical_or_expression(allow_angle_operators);
-                }
-            );
-        }
+        auto ret = binary_expression<assignment_expression_node>(allow_angle_operators, true);
 
         if (ret && ret->terms_size() > 1) {
             error("assignment cannot be chained - instead of 'c = b = a;', write 'b = a; c = b;'", false);
@@ -9573,6 +10111,111 @@ private:
         -> bool;
 
 
+    //  If n is a function with a list of multiple/named return values, and
+    //  its body's end doesn't already have "return" as the last statement,
+    //  then generate "return;" as the last statement
+    //
+    auto add_implicit_return( declaration_node& n )
+        -> void
+    {
+        auto func = std::get_if<declaration_node::a_function>(&n.type);
+        if (
+            !func
+            || (*func)->returns.index() != function_type_node::list
+            )
+        {
+            return;
+        }
+
+        assert (n.initializer && n.initializer->is_compound());
+        auto& body = std::get<statement_node::compound>(n.initializer->statement);
+
+        if (
+            body->statements.empty()
+            || !body->statements.back()->is_return()
+            )
+        {
+            auto last_pos = n.position();
+            if (!body->statements.empty()) {
+                last_pos = body->statements.back()->position();
+            }
+            ++last_pos.lineno;
+            generated_tokens->emplace_back( "return", last_pos, lexeme::Keyword);
+
+            auto ret = std::make_unique<return_statement_node>();
+            ret->identifier = &generated_tokens->back();
+
+            auto stmt = std::make_unique<statement_node>();
+            stmt->statement = std::move(ret);
+
+            body->statements.push_back(std::move(stmt));
+        }
+    }
+
+
+    //  When deferring function bodies, skip over n's body if it can be
+    //  parsed later by itself (see defer_function_bodies), leaving an empty
+    //  compound-statement with its braces in its place
+    //
+    //  Returns:    true if the body was skipped
+    //
+    auto defer_function_body( declaration_node& n )
+        -> bool
+    {
+        if (
+            !deferring_function_bodies
+            || !n.is_function()
+            || !n.identifier
+            || !n.parent_is_namespace()
+            || curr().type() != lexeme::LeftBrace
+            )
+        {
+            return false;
+        }
+
+        //  Find the matching '}', giving up if there's a metafunction
+        auto close = pos;
+        for (auto depth = 0; close < std::ssize(tokens); ++close)
+        {
+            auto type = tokens[close].type();
+            if (type == lexeme::At) {
+                return false;
+            }
+            if (type == lexeme::LeftBrace) {
+                ++depth;
+            }
+            else if (
+                type == lexeme::RightBrace
+                && --depth == 0
+                )
+            {
+                break;
+            }
+        }
+        if (close == std::ssize(tokens)) {
+            return false;
+        }
+
+        //  Remember the braces as compound_statement would
+        auto body = std::make_unique<compound_statement_node>();
+        body->body_indent = tokens[pos+1].position().colno-1;
+        if (n.equal_sign.lineno == curr().position().lineno) {
+            body->open_brace = n.equal_sign;
+        }
+        else {
+            body->open_brace = curr().position();
+        }
+        body->close_brace = tokens[close].position();
+
+        n.initializer = std::make_unique<statement_node>();
+        n.initializer->statement = std::move(body);
+        n.deferred_body = std::make_unique<declaration_node::deferred_body_tokens>( &n, tokens, pos );
+
+        pos = close + 1;
+        return true;
+    }
+
+
     //G unnamed-declaration:
     //G     ':' meta-functions? template-parameters? function-type requires-clause? '=' statement
     //G     ':' meta-functions? template-parameters? function-type statement
@@ -9996,14 +10639,16 @@ private:
                     }
                 }
 
-                statement(
-                    n->initializer,
-                    semicolon_required,
-                    n->equal_sign,
-                    false,
-                    nullptr,
-                    !is_template_parameter
-                );
+                if (!defer_function_body(*n)) {
+                    statement(
+                        n->initializer,
+                        semicolon_required,
+                        n->equal_sign,
+                        false,
+                        nullptr,
+                        !is_template_parameter
+                    );
+                }
                 if (!n->initializer)
                 {
                     error(
@@ -10127,27 +10772,9 @@ private:
                 return {};
             }
 
-            auto& body = std::get<statement_node::compound>(n->initializer->statement);
-
-            if (
-                body->statements.empty()
-                || !body->statements.back()->is_return()
-                )
-            {
-                auto last_pos = n->position();
-                if (!body->statements.empty()) {
-                    last_pos = body->statements.back()->position();
-                }
-                ++last_pos.lineno;
-                generated_tokens->emplace_back( "return", last_pos, lexeme::Keyword);
-
-                auto ret = std::make_unique<return_statement_node>();
-                ret->identifier = &generated_tokens->back();
-
-                auto stmt = std::make_unique<statement_node>();
-                stmt->statement = std::move(ret);
-
-                body->statements.push_back(std::move(stmt));
+            //  A deferred body gets it when it's parsed
+            if (!n->deferred_body) {
+                add_implicit_return(*n);
             }
         }
 
@@ -10157,6 +10784,7 @@ private:
                 n->equal_sign.lineno,
                 peek(-1)->position().lineno
             );
+            is_merged_function_body_extents_current = false;
         }
 
         return n;
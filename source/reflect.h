@@ -21,199 +21,199 @@ namespace meta {
 #line 29 "reflect.h2"
 class compiler_services;
 
-#line 212 "reflect.h2"
+#line 223 "reflect.h2"
 template<typename T> class reflection_base;
 
-#line 248 "reflect.h2"
+#line 259 "reflect.h2"
 class declaration;
 
-#line 333 "reflect.h2"
+#line 348 "reflect.h2"
 class function_declaration;
 
-#line 438 "reflect.h2"
+#line 453 "reflect.h2"
 class object_declaration;
 
-#line 474 "reflect.h2"
+#line 489 "reflect.h2"
 class type_or_namespace_declaration;
 
-#line 585 "reflect.h2"
+#line 600 "reflect.h2"
 class type_declaration;
 
-#line 629 "reflect.h2"
+#line 644 "reflect.h2"
 class namespace_declaration;
 
-#line 648 "reflect.h2"
+#line 663 "reflect.h2"
 class alias_declaration;
 
-#line 667 "reflect.h2"
+#line 682 "reflect.h2"
 class parameter_declaration;
 
-#line 713 "reflect.h2"
+#line 728 "reflect.h2"
 template<String Name, typename Term> class binary_expression;
 
-#line 840 "reflect.h2"
+#line 855 "reflect.h2"
 class expression_list;
 
-#line 873 "reflect.h2"
+#line 888 "reflect.h2"
 class prefix_expression;
 
-#line 915 "reflect.h2"
+#line 930 "reflect.h2"
 class postfix_expression;
 
-#line 986 "reflect.h2"
+#line 1001 "reflect.h2"
 class template_arg;
 
-#line 1012 "reflect.h2"
+#line 1027 "reflect.h2"
 class unqualified_id;
 
-#line 1044 "reflect.h2"
+#line 1059 "reflect.h2"
 class qualified_id;
 
-#line 1088 "reflect.h2"
+#line 1103 "reflect.h2"
 class type_id;
 
-#line 1131 "reflect.h2"
+#line 1146 "reflect.h2"
 class primary_expression;
 
-#line 1170 "reflect.h2"
+#line 1185 "reflect.h2"
 class id_expression;
 
-#line 1206 "reflect.h2"
+#line 1221 "reflect.h2"
 class expression;
 
-#line 1257 "reflect.h2"
+#line 1272 "reflect.h2"
 class is_as_expression;
 
-#line 1318 "reflect.h2"
+#line 1333 "reflect.h2"
 class statement;
 
-#line 1370 "reflect.h2"
+#line 1385 "reflect.h2"
 class expression_statement;
 
-#line 1392 "reflect.h2"
+#line 1407 "reflect.h2"
 class compound_statement;
 
-#line 1431 "reflect.h2"
+#line 1446 "reflect.h2"
 class selection_statement;
 
-#line 1457 "reflect.h2"
+#line 1472 "reflect.h2"
 class return_statement;
 
-#line 1479 "reflect.h2"
+#line 1494 "reflect.h2"
 class iteration_statement;
 
-#line 1976 "reflect.h2"
+#line 1991 "reflect.h2"
 class value_member_info;
 
-#line 2619 "reflect.h2"
+#line 2634 "reflect.h2"
 class simple_traverser;
 
-#line 4111 "reflect.h2"
+#line 4126 "reflect.h2"
 class autodiff_special_func;
 
-#line 4155 "reflect.h2"
+#line 4170 "reflect.h2"
 class autodiff_declared_variable;
 
-#line 4173 "reflect.h2"
+#line 4188 "reflect.h2"
 class autodiff_declaration_stack_item;
 
-#line 4217 "reflect.h2"
+#line 4232 "reflect.h2"
 class autodiff_context;
     
 
-#line 4613 "reflect.h2"
+#line 4628 "reflect.h2"
 class autodiff_diff_code;
     
 
-#line 4662 "reflect.h2"
+#line 4677 "reflect.h2"
 class autodiff_activity_check;
     
 
-#line 4760 "reflect.h2"
+#line 4775 "reflect.h2"
 class autodiff_handler_base;
     
 
-#line 4778 "reflect.h2"
+#line 4793 "reflect.h2"
 class autodiff_expression_handler;
     
 
-#line 5421 "reflect.h2"
+#line 5436 "reflect.h2"
 class autodiff_stmt_handler;
 
-#line 5891 "reflect.h2"
+#line 5906 "reflect.h2"
 class autodiff_declaration_handler;
 
-#line 6243 "reflect.h2"
+#line 6258 "reflect.h2"
 class expression_flags;
 
-#line 6259 "reflect.h2"
+#line 6274 "reflect.h2"
 class regex_token;
 
-#line 6286 "reflect.h2"
+#line 6301 "reflect.h2"
 class regex_token_check;
 
-#line 6307 "reflect.h2"
+#line 6322 "reflect.h2"
 class regex_token_code;
 
-#line 6328 "reflect.h2"
+#line 6343 "reflect.h2"
 class regex_token_empty;
 
-#line 6346 "reflect.h2"
+#line 6361 "reflect.h2"
 class regex_token_list;
 
-#line 6398 "reflect.h2"
+#line 6413 "reflect.h2"
 class parse_context_group_state;
 
-#line 6459 "reflect.h2"
+#line 6474 "reflect.h2"
 class parse_context_branch_reset_state;
 
-#line 6502 "reflect.h2"
+#line 6517 "reflect.h2"
 class parse_context;
 
-#line 6903 "reflect.h2"
+#line 6918 "reflect.h2"
 class generation_function_context;
     
 
-#line 6921 "reflect.h2"
+#line 6936 "reflect.h2"
 class generation_context;
 
-#line 7120 "reflect.h2"
+#line 7135 "reflect.h2"
 class alternative_token;
 
-#line 7135 "reflect.h2"
+#line 7150 "reflect.h2"
 class alternative_token_gen;
 
-#line 7200 "reflect.h2"
+#line 7215 "reflect.h2"
 class any_token;
 
-#line 7217 "reflect.h2"
+#line 7232 "reflect.h2"
 class atomic_group_token;
 
-#line 7247 "reflect.h2"
+#line 7262 "reflect.h2"
 class char_token;
 
-#line 7362 "reflect.h2"
+#line 7377 "reflect.h2"
 class class_token;
 
-#line 7586 "reflect.h2"
+#line 7601 "reflect.h2"
 class group_ref_token;
 
-#line 7723 "reflect.h2"
+#line 7738 "reflect.h2"
 class group_token;
 
-#line 8070 "reflect.h2"
+#line 8085 "reflect.h2"
 class lookahead_lookbehind_token;
 
-#line 8165 "reflect.h2"
+#line 8180 "reflect.h2"
 class range_token;
 
-#line 8322 "reflect.h2"
+#line 8337 "reflect.h2"
 class special_range_token;
 
-#line 8408 "reflect.h2"
+#line 8423 "reflect.h2"
 template<typename Error_out> class regex_generator;
 
-#line 8671 "reflect.h2"
+#line 8688 "reflect.h2"
 }
 
 }
@@ -285,51 +285,57 @@ class compiler_services
 
 #line 92 "reflect.h2"
     public: [[nodiscard]] auto arguments_were_used() const& -> bool;
+
+#line 97 "reflect.h2"
+    protected: auto parse_deferred_body(
+
+        cpp2::impl::in<declaration_node> n
+    ) & -> void;
 using parse_statement_ret = std::unique_ptr<statement_node>;
 
 
-#line 94 "reflect.h2"
+#line 105 "reflect.h2"
     protected: [[nodiscard]] auto parse_statement(
 
         std::string_view source
     ) & -> parse_statement_ret;
 
-#line 147 "reflect.h2"
+#line 158 "reflect.h2"
     public: auto add_runtime_support_include(cpp2::impl::in<std::string_view> s, cpp2::impl::in<bool> angles = false) & -> void;
 
-#line 158 "reflect.h2"
+#line 169 "reflect.h2"
     public: [[nodiscard]] auto add_extra_cpp1_code(cpp2::impl::in<std::string> s) & -> decltype(auto);
     public: [[nodiscard]] auto add_extra_build_step(cpp2::impl::in<std::string> s) & -> decltype(auto);
 
     public: [[nodiscard]] virtual auto position() const -> source_position;
 
-#line 170 "reflect.h2"
+#line 181 "reflect.h2"
     public: auto require(
 
         cpp2::impl::in<bool> b, 
         cpp2::impl::in<std::string_view> msg
     ) const& -> void;
 
-#line 181 "reflect.h2"
+#line 192 "reflect.h2"
     public: auto error(cpp2::impl::in<std::string_view> msg) const& -> void;
 
-#line 193 "reflect.h2"
+#line 204 "reflect.h2"
     public: auto report_violation(auto const& msg) const& -> void;
 
-#line 201 "reflect.h2"
+#line 212 "reflect.h2"
     public: [[nodiscard]] auto is_active() const& -> decltype(auto);
     public: virtual ~compiler_services() noexcept;
 public: compiler_services(compiler_services const& that);
 public: compiler_services(compiler_services&& that) noexcept;
 
-#line 202 "reflect.h2"
+#line 213 "reflect.h2"
 };
 
-#line 212 "reflect.h2"
+#line 223 "reflect.h2"
 template<typename T> class reflection_base
 : public compiler_services {
 
-#line 216 "reflect.h2"
+#line 227 "reflect.h2"
     protected: T* n; 
 
     protected: reflection_base(
@@ -338,7 +344,7 @@ template<typename T> class reflection_base
         cpp2::impl::in<compiler_services> s
     );
 
-#line 229 "reflect.h2"
+#line 240 "reflect.h2"
     public: [[nodiscard]] auto position() const -> source_position override;
 
     public: [[nodiscard]] auto print() const& -> std::string;
@@ -349,21 +355,21 @@ template<typename T> class reflection_base
 public: reflection_base(reflection_base const& that);
 public: reflection_base(reflection_base&& that) noexcept;
 
-#line 235 "reflect.h2"
+#line 246 "reflect.h2"
 };
 
-#line 248 "reflect.h2"
+#line 259 "reflect.h2"
 class declaration
 : public reflection_base<declaration_node> {
 
-#line 252 "reflect.h2"
+#line 263 "reflect.h2"
     public: declaration(
 
         cpp2::impl::in<declaration_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 261 "reflect.h2"
+#line 276 "reflect.h2"
     public: [[nodiscard]] auto is_public() const& -> bool;
     public: [[nodiscard]] auto is_protected() const& -> bool;
     public: [[nodiscard]] auto is_private() const& -> bool;
@@ -382,7 +388,7 @@ class declaration
 
     public: [[nodiscard]] auto name() const& -> std::string_view;
 
-#line 282 "reflect.h2"
+#line 297 "reflect.h2"
     public: [[nodiscard]] auto has_initializer() const& -> bool;
 
     public: [[nodiscard]] auto get_initializer() const& -> statement;
@@ -428,21 +434,21 @@ public: declaration(declaration const& that);
 public: declaration(declaration&& that) noexcept;
 
 
-#line 327 "reflect.h2"
+#line 342 "reflect.h2"
 };
 
-#line 333 "reflect.h2"
+#line 348 "reflect.h2"
 class function_declaration
 : public declaration {
 
-#line 337 "reflect.h2"
+#line 352 "reflect.h2"
     public: function_declaration(
 
         cpp2::impl::in<declaration_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 347 "reflect.h2"
+#line 362 "reflect.h2"
     public: [[nodiscard]] auto index_of_parameter_named(cpp2::impl::in<std::string_view> s) const& -> int;
     public: [[nodiscard]] auto has_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool;
     public: [[nodiscard]] auto has_return_named(cpp2::impl::in<std::string_view> s) const& -> bool;
@@ -492,10 +498,10 @@ class function_declaration
 
     public: [[nodiscard]] auto get_parameters() const& -> std::vector<parameter_declaration>;
 
-#line 404 "reflect.h2"
+#line 419 "reflect.h2"
     public: [[nodiscard]] auto get_returns() const& -> std::vector<parameter_declaration>;
 
-#line 416 "reflect.h2"
+#line 431 "reflect.h2"
     public: [[nodiscard]] auto default_to_virtual() & -> decltype(auto);
 
     public: [[nodiscard]] auto make_virtual() & -> bool;
@@ -505,88 +511,88 @@ class function_declaration
 public: function_declaration(function_declaration&& that) noexcept;
 
 
-#line 432 "reflect.h2"
+#line 447 "reflect.h2"
 };
 
-#line 438 "reflect.h2"
+#line 453 "reflect.h2"
 class object_declaration
 : public declaration {
 
-#line 442 "reflect.h2"
+#line 457 "reflect.h2"
     public: object_declaration(
 
         cpp2::impl::in<declaration_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 452 "reflect.h2"
+#line 467 "reflect.h2"
     public: [[nodiscard]] auto is_const() const& -> bool;
     public: [[nodiscard]] auto has_wildcard_type() const& -> bool;
 
     public: [[nodiscard]] auto type() const& -> std::string;
 
-#line 462 "reflect.h2"
+#line 477 "reflect.h2"
     public: [[nodiscard]] auto initializer() const& -> std::string;
     public: object_declaration(object_declaration const& that);
 public: object_declaration(object_declaration&& that) noexcept;
 
 
-#line 468 "reflect.h2"
+#line 483 "reflect.h2"
 };
 
-#line 474 "reflect.h2"
+#line 489 "reflect.h2"
 class type_or_namespace_declaration
 : public declaration {
 
-#line 478 "reflect.h2"
+#line 493 "reflect.h2"
     public: type_or_namespace_declaration(
 
         cpp2::impl::in<declaration_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 488 "reflect.h2"
+#line 503 "reflect.h2"
     public: auto reserve_names(cpp2::impl::in<std::string_view> name, auto&& ...etc) const& -> void;
 
-#line 502 "reflect.h2"
+#line 517 "reflect.h2"
     public: [[nodiscard]] auto get_member_functions() const& -> std::vector<function_declaration>;
 
-#line 513 "reflect.h2"
+#line 528 "reflect.h2"
     public: [[nodiscard]] auto get_member_functions_needing_initializer() const& -> std::vector<function_declaration>;
 
-#line 528 "reflect.h2"
+#line 543 "reflect.h2"
     public: [[nodiscard]] auto get_member_objects() const& -> std::vector<object_declaration>;
 
-#line 538 "reflect.h2"
+#line 553 "reflect.h2"
     public: [[nodiscard]] auto get_member_types() const& -> std::vector<type_declaration>;
 
-#line 548 "reflect.h2"
+#line 563 "reflect.h2"
     public: [[nodiscard]] auto get_member_aliases() const& -> std::vector<alias_declaration>;
 
-#line 558 "reflect.h2"
+#line 573 "reflect.h2"
     public: [[nodiscard]] auto get_members() const& -> std::vector<declaration>;
 
-#line 568 "reflect.h2"
+#line 583 "reflect.h2"
     public: auto add_member(cpp2::impl::in<std::string_view> source) & -> void;
     public: type_or_namespace_declaration(type_or_namespace_declaration const& that);
 public: type_or_namespace_declaration(type_or_namespace_declaration&& that) noexcept;
 
 
-#line 582 "reflect.h2"
+#line 597 "reflect.h2"
 };
 
-#line 585 "reflect.h2"
+#line 600 "reflect.h2"
 class type_declaration
 : public type_or_namespace_declaration {
 
-#line 589 "reflect.h2"
+#line 604 "reflect.h2"
     public: type_declaration(
 
         cpp2::impl::in<declaration_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 600 "reflect.h2"
+#line 615 "reflect.h2"
     public: [[nodiscard]] auto is_polymorphic() const& -> bool;
     public: [[nodiscard]] auto is_final() const& -> bool;
     public: [[nodiscard]] auto make_final() & -> bool;
@@ -594,27 +600,27 @@ struct query_declared_value_set_functions_ret { bool out_this_in_that; bool out_
 
 
 
-#line 604 "reflect.h2"
+#line 619 "reflect.h2"
     public: [[nodiscard]] auto query_declared_value_set_functions() const& -> query_declared_value_set_functions_ret;
 
-#line 620 "reflect.h2"
+#line 635 "reflect.h2"
     public: [[nodiscard]] auto disable_member_function_generation() & -> decltype(auto);
     public: [[nodiscard]] auto disable_ref_qualifier_generation() & -> decltype(auto);
 
-#line 624 "reflect.h2"
+#line 639 "reflect.h2"
     public: [[nodiscard]] auto remove_marked_members() & -> decltype(auto);
     public: [[nodiscard]] auto remove_all_members() & -> decltype(auto);
     public: type_declaration(type_declaration const& that);
 public: type_declaration(type_declaration&& that) noexcept;
 
-#line 626 "reflect.h2"
+#line 641 "reflect.h2"
 };
 
-#line 629 "reflect.h2"
+#line 644 "reflect.h2"
 class namespace_declaration
 : public type_or_namespace_declaration {
 
-#line 633 "reflect.h2"
+#line 648 "reflect.h2"
     public: namespace_declaration(
 
         cpp2::impl::in<declaration_node*> n_, 
@@ -624,14 +630,14 @@ class namespace_declaration
 public: namespace_declaration(namespace_declaration&& that) noexcept;
 
 
-#line 642 "reflect.h2"
+#line 657 "reflect.h2"
 };
 
-#line 648 "reflect.h2"
+#line 663 "reflect.h2"
 class alias_declaration
 : public declaration {
 
-#line 652 "reflect.h2"
+#line 667 "reflect.h2"
     public: alias_declaration(
 
         cpp2::impl::in<declaration_node*> n_, 
@@ -641,21 +647,21 @@ class alias_declaration
 public: alias_declaration(alias_declaration&& that) noexcept;
 
 
-#line 661 "reflect.h2"
+#line 676 "reflect.h2"
 };
 
-#line 667 "reflect.h2"
+#line 682 "reflect.h2"
 class parameter_declaration
 : public reflection_base<parameter_declaration_node> {
 
-#line 671 "reflect.h2"
+#line 686 "reflect.h2"
     public: parameter_declaration(
 
         cpp2::impl::in<parameter_declaration_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 680 "reflect.h2"
+#line 695 "reflect.h2"
     public: [[nodiscard]] auto get_declaration() const& -> object_declaration;
     public: [[nodiscard]] auto get_passing_style() const& -> passing_style;
 
@@ -666,10 +672,10 @@ class parameter_declaration
     public: parameter_declaration(parameter_declaration const& that);
 public: parameter_declaration(parameter_declaration&& that) noexcept;
 
-#line 687 "reflect.h2"
+#line 702 "reflect.h2"
 };
 
-#line 700 "reflect.h2"
+#line 715 "reflect.h2"
 using multiplicative_expression = binary_expression<"multiplicative",is_as_expression_node>;
 using additive_expression = binary_expression<"additive",multiplicative_expression_node>;
 using shift_expression = binary_expression<"shift",additive_expression_node>;
@@ -686,14 +692,14 @@ using assignment_expression = binary_expression<"assignment",logical_or_expressi
 template<String Name, typename Term> class binary_expression
 : public reflection_base<binary_expression_node<Name,Term>> {
 
-#line 717 "reflect.h2"
+#line 732 "reflect.h2"
     public: binary_expression(
 
         binary_expression_node<Name,Term>* const& n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 726 "reflect.h2"
+#line 741 "reflect.h2"
     public: [[nodiscard]] auto is_fold_expression() const& -> bool;
     public: [[nodiscard]] auto lhs_is_id_expression() const& -> bool;
     public: [[nodiscard]] auto is_standalone_expression() const& -> bool;
@@ -718,16 +724,16 @@ public: auto operator=(term_t const& that) -> term_t& ;
 public: term_t(term_t&& that) noexcept;
 public: auto operator=(term_t&& that) noexcept -> term_t& ;
 
-#line 744 "reflect.h2"
+#line 759 "reflect.h2"
     };
 
     public: [[nodiscard]] auto get_terms() const& -> auto;
 
-#line 821 "reflect.h2"
+#line 836 "reflect.h2"
     public: [[nodiscard]] auto as_expression_list() const& -> expression_list;
     public: [[nodiscard]] auto as_literal() const& -> std::string;
 
-#line 825 "reflect.h2"
+#line 840 "reflect.h2"
     public: [[nodiscard]] auto get_if_only_a_postfix_expression() const& -> postfix_expression;
 
     public: [[nodiscard]] auto get_lhs_postfix_expression() const& -> postfix_expression;
@@ -740,49 +746,49 @@ public: auto operator=(term_t&& that) noexcept -> term_t& ;
     public: binary_expression(binary_expression const& that);
 public: binary_expression(binary_expression&& that) noexcept;
 
-#line 834 "reflect.h2"
+#line 849 "reflect.h2"
 };
 
-#line 840 "reflect.h2"
+#line 855 "reflect.h2"
 class expression_list
 : public reflection_base<expression_list_node> {
 
-#line 844 "reflect.h2"
+#line 859 "reflect.h2"
     public: expression_list(
 
         cpp2::impl::in<expression_list_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 853 "reflect.h2"
+#line 868 "reflect.h2"
     public: [[nodiscard]] auto is_empty() const& -> bool;
     public: [[nodiscard]] auto is_fold_expression() const& -> bool;
 
     public: [[nodiscard]] auto get_expressions() const& -> std::vector<expression>;
 
-#line 866 "reflect.h2"
+#line 881 "reflect.h2"
     public: [[nodiscard]] auto to_string() const& -> std::string;
     public: expression_list(expression_list const& that);
 public: expression_list(expression_list&& that) noexcept;
 
-#line 867 "reflect.h2"
+#line 882 "reflect.h2"
 };
 
-#line 873 "reflect.h2"
+#line 888 "reflect.h2"
 class prefix_expression
 : public reflection_base<prefix_expression_node> {
 
-#line 877 "reflect.h2"
+#line 892 "reflect.h2"
     public: prefix_expression(
 
         cpp2::impl::in<prefix_expression_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 886 "reflect.h2"
+#line 901 "reflect.h2"
     public: [[nodiscard]] auto get_ops() const& -> std::vector<std::string>;
 
-#line 894 "reflect.h2"
+#line 909 "reflect.h2"
     public: [[nodiscard]] auto get_postfix_expression() const& -> postfix_expression;
 
     public: [[nodiscard]] auto is_fold_expression() const& -> bool;
@@ -802,21 +808,21 @@ class prefix_expression
 public: prefix_expression(prefix_expression const& that);
 public: prefix_expression(prefix_expression&& that) noexcept;
 
-#line 909 "reflect.h2"
+#line 924 "reflect.h2"
 };
 
-#line 915 "reflect.h2"
+#line 930 "reflect.h2"
 class postfix_expression
 : public reflection_base<postfix_expression_node> {
 
-#line 919 "reflect.h2"
+#line 934 "reflect.h2"
     public: postfix_expression(
 
         cpp2::impl::in<postfix_expression_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 928 "reflect.h2"
+#line 943 "reflect.h2"
     public: [[nodiscard]] auto get_primary_expression() const& -> primary_expression;
 
     public: class term_t {
@@ -827,7 +833,7 @@ class postfix_expression
 
         public: [[nodiscard]] auto get_op() const& -> std::string_view;
 
-#line 944 "reflect.h2"
+#line 959 "reflect.h2"
         public: [[nodiscard]] auto is_id_expression() const& -> bool;
         public: [[nodiscard]] auto is_expression_list() const& -> bool;
         public: [[nodiscard]] auto is_expression() const& -> bool;
@@ -838,12 +844,12 @@ class postfix_expression
         public: term_t(term_t const& that);
 public: term_t(term_t&& that) noexcept;
 
-#line 951 "reflect.h2"
+#line 966 "reflect.h2"
     };
 
     public: [[nodiscard]] auto get_terms() const& -> auto;
 
-#line 959 "reflect.h2"
+#line 974 "reflect.h2"
     public: [[nodiscard]] auto is_fold_expression() const& -> bool;
     public: [[nodiscard]] auto is_identifier() const& -> bool;
     public: [[nodiscard]] auto is_id_expression() const& -> bool;
@@ -857,7 +863,7 @@ public: term_t(term_t&& that) noexcept;
 
     public: [[nodiscard]] auto get_first_token_ignoring_this() const& -> std::string_view;
 
-#line 976 "reflect.h2"
+#line 991 "reflect.h2"
     public: [[nodiscard]] auto starts_with_function_call_with_num_parameters(cpp2::impl::in<int> num) const& -> bool;
     public: [[nodiscard]] auto is_result_a_temporary_variable() const& -> bool;
 
@@ -865,21 +871,21 @@ public: term_t(term_t&& that) noexcept;
     public: postfix_expression(postfix_expression const& that);
 public: postfix_expression(postfix_expression&& that) noexcept;
 
-#line 980 "reflect.h2"
+#line 995 "reflect.h2"
 };
 
-#line 986 "reflect.h2"
+#line 1001 "reflect.h2"
 class template_arg
 : public reflection_base<template_argument> {
 
-#line 990 "reflect.h2"
+#line 1005 "reflect.h2"
     public: template_arg(
 
         cpp2::impl::in<template_argument*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 999 "reflect.h2"
+#line 1014 "reflect.h2"
     public: [[nodiscard]] auto is_expression() const& -> bool;
     public: [[nodiscard]] auto is_type_id() const& -> bool;
 
@@ -890,47 +896,47 @@ class template_arg
     public: template_arg(template_arg const& that);
 public: template_arg(template_arg&& that) noexcept;
 
-#line 1006 "reflect.h2"
+#line 1021 "reflect.h2"
 };
 
-#line 1012 "reflect.h2"
+#line 1027 "reflect.h2"
 class unqualified_id
 : public reflection_base<unqualified_id_node> {
 
-#line 1016 "reflect.h2"
+#line 1031 "reflect.h2"
     public: unqualified_id(
 
         cpp2::impl::in<unqualified_id_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 1025 "reflect.h2"
+#line 1040 "reflect.h2"
     public: [[nodiscard]] auto is_identifier() const& -> bool;
 
     public: [[nodiscard]] auto get_identifier() const& -> std::string;
 
-#line 1035 "reflect.h2"
+#line 1050 "reflect.h2"
     public: [[nodiscard]] auto as_token() const& -> std::string;
 
     public: [[nodiscard]] auto to_string() const& -> std::string;
     public: unqualified_id(unqualified_id const& that);
 public: unqualified_id(unqualified_id&& that) noexcept;
 
-#line 1038 "reflect.h2"
+#line 1053 "reflect.h2"
 };
 
-#line 1044 "reflect.h2"
+#line 1059 "reflect.h2"
 class qualified_id
 : public reflection_base<qualified_id_node> {
 
-#line 1048 "reflect.h2"
+#line 1063 "reflect.h2"
     public: qualified_id(
 
         cpp2::impl::in<qualified_id_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 1057 "reflect.h2"
+#line 1072 "reflect.h2"
     public: class term_t {
         private: std::string op; 
         private: unqualified_id unqualified; 
@@ -942,33 +948,33 @@ class qualified_id
         public: term_t(term_t const& that);
 public: term_t(term_t&& that) noexcept;
 
-#line 1065 "reflect.h2"
+#line 1080 "reflect.h2"
     };
 
     public: [[nodiscard]] auto get_terms() const& -> auto;
 
-#line 1079 "reflect.h2"
+#line 1094 "reflect.h2"
     public: [[nodiscard]] auto as_token() const& -> std::string;
 
     public: [[nodiscard]] auto to_string() const& -> std::string;
     public: qualified_id(qualified_id const& that);
 public: qualified_id(qualified_id&& that) noexcept;
 
-#line 1082 "reflect.h2"
+#line 1097 "reflect.h2"
 };
 
-#line 1088 "reflect.h2"
+#line 1103 "reflect.h2"
 class type_id
 : public reflection_base<type_id_node> {
 
-#line 1092 "reflect.h2"
+#line 1107 "reflect.h2"
     public: type_id(
 
         cpp2::impl::in<type_id_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 1107 "reflect.h2"
+#line 1122 "reflect.h2"
     public: [[nodiscard]] auto is_postfix_expression() const& -> bool;
     public: [[nodiscard]] auto is_qualified_id() const& -> bool;
     public: [[nodiscard]] auto is_unqualified_id() const& -> bool;
@@ -982,7 +988,7 @@ class type_id
     public: [[nodiscard]] auto as_qualified_id() const& -> qualified_id;
     public: [[nodiscard]] auto as_unqualified_id() const& -> unqualified_id;
 
-#line 1121 "reflect.h2"
+#line 1136 "reflect.h2"
     public: [[nodiscard]] auto as_keyword() const& -> std::string;
     public: [[nodiscard]] auto as_token() const& -> std::string;
 
@@ -990,21 +996,21 @@ class type_id
     public: type_id(type_id const& that);
 public: type_id(type_id&& that) noexcept;
 
-#line 1125 "reflect.h2"
+#line 1140 "reflect.h2"
 };
 
-#line 1131 "reflect.h2"
+#line 1146 "reflect.h2"
 class primary_expression
 : public reflection_base<primary_expression_node> {
 
-#line 1135 "reflect.h2"
+#line 1150 "reflect.h2"
     public: primary_expression(
 
         cpp2::impl::in<primary_expression_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 1150 "reflect.h2"
+#line 1165 "reflect.h2"
     public: [[nodiscard]] auto is_fold_expression() const& -> bool;
     public: [[nodiscard]] auto is_identifier() const& -> bool;
     public: [[nodiscard]] auto is_id_expression() const& -> bool;
@@ -1022,21 +1028,21 @@ class primary_expression
     public: primary_expression(primary_expression const& that);
 public: primary_expression(primary_expression&& that) noexcept;
 
-#line 1164 "reflect.h2"
+#line 1179 "reflect.h2"
 };
 
-#line 1170 "reflect.h2"
+#line 1185 "reflect.h2"
 class id_expression
 : public reflection_base<id_expression_node> {
 
-#line 1174 "reflect.h2"
+#line 1189 "reflect.h2"
     public: id_expression(
 
         cpp2::impl::in<id_expression_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 1189 "reflect.h2"
+#line 1204 "reflect.h2"
     public: [[nodiscard]] auto is_fold_expression() const& -> bool;
     public: [[nodiscard]] auto is_empty() const& -> bool;
     public: [[nodiscard]] auto is_identifier() const& -> bool;
@@ -1052,21 +1058,21 @@ class id_expression
 public: id_expression(id_expression const& that);
 public: id_expression(id_expression&& that) noexcept;
 
-#line 1200 "reflect.h2"
+#line 1215 "reflect.h2"
 };
 
-#line 1206 "reflect.h2"
+#line 1221 "reflect.h2"
 class expression
 : public reflection_base<expression_node> {
 
-#line 1210 "reflect.h2"
+#line 1225 "reflect.h2"
     public: expression(
 
         cpp2::impl::in<expression_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 1219 "reflect.h2"
+#line 1234 "reflect.h2"
     public: [[nodiscard]] auto is_fold_expression() const& -> bool;
     public: [[nodiscard]] auto is_standalone_expression() const& -> bool;
     public: [[nodiscard]] auto subexpression_count() const& -> int;
@@ -1083,10 +1089,10 @@ struct get_lhs_rhs_if_simple_assignment_ret { postfix_expression lhs; logical_or
 
 
 
-#line 1235 "reflect.h2"
+#line 1250 "reflect.h2"
     public: [[nodiscard]] auto get_lhs_rhs_if_simple_assignment() const& -> get_lhs_rhs_if_simple_assignment_ret;
 
-#line 1246 "reflect.h2"
+#line 1261 "reflect.h2"
     public: [[nodiscard]] auto as_assignment_expression() const& -> assignment_expression;
     public: [[nodiscard]] auto as_expression_list() const& -> expression_list;
     public: [[nodiscard]] auto as_literal() const& -> std::string;
@@ -1096,21 +1102,21 @@ struct get_lhs_rhs_if_simple_assignment_ret { postfix_expression lhs; logical_or
 public: expression(expression const& that);
 public: expression(expression&& that) noexcept;
 
-#line 1251 "reflect.h2"
+#line 1266 "reflect.h2"
 };
 
-#line 1257 "reflect.h2"
+#line 1272 "reflect.h2"
 class is_as_expression
 : public reflection_base<is_as_expression_node> {
 
-#line 1261 "reflect.h2"
+#line 1276 "reflect.h2"
     public: is_as_expression(
 
         cpp2::impl::in<is_as_expression_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 1270 "reflect.h2"
+#line 1285 "reflect.h2"
     public: class term_t {
         private: std::string op; 
         private: expression expr; 
@@ -1122,14 +1128,14 @@ class is_as_expression
         public: term_t(term_t const& that);
 public: term_t(term_t&& that) noexcept;
 
-#line 1278 "reflect.h2"
+#line 1293 "reflect.h2"
     };
 
     public: [[nodiscard]] auto get_expression() const& -> prefix_expression;
 
     public: [[nodiscard]] auto get_terms() const& -> auto;
 
-#line 1288 "reflect.h2"
+#line 1303 "reflect.h2"
     public: [[nodiscard]] auto is_fold_expression() const& -> bool;
     public: [[nodiscard]] auto is_identifier() const& -> bool;
     public: [[nodiscard]] auto is_id_expression() const& -> bool;
@@ -1142,30 +1148,30 @@ public: term_t(term_t&& that) noexcept;
 
     public: [[nodiscard]] auto get_identifier() const& -> std::string_view;
 
-#line 1304 "reflect.h2"
+#line 1319 "reflect.h2"
     public: [[nodiscard]] auto to_string() const& -> std::string;
     public: virtual ~is_as_expression() noexcept;
 public: is_as_expression(is_as_expression const& that);
 public: is_as_expression(is_as_expression&& that) noexcept;
 
-#line 1305 "reflect.h2"
+#line 1320 "reflect.h2"
 };
 
-#line 1318 "reflect.h2"
+#line 1333 "reflect.h2"
 class statement
 : public reflection_base<statement_node> {
 
-#line 1322 "reflect.h2"
+#line 1337 "reflect.h2"
     public: statement(
 
         cpp2::impl::in<statement_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 1331 "reflect.h2"
+#line 1346 "reflect.h2"
     public: [[nodiscard]] auto get_parameters() const& -> std::vector<parameter_declaration>;
 
-#line 1341 "reflect.h2"
+#line 1356 "reflect.h2"
     public: [[nodiscard]] auto is_expression_statement() const& -> bool;
     public: [[nodiscard]] auto is_compound_statement() const& -> bool;
     public: [[nodiscard]] auto is_selection_statement() const& -> bool;
@@ -1184,71 +1190,71 @@ class statement
     public: [[nodiscard]] auto as_return_statement() const& -> return_statement;
     public: [[nodiscard]] auto as_iteration_statement() const& -> iteration_statement;
 
-#line 1363 "reflect.h2"
+#line 1378 "reflect.h2"
     public: [[nodiscard]] auto to_string() const& -> std::string;
     public: virtual ~statement() noexcept;
 public: statement(statement const& that);
 public: statement(statement&& that) noexcept;
 
-#line 1364 "reflect.h2"
+#line 1379 "reflect.h2"
 };
 
-#line 1370 "reflect.h2"
+#line 1385 "reflect.h2"
 class expression_statement
 : public reflection_base<expression_statement_node> {
 
-#line 1374 "reflect.h2"
+#line 1389 "reflect.h2"
     public: expression_statement(
 
         cpp2::impl::in<expression_statement_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 1383 "reflect.h2"
+#line 1398 "reflect.h2"
     public: [[nodiscard]] auto get_expression() const& -> expression;
 
     public: [[nodiscard]] auto to_string() const& -> std::string;
     public: expression_statement(expression_statement const& that);
 public: expression_statement(expression_statement&& that) noexcept;
 
-#line 1386 "reflect.h2"
+#line 1401 "reflect.h2"
 };
 
-#line 1392 "reflect.h2"
+#line 1407 "reflect.h2"
 class compound_statement
 : public reflection_base<compound_statement_node> {
 
-#line 1396 "reflect.h2"
+#line 1411 "reflect.h2"
     public: compound_statement(
 
         cpp2::impl::in<compound_statement_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 1405 "reflect.h2"
+#line 1420 "reflect.h2"
     public: [[nodiscard]] auto get_statements() const& -> std::vector<statement>;
 
-#line 1415 "reflect.h2"
+#line 1430 "reflect.h2"
     public: auto add_statement(cpp2::impl::in<std::string_view> source, cpp2::impl::in<int> before_position = 0) & -> void;
     public: compound_statement(compound_statement const& that);
 public: compound_statement(compound_statement&& that) noexcept;
 
 
-#line 1425 "reflect.h2"
+#line 1440 "reflect.h2"
 };
 
-#line 1431 "reflect.h2"
+#line 1446 "reflect.h2"
 class selection_statement
 : public reflection_base<selection_statement_node> {
 
-#line 1435 "reflect.h2"
+#line 1450 "reflect.h2"
     public: selection_statement(
 
         cpp2::impl::in<selection_statement_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 1444 "reflect.h2"
+#line 1459 "reflect.h2"
     public: [[nodiscard]] auto has_false_branch_in_source_code() const& -> bool;
     public: [[nodiscard]] auto has_false_branch() const& -> bool;
 
@@ -1259,42 +1265,42 @@ class selection_statement
     public: selection_statement(selection_statement const& that);
 public: selection_statement(selection_statement&& that) noexcept;
 
-#line 1451 "reflect.h2"
+#line 1466 "reflect.h2"
 };
 
-#line 1457 "reflect.h2"
+#line 1472 "reflect.h2"
 class return_statement
 : public reflection_base<return_statement_node> {
 
-#line 1461 "reflect.h2"
+#line 1476 "reflect.h2"
     public: return_statement(
 
         cpp2::impl::in<return_statement_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 1470 "reflect.h2"
+#line 1485 "reflect.h2"
     public: [[nodiscard]] auto has_expression() const& -> bool;
 
     public: [[nodiscard]] auto get_expression() const& -> expression;
     public: return_statement(return_statement const& that);
 public: return_statement(return_statement&& that) noexcept;
 
-#line 1473 "reflect.h2"
+#line 1488 "reflect.h2"
 };
 
-#line 1479 "reflect.h2"
+#line 1494 "reflect.h2"
 class iteration_statement
 : public reflection_base<iteration_statement_node> {
 
-#line 1483 "reflect.h2"
+#line 1498 "reflect.h2"
     public: iteration_statement(
 
         cpp2::impl::in<iteration_statement_node*> n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 1492 "reflect.h2"
+#line 1507 "reflect.h2"
     public: [[nodiscard]] auto is_do() const& -> bool;
     public: [[nodiscard]] auto is_while() const& -> bool;
     public: [[nodiscard]] auto is_for() const& -> bool;
@@ -1310,68 +1316,68 @@ class iteration_statement
     public: iteration_statement(iteration_statement const& that);
 public: iteration_statement(iteration_statement&& that) noexcept;
 
-#line 1504 "reflect.h2"
+#line 1519 "reflect.h2"
 };
 
-#line 1519 "reflect.h2"
+#line 1534 "reflect.h2"
 auto add_virtual_destructor(meta::type_declaration& t) -> void;
 
-#line 1539 "reflect.h2"
+#line 1554 "reflect.h2"
 auto interface(meta::type_declaration& t) -> void;
 
-#line 1587 "reflect.h2"
+#line 1602 "reflect.h2"
 auto polymorphic_base(meta::type_declaration& t) -> void;
 
-#line 1632 "reflect.h2"
+#line 1647 "reflect.h2"
 auto ordered_impl(
     meta::type_declaration& t, 
     cpp2::impl::in<std::string_view> ordering
 ) -> void;
 
-#line 1661 "reflect.h2"
+#line 1676 "reflect.h2"
 auto ordered(meta::type_declaration& t) -> void;
 
-#line 1669 "reflect.h2"
+#line 1684 "reflect.h2"
 auto weakly_ordered(meta::type_declaration& t) -> void;
 
-#line 1677 "reflect.h2"
+#line 1692 "reflect.h2"
 auto partially_ordered(meta::type_declaration& t) -> void;
 
-#line 1699 "reflect.h2"
+#line 1714 "reflect.h2"
 auto copyable(meta::type_declaration& t) -> void;
 
-#line 1731 "reflect.h2"
+#line 1746 "reflect.h2"
 auto copy_constructible(meta::type_declaration& t) -> void;
 
-#line 1763 "reflect.h2"
+#line 1778 "reflect.h2"
 auto hashable(meta::type_declaration& t) -> void;
 
-#line 1796 "reflect.h2"
+#line 1811 "reflect.h2"
 auto basic_value(meta::type_declaration& t) -> void;
 
-#line 1824 "reflect.h2"
+#line 1839 "reflect.h2"
 auto value(meta::type_declaration& t) -> void;
 
-#line 1830 "reflect.h2"
+#line 1845 "reflect.h2"
 auto weakly_ordered_value(meta::type_declaration& t) -> void;
 
-#line 1836 "reflect.h2"
+#line 1851 "reflect.h2"
 auto partially_ordered_value(meta::type_declaration& t) -> void;
 
-#line 1865 "reflect.h2"
+#line 1880 "reflect.h2"
 auto cpp1_rule_of_zero(meta::type_declaration& t) -> void;
 
-#line 1907 "reflect.h2"
+#line 1922 "reflect.h2"
 auto cpp2_struct(meta::type_declaration& t) -> void;
 
-#line 1976 "reflect.h2"
+#line 1991 "reflect.h2"
 class value_member_info {
     public: std::string name; 
     public: std::string type; 
     public: std::string value; 
     public: value_member_info(auto const& name_, auto const& type_, auto const& value_);
 
-#line 1980 "reflect.h2"
+#line 1995 "reflect.h2"
 };
 
 auto basic_enum(
@@ -1380,313 +1386,313 @@ auto basic_enum(
     cpp2::impl::in<bool> bitwise
     ) -> void;
 
-#line 2246 "reflect.h2"
+#line 2261 "reflect.h2"
 auto cpp2_enum(meta::type_declaration& t) -> void;
 
-#line 2273 "reflect.h2"
+#line 2288 "reflect.h2"
 auto flag_enum(meta::type_declaration& t) -> void;
 
-#line 2319 "reflect.h2"
+#line 2334 "reflect.h2"
 auto cpp2_union(meta::type_declaration& t) -> void;
 
-#line 2470 "reflect.h2"
+#line 2485 "reflect.h2"
 auto print(cpp2::impl::in<meta::type_declaration> t) -> void;
 
-#line 2481 "reflect.h2"
+#line 2496 "reflect.h2"
 auto noisy(cpp2::impl::in<meta::type_declaration> t) -> void;
 struct python_param_names_and_types_ret { std::string names; std::string types; };
 
 
 
-#line 2505 "reflect.h2"
+#line 2520 "reflect.h2"
 [[nodiscard]] auto python_param_names_and_types(cpp2::impl::in<meta::function_declaration> mf) -> python_param_names_and_types_ret;
 
-#line 2527 "reflect.h2"
+#line 2542 "reflect.h2"
 auto python(meta::type_declaration& t) -> void;
 
-#line 2570 "reflect.h2"
+#line 2585 "reflect.h2"
 auto javascript(meta::type_declaration& t) -> void;
 
-#line 2611 "reflect.h2"
+#line 2626 "reflect.h2"
 auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 2619 "reflect.h2"
+#line 2634 "reflect.h2"
 class simple_traverser {
 
     public: virtual auto pre_traverse(cpp2::impl::in<meta::declaration> decl) -> void;
 
-#line 2625 "reflect.h2"
+#line 2640 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::declaration> decl) -> void;
 
-#line 2645 "reflect.h2"
+#line 2660 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::function_declaration> f) -> void;
 
-#line 2649 "reflect.h2"
+#line 2664 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::function_declaration> f) -> void;
 
-#line 2670 "reflect.h2"
+#line 2685 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::object_declaration> o) -> void;
 
-#line 2674 "reflect.h2"
+#line 2689 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::object_declaration> o) -> void;
 
-#line 2682 "reflect.h2"
+#line 2697 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::type_declaration> t) -> void;
 
-#line 2686 "reflect.h2"
+#line 2701 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::type_declaration> t) -> void;
 
-#line 2694 "reflect.h2"
+#line 2709 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::parameter_declaration> t) -> void;
 
-#line 2698 "reflect.h2"
+#line 2713 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::parameter_declaration> t) -> void;
 
-#line 2703 "reflect.h2"
+#line 2718 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::statement> stmt) -> void;
 
-#line 2707 "reflect.h2"
+#line 2722 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::statement> stmt) -> void;
 
-#line 2742 "reflect.h2"
+#line 2757 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::compound_statement> stmt) -> void;
 
-#line 2746 "reflect.h2"
+#line 2761 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::compound_statement> stmt) -> void;
 
-#line 2756 "reflect.h2"
+#line 2771 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::return_statement> stmt) -> void;
 
-#line 2760 "reflect.h2"
+#line 2775 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::return_statement> stmt) -> void;
 
-#line 2768 "reflect.h2"
+#line 2783 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::iteration_statement> stmt) -> void;
 
-#line 2772 "reflect.h2"
+#line 2787 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::iteration_statement> stmt) -> void;
 
-#line 2791 "reflect.h2"
+#line 2806 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::selection_statement> stmt) -> void;
 
-#line 2795 "reflect.h2"
+#line 2810 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::selection_statement> stmt) -> void;
 
-#line 2806 "reflect.h2"
+#line 2821 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::expression> expr) -> void;
 
-#line 2812 "reflect.h2"
+#line 2827 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::expression> expr) -> void;
 
-#line 2826 "reflect.h2"
+#line 2841 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::assignment_expression> binexpr) -> void;
 
-#line 2843 "reflect.h2"
+#line 2858 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::assignment_expression> binexpr) -> void;
 
-#line 2854 "reflect.h2"
+#line 2869 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::logical_or_expression> binexpr) -> void;
 
-#line 2871 "reflect.h2"
+#line 2886 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::logical_or_expression> binexpr) -> void;
 
-#line 2883 "reflect.h2"
+#line 2898 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::logical_and_expression> binexpr) -> void;
 
-#line 2900 "reflect.h2"
+#line 2915 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::logical_and_expression> binexpr) -> void;
 
-#line 2911 "reflect.h2"
+#line 2926 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::bit_or_expression> binexpr) -> void;
 
-#line 2928 "reflect.h2"
+#line 2943 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::bit_or_expression> binexpr) -> void;
 
-#line 2939 "reflect.h2"
+#line 2954 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::bit_xor_expression> binexpr) -> void;
 
-#line 2956 "reflect.h2"
+#line 2971 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::bit_xor_expression> binexpr) -> void;
 
-#line 2968 "reflect.h2"
+#line 2983 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::bit_and_expression> binexpr) -> void;
 
-#line 2985 "reflect.h2"
+#line 3000 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::bit_and_expression> binexpr) -> void;
 
-#line 2997 "reflect.h2"
+#line 3012 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::equality_expression> binexpr) -> void;
 
-#line 3014 "reflect.h2"
+#line 3029 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::equality_expression> binexpr) -> void;
 
-#line 3025 "reflect.h2"
+#line 3040 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::relational_expression> binexpr) -> void;
 
-#line 3042 "reflect.h2"
+#line 3057 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::relational_expression> binexpr) -> void;
 
-#line 3053 "reflect.h2"
+#line 3068 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::compare_expression> binexpr) -> void;
 
-#line 3070 "reflect.h2"
+#line 3085 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::compare_expression> binexpr) -> void;
 
-#line 3081 "reflect.h2"
+#line 3096 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::shift_expression> binexpr) -> void;
 
-#line 3098 "reflect.h2"
+#line 3113 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::shift_expression> binexpr) -> void;
 
-#line 3109 "reflect.h2"
+#line 3124 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::additive_expression> binexpr) -> void;
 
-#line 3126 "reflect.h2"
+#line 3141 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::additive_expression> binexpr) -> void;
 
-#line 3138 "reflect.h2"
+#line 3153 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::multiplicative_expression> binexpr) -> void;
 
-#line 3155 "reflect.h2"
+#line 3170 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::multiplicative_expression> binexpr) -> void;
 
-#line 3166 "reflect.h2"
+#line 3181 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::is_as_expression> isas) -> void;
 
-#line 3182 "reflect.h2"
+#line 3197 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::is_as_expression> isas) -> void;
 
-#line 3193 "reflect.h2"
+#line 3208 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::expression_list> exprs) -> void;
 
-#line 3200 "reflect.h2"
+#line 3215 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::prefix_expression> prefix) -> void;
 
-#line 3216 "reflect.h2"
+#line 3231 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::prefix_expression> prefix) -> void;
 
-#line 3221 "reflect.h2"
+#line 3236 "reflect.h2"
     public: virtual auto pre_traverse(cpp2::impl::in<meta::postfix_expression> postfix) -> void;
 
-#line 3237 "reflect.h2"
+#line 3252 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::postfix_expression> postfix) -> void;
 
-#line 3256 "reflect.h2"
+#line 3271 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::unqualified_id> uid) -> void;
 
-#line 3262 "reflect.h2"
+#line 3277 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::qualified_id> qid) -> void;
 
-#line 3272 "reflect.h2"
+#line 3287 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::type_id> tid) -> void;
 
-#line 3289 "reflect.h2"
+#line 3304 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::primary_expression> primary) -> void;
 
-#line 3309 "reflect.h2"
+#line 3324 "reflect.h2"
     public: virtual auto traverse(cpp2::impl::in<meta::id_expression> idexpr) -> void;
     public: simple_traverser() = default;
     public: simple_traverser(simple_traverser const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(simple_traverser const&) -> void = delete;
 
 
-#line 3324 "reflect.h2"
+#line 3339 "reflect.h2"
 };
 
-#line 3337 "reflect.h2"
+#line 3352 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::declaration> decl, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3359 "reflect.h2"
+#line 3374 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::function_declaration> f, cpp2::impl::in<cpp2::i32> indent = 0) -> void;
 
-#line 3389 "reflect.h2"
+#line 3404 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::object_declaration> o, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3399 "reflect.h2"
+#line 3414 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::type_declaration> t, cpp2::impl::in<cpp2::i32> indent = 0) -> void;
 
-#line 3420 "reflect.h2"
+#line 3435 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::parameter_declaration> t, cpp2::impl::in<cpp2::i32> indent = 0) -> void;
 
-#line 3439 "reflect.h2"
+#line 3454 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::statement> stmt, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3494 "reflect.h2"
+#line 3509 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::compound_statement> stmt, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3511 "reflect.h2"
+#line 3526 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::return_statement> stmt, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3521 "reflect.h2"
+#line 3536 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::iteration_statement> stmt, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3553 "reflect.h2"
+#line 3568 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::expression> expr, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3567 "reflect.h2"
+#line 3582 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::assignment_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3597 "reflect.h2"
+#line 3612 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::logical_or_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3627 "reflect.h2"
+#line 3642 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::logical_and_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3657 "reflect.h2"
+#line 3672 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::bit_or_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3687 "reflect.h2"
+#line 3702 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::bit_xor_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3717 "reflect.h2"
+#line 3732 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::bit_and_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3747 "reflect.h2"
+#line 3762 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::equality_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3777 "reflect.h2"
+#line 3792 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::relational_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3807 "reflect.h2"
+#line 3822 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::compare_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3837 "reflect.h2"
+#line 3852 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::shift_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3867 "reflect.h2"
+#line 3882 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::additive_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3897 "reflect.h2"
+#line 3912 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::multiplicative_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3927 "reflect.h2"
+#line 3942 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::is_as_expression> isas, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3953 "reflect.h2"
+#line 3968 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::expression_list> exprs, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3968 "reflect.h2"
+#line 3983 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::prefix_expression> prefix, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 3992 "reflect.h2"
+#line 4007 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::postfix_expression> postfix, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 4025 "reflect.h2"
+#line 4040 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::unqualified_id> uid, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 4036 "reflect.h2"
+#line 4051 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::qualified_id> qid, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 4052 "reflect.h2"
+#line 4067 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::type_id> tid, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 4069 "reflect.h2"
+#line 4084 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::primary_expression> primary, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 4089 "reflect.h2"
+#line 4104 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::id_expression> idexpr, cpp2::impl::in<cpp2::i32> indent) -> void;
 
-#line 4111 "reflect.h2"
+#line 4126 "reflect.h2"
 class autodiff_special_func {
            public: std::string name; 
            public: int n_args; 
@@ -1703,18 +1709,18 @@ class autodiff_special_func {
                           cpp2::impl::in<std::string> code_rws_ = "", cpp2::impl::in<std::string> code_primal_higher_order_ = "", cpp2::impl::in<std::string> code_fwd_higher_order_ = "", 
                           cpp2::impl::in<std::string> code_rws_higher_order_ = "");
 
-#line 4148 "reflect.h2"
+#line 4163 "reflect.h2"
     public: autodiff_special_func(autodiff_special_func const& that);
-#line 4148 "reflect.h2"
+#line 4163 "reflect.h2"
     public: auto operator=(autodiff_special_func const& that) -> autodiff_special_func& ;
-#line 4148 "reflect.h2"
+#line 4163 "reflect.h2"
     public: autodiff_special_func(autodiff_special_func&& that) noexcept;
-#line 4148 "reflect.h2"
+#line 4163 "reflect.h2"
     public: auto operator=(autodiff_special_func&& that) noexcept -> autodiff_special_func& ;
 
     public: [[nodiscard]] auto is_match(cpp2::impl::in<autodiff_special_func> o) const& -> bool;
 
-#line 4153 "reflect.h2"
+#line 4168 "reflect.h2"
 };
 
 class autodiff_declared_variable {
@@ -1727,13 +1733,13 @@ class autodiff_declared_variable {
 
     public: autodiff_declared_variable(cpp2::impl::in<std::string> name_, cpp2::impl::in<std::string> decl_, cpp2::impl::in<bool> is_active_, cpp2::impl::in<bool> is_member_);
 
-#line 4170 "reflect.h2"
+#line 4185 "reflect.h2"
     public: autodiff_declared_variable(autodiff_declared_variable const& that);
-#line 4170 "reflect.h2"
+#line 4185 "reflect.h2"
     public: auto operator=(autodiff_declared_variable const& that) -> autodiff_declared_variable& ;
-#line 4170 "reflect.h2"
+#line 4185 "reflect.h2"
     public: autodiff_declared_variable(autodiff_declared_variable&& that) noexcept;
-#line 4170 "reflect.h2"
+#line 4185 "reflect.h2"
     public: auto operator=(autodiff_declared_variable&& that) noexcept -> autodiff_declared_variable& ;
 };
 
@@ -1750,25 +1756,25 @@ class autodiff_declaration_stack_item {
 using lookup_declaration_ret = std::vector<meta::declaration>;
 
 
-#line 4187 "reflect.h2"
+#line 4202 "reflect.h2"
     public: [[nodiscard]] auto lookup_declaration(cpp2::impl::in<std::string> decl_name) const& -> lookup_declaration_ret;
 struct lookup_variable_declaration_ret { bool found; autodiff_declared_variable r; };
 
 
 
-#line 4197 "reflect.h2"
+#line 4212 "reflect.h2"
     public: [[nodiscard]] auto lookup_variable_declaration(cpp2::impl::in<std::string> decl_name) const& -> lookup_variable_declaration_ret;
     public: autodiff_declaration_stack_item(autodiff_declaration_stack_item const& that);
 public: autodiff_declaration_stack_item(autodiff_declaration_stack_item&& that) noexcept;
 
 
-#line 4215 "reflect.h2"
+#line 4230 "reflect.h2"
 };
 
 class autodiff_context {
     private: int temporary_count {0}; 
 
-#line 4227 "reflect.h2"
+#line 4242 "reflect.h2"
     public: std::vector<autodiff_special_func> special_funcs {
         autodiff_special_func("sin", 1,                   false, 
             "sin(_a1_)", 
@@ -1808,13 +1814,13 @@ class autodiff_context {
             "_od_.push_back(_ad1_);", 
             "TODO")}; 
 
-#line 4267 "reflect.h2"
+#line 4282 "reflect.h2"
             public: std::string fwd_suffix {"_d"}; 
             public: std::string rws_suffix {"_b"}; 
             private: int order {1}; 
             public: bool reverse {false}; 
 
-#line 4273 "reflect.h2"
+#line 4288 "reflect.h2"
     public: std::string fwd_ad_type {"double"}; 
     public: std::string rws_ad_type {"double"}; 
 
@@ -1824,94 +1830,94 @@ class autodiff_context {
     public: explicit autodiff_context();
     public: autodiff_context(cpp2::impl::in<int> order_, cpp2::impl::in<bool> reverse_);
 
-#line 4296 "reflect.h2"
+#line 4311 "reflect.h2"
     public: auto add_variable_declaration(cpp2::impl::in<std::string> name, cpp2::impl::in<std::string> type, cpp2::impl::in<bool> is_active, cpp2::impl::in<bool> is_member = false) & -> void;
 
-#line 4300 "reflect.h2"
+#line 4315 "reflect.h2"
     public: [[nodiscard]] auto is_variable_active(cpp2::impl::in<std::string> name) & -> bool;
 
-#line 4304 "reflect.h2"
+#line 4319 "reflect.h2"
     public: auto create_namespace_stack(cpp2::impl::in<meta::type_or_namespace_declaration> t) & -> void;
 
-#line 4321 "reflect.h2"
+#line 4336 "reflect.h2"
     public: [[nodiscard]] auto is_forward() const& -> decltype(auto);
     public: [[nodiscard]] auto is_reverse() const& -> decltype(auto);
     public: [[nodiscard]] auto is_taylor() const& -> decltype(auto);
 
     public: [[nodiscard]] auto gen_temporary() & -> std::string;
 
-#line 4330 "reflect.h2"
+#line 4345 "reflect.h2"
     public: [[nodiscard]] auto is_type_active(cpp2::impl::in<std::string> type) & -> bool;
 
-#line 4351 "reflect.h2"
+#line 4366 "reflect.h2"
     public: [[nodiscard]] auto get_fwd_ad_type(cpp2::impl::in<std::string> type) & -> std::string;
 
-#line 4369 "reflect.h2"
+#line 4384 "reflect.h2"
     public: [[nodiscard]] auto get_rws_ad_type(cpp2::impl::in<std::string> type) & -> std::string;
 
-#line 4387 "reflect.h2"
+#line 4402 "reflect.h2"
     public: [[nodiscard]] auto get_reverse_passing_style(cpp2::impl::in<passing_style> p) const& -> passing_style;
 using lookup_declaration_ret = std::vector<meta::declaration>;
 
 
-#line 4415 "reflect.h2"
+#line 4430 "reflect.h2"
     public: [[nodiscard]] auto lookup_declaration(cpp2::impl::in<std::string> decl_name) & -> lookup_declaration_ret;
 
-#line 4442 "reflect.h2"
+#line 4457 "reflect.h2"
     public: [[nodiscard]] auto lookup_variable_declaration(cpp2::impl::in<std::string> name) & -> autodiff_declared_variable;
 using lookup_function_declaration_ret = std::vector<meta::function_declaration>;
 
 
-#line 4464 "reflect.h2"
+#line 4479 "reflect.h2"
     public: [[nodiscard]] auto lookup_function_declaration(cpp2::impl::in<std::string> decl_name) & -> lookup_function_declaration_ret;
 using lookup_member_function_declaration_ret = std::vector<meta::function_declaration>;
 
 
-#line 4474 "reflect.h2"
+#line 4489 "reflect.h2"
     public: [[nodiscard]] auto lookup_member_function_declaration(cpp2::impl::in<meta::type_declaration> obj_type, cpp2::impl::in<std::string> decl_name) & -> lookup_member_function_declaration_ret;
 using lookup_type_declaration_ret = std::vector<meta::type_declaration>;
 
 
-#line 4484 "reflect.h2"
+#line 4499 "reflect.h2"
     public: [[nodiscard]] auto lookup_type_declaration(cpp2::impl::in<std::string> decl_name) & -> lookup_type_declaration_ret;
 struct lookup_special_function_handling_ret { bool m; std::string code_primal; std::string code_fwd; std::string code_rws; };
 
 
 
-#line 4494 "reflect.h2"
+#line 4509 "reflect.h2"
     public: [[nodiscard]] auto lookup_special_function_handling(cpp2::impl::in<std::string> func_name, cpp2::impl::in<int> n_args, cpp2::impl::in<bool> is_member) const& -> lookup_special_function_handling_ret;
 
-#line 4519 "reflect.h2"
+#line 4534 "reflect.h2"
     public: auto add_as_differentiated(cpp2::impl::in<meta::declaration> t) & -> void;
 
-#line 4527 "reflect.h2"
+#line 4542 "reflect.h2"
     public: auto add_for_differentiation(cpp2::impl::in<meta::declaration> t) & -> void;
 
-#line 4553 "reflect.h2"
+#line 4568 "reflect.h2"
     public: [[nodiscard]] static auto is_in_list(cpp2::impl::in<meta::declaration> v, cpp2::impl::in<std::vector<meta::declaration>> list) -> bool;
 
-#line 4563 "reflect.h2"
+#line 4578 "reflect.h2"
     public: auto enter_function() & -> void;
 
-#line 4568 "reflect.h2"
+#line 4583 "reflect.h2"
     public: auto leave_function() & -> void;
 
-#line 4572 "reflect.h2"
+#line 4587 "reflect.h2"
     public: auto push_stack(cpp2::impl::in<meta::type_or_namespace_declaration> decl) & -> void;
 
-#line 4585 "reflect.h2"
+#line 4600 "reflect.h2"
     public: auto pop_stack() & -> void;
 
-#line 4600 "reflect.h2"
+#line 4615 "reflect.h2"
     public: auto finish() & -> void;
 
-#line 4607 "reflect.h2"
+#line 4622 "reflect.h2"
     public: [[nodiscard]] auto get_self() & -> autodiff_context*;
     public: autodiff_context(autodiff_context const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(autodiff_context const&) -> void = delete;
 
 
-#line 4611 "reflect.h2"
+#line 4626 "reflect.h2"
 };
 
 class autodiff_diff_code {
@@ -1922,16 +1928,16 @@ class autodiff_diff_code {
     public: std::string rws_backprop {""}; 
 
     public: autodiff_diff_code(cpp2::impl::in<autodiff_context*> ctx_);
-#line 4620 "reflect.h2"
+#line 4635 "reflect.h2"
     public: auto operator=(cpp2::impl::in<autodiff_context*> ctx_) -> autodiff_diff_code& ;
 
-#line 4623 "reflect.h2"
+#line 4638 "reflect.h2"
     public: autodiff_diff_code(autodiff_diff_code const& that);
-#line 4623 "reflect.h2"
+#line 4638 "reflect.h2"
     public: auto operator=(autodiff_diff_code const& that) -> autodiff_diff_code& ;
-#line 4623 "reflect.h2"
+#line 4638 "reflect.h2"
     public: autodiff_diff_code(autodiff_diff_code&& that) noexcept;
-#line 4623 "reflect.h2"
+#line 4638 "reflect.h2"
     public: auto operator=(autodiff_diff_code&& that) noexcept -> autodiff_diff_code& ;
 
     public: auto add_forward(cpp2::impl::in<std::string> v) & -> void;
@@ -1940,46 +1946,46 @@ class autodiff_diff_code {
 
     public: auto reset() & -> void;
 
-#line 4636 "reflect.h2"
+#line 4651 "reflect.h2"
     public: auto operator=(cpp2::impl::in<std::string> v) -> autodiff_diff_code& ;
 
-#line 4642 "reflect.h2"
+#line 4657 "reflect.h2"
     public: auto operator+=(cpp2::impl::in<std::string> v) & -> void;
 
-#line 4647 "reflect.h2"
+#line 4662 "reflect.h2"
     public: auto operator+=(cpp2::impl::in<autodiff_diff_code> v) & -> void;
 
-#line 4652 "reflect.h2"
+#line 4667 "reflect.h2"
     public: [[nodiscard]] auto empty() const& -> bool;
 
-#line 4655 "reflect.h2"
+#line 4670 "reflect.h2"
 };
 
-#line 4662 "reflect.h2"
+#line 4677 "reflect.h2"
 class autodiff_activity_check: public simple_traverser {
 
-#line 4665 "reflect.h2"
+#line 4680 "reflect.h2"
            public: autodiff_context* ctx; 
            public: bool active {false}; 
 
     public: autodiff_activity_check(cpp2::impl::in<autodiff_context*> ctx_);
 
-#line 4672 "reflect.h2"
+#line 4687 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::type_declaration> t) -> void override;
 
-#line 4684 "reflect.h2"
+#line 4699 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::object_declaration> o) -> void override;
 
-#line 4702 "reflect.h2"
+#line 4717 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::primary_expression> primary) -> void override;
 
-#line 4726 "reflect.h2"
+#line 4741 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::postfix_expression> postfix) -> void override;
     public: autodiff_activity_check(autodiff_activity_check const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(autodiff_activity_check const&) -> void = delete;
 
 
-#line 4758 "reflect.h2"
+#line 4773 "reflect.h2"
 };
 
 class autodiff_handler_base {
@@ -1988,21 +1994,21 @@ class autodiff_handler_base {
     public: autodiff_diff_code diff; 
 
     public: autodiff_handler_base(cpp2::impl::in<autodiff_context*> ctx_);
-#line 4765 "reflect.h2"
+#line 4780 "reflect.h2"
     public: auto operator=(cpp2::impl::in<autodiff_context*> ctx_) -> autodiff_handler_base& ;
 
-#line 4771 "reflect.h2"
+#line 4786 "reflect.h2"
     public: auto append(autodiff_handler_base const& o) & -> void;
     public: autodiff_handler_base(autodiff_handler_base const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(autodiff_handler_base const&) -> void = delete;
 
 
-#line 4776 "reflect.h2"
+#line 4791 "reflect.h2"
 };
 
 class autodiff_expression_handler: public simple_traverser, public autodiff_handler_base {
 
-#line 4782 "reflect.h2"
+#line 4797 "reflect.h2"
     public: using base = simple_traverser;
 
     public: std::string primal_expr {""}; 
@@ -2011,33 +2017,33 @@ class autodiff_expression_handler: public simple_traverser, public autodiff_hand
 
     public: autodiff_expression_handler(cpp2::impl::in<autodiff_context*> ctx_);
 
-#line 4792 "reflect.h2"
+#line 4807 "reflect.h2"
     public: [[nodiscard]] auto add_suffix_if_not_wildcard(cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> suffix) const& -> std::string;
 
-#line 4801 "reflect.h2"
+#line 4816 "reflect.h2"
     public: [[nodiscard]] auto prepare_backprop(cpp2::impl::in<std::string> rhs_b, cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> lhs_d, cpp2::impl::in<std::string> lhs_b) const& -> std::string;
 
-#line 4809 "reflect.h2"
+#line 4824 "reflect.h2"
     public: [[nodiscard]] auto prepare_backprop(cpp2::impl::in<std::string> rhs_b, cpp2::impl::in<std::string> lhs) const& -> std::string;
 
     public: auto gen_assignment(cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> lhs_d, cpp2::impl::in<std::string> lhs_b, cpp2::impl::in<std::string> rhs, cpp2::impl::in<std::string> rhs_d, cpp2::impl::in<std::string> rhs_b) & -> void;
 
-#line 4822 "reflect.h2"
+#line 4837 "reflect.h2"
     public: [[nodiscard]] auto gen_assignment(cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> lhs_d, cpp2::impl::in<std::string> lhs_b) & -> decltype(auto);
 
     public: [[nodiscard]] auto gen_assignment(cpp2::impl::in<std::string> lhs) & -> decltype(auto);
 
-#line 4828 "reflect.h2"
+#line 4843 "reflect.h2"
     public: auto gen_declaration(cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> lhs_d, cpp2::impl::in<std::string> lhs_b, cpp2::impl::in<std::string> rhs, cpp2::impl::in<std::string> rhs_d, cpp2::impl::in<std::string> rhs_b, cpp2::impl::in<std::string> type, cpp2::impl::in<std::string> type_d, cpp2::impl::in<std::string> type_b) & -> void;
 
-#line 4840 "reflect.h2"
+#line 4855 "reflect.h2"
     public: [[nodiscard]] auto gen_declaration(cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> lhs_d, cpp2::impl::in<std::string> lhs_b, cpp2::impl::in<std::string> rhs, cpp2::impl::in<std::string> rhs_d, cpp2::impl::in<std::string> rhs_b, cpp2::impl::in<std::string> type) & -> decltype(auto);
 
     public: [[nodiscard]] auto gen_declaration(cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> lhs_d, cpp2::impl::in<std::string> lhs_b, cpp2::impl::in<std::string> type) & -> decltype(auto);
 
     public: [[nodiscard]] auto gen_declaration(cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> type) & -> decltype(auto);
 
-#line 4849 "reflect.h2"
+#line 4864 "reflect.h2"
     public: class primal_fwd_rws_name {
         public: std::string primal {""}; 
         public: std::string fwd {""}; 
@@ -2046,80 +2052,80 @@ class autodiff_expression_handler: public simple_traverser, public autodiff_hand
         public: primal_fwd_rws_name(auto const& primal_, auto const& fwd_, auto const& rws_, auto const& active_);
 public: primal_fwd_rws_name();
 
-#line 4854 "reflect.h2"
+#line 4869 "reflect.h2"
     };
 
     public: [[nodiscard]] auto handle_expression_list(cpp2::impl::in<meta::expression_list> list) & -> std::vector<primal_fwd_rws_name>;
 
-#line 4865 "reflect.h2"
+#line 4880 "reflect.h2"
     public: [[nodiscard]] auto handle_expression_term(auto const& term) & -> primal_fwd_rws_name;
 
-#line 4926 "reflect.h2"
+#line 4941 "reflect.h2"
     public: auto handle_function_call(cpp2::impl::in<meta::postfix_expression> postfix, cpp2::impl::in<bool> has_return) & -> void;
 
-#line 5106 "reflect.h2"
+#line 5121 "reflect.h2"
     public: [[nodiscard]] auto handle_special_function(cpp2::impl::in<std::string> object, cpp2::impl::in<std::string> object_d, cpp2::impl::in<std::string> object_b, cpp2::impl::in<std::string> function_name, cpp2::impl::in<std::vector<primal_fwd_rws_name>> args) & -> bool;
 
-#line 5151 "reflect.h2"
+#line 5166 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::expression> expr) -> void override;
 
-#line 5155 "reflect.h2"
+#line 5170 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::assignment_expression> binexpr) -> void override;
 
-#line 5159 "reflect.h2"
+#line 5174 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::logical_or_expression> binexpr) -> void override;
 
-#line 5163 "reflect.h2"
+#line 5178 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::logical_and_expression> binexpr) -> void override;
 
-#line 5167 "reflect.h2"
+#line 5182 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::bit_or_expression> binexpr) -> void override;
 
-#line 5171 "reflect.h2"
+#line 5186 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::bit_xor_expression> binexpr) -> void override;
 
-#line 5175 "reflect.h2"
+#line 5190 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::bit_and_expression> binexpr) -> void override;
 
-#line 5179 "reflect.h2"
+#line 5194 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::equality_expression> binexpr) -> void override;
 
-#line 5183 "reflect.h2"
+#line 5198 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::relational_expression> binexpr) -> void override;
 
-#line 5187 "reflect.h2"
+#line 5202 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::compare_expression> binexpr) -> void override;
 
-#line 5191 "reflect.h2"
+#line 5206 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::shift_expression> binexpr) -> void override;
 
-#line 5195 "reflect.h2"
+#line 5210 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::additive_expression> binexpr) -> void override;
 
-#line 5237 "reflect.h2"
+#line 5252 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::multiplicative_expression> binexpr) -> void override;
 
-#line 5324 "reflect.h2"
+#line 5339 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::is_as_expression> isas) -> void override;
 
-#line 5328 "reflect.h2"
+#line 5343 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::prefix_expression> prefix) -> void override;
 
-#line 5344 "reflect.h2"
+#line 5359 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::postfix_expression> postfix) -> void override;
 
-#line 5384 "reflect.h2"
+#line 5399 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::primary_expression> primary) -> void override;
     public: autodiff_expression_handler(autodiff_expression_handler const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(autodiff_expression_handler const&) -> void = delete;
 
 
-#line 5419 "reflect.h2"
+#line 5434 "reflect.h2"
 };
 
 class autodiff_stmt_handler: public simple_traverser, public autodiff_handler_base {
 
-#line 5425 "reflect.h2"
+#line 5440 "reflect.h2"
     public: using base = simple_traverser;
 
     private: meta::function_declaration mf; 
@@ -2131,102 +2137,102 @@ class autodiff_stmt_handler: public simple_traverser, public autodiff_handler_ba
 
     public: autodiff_stmt_handler(cpp2::impl::in<autodiff_context*> ctx_, cpp2::impl::in<meta::function_declaration> mf_);
 
-#line 5439 "reflect.h2"
+#line 5454 "reflect.h2"
     public: [[nodiscard]] auto handle_stmt_parameters(cpp2::impl::in<std::vector<parameter_declaration>> params) & -> autodiff_diff_code;
 
-#line 5481 "reflect.h2"
+#line 5496 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::declaration> decl) -> void override;
 
-#line 5486 "reflect.h2"
+#line 5501 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::function_declaration> f) -> void override;
 
-#line 5491 "reflect.h2"
+#line 5506 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::object_declaration> o) -> void override;
 
-#line 5553 "reflect.h2"
+#line 5568 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::type_declaration> t) -> void override;
 
-#line 5558 "reflect.h2"
+#line 5573 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::parameter_declaration> t) -> void override;
 
-#line 5563 "reflect.h2"
+#line 5578 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::statement> stmt) -> void override;
 
-#line 5570 "reflect.h2"
+#line 5585 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::compound_statement> stmt) -> void override;
 
-#line 5605 "reflect.h2"
+#line 5620 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::return_statement> stmt) -> void override;
 
-#line 5621 "reflect.h2"
+#line 5636 "reflect.h2"
     public: [[nodiscard]] auto reverse_next(cpp2::impl::in<std::string> expr) const& -> std::string;
 
-#line 5636 "reflect.h2"
+#line 5651 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::iteration_statement> stmt) -> void override;
 
-#line 5734 "reflect.h2"
+#line 5749 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::selection_statement> stmt) -> void override;
 
-#line 5745 "reflect.h2"
+#line 5760 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::expression> expr) -> void override;
 
-#line 5749 "reflect.h2"
+#line 5764 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::assignment_expression> binexpr) -> void override;
 
-#line 5800 "reflect.h2"
+#line 5815 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::logical_or_expression> binexpr) -> void override;
 
-#line 5804 "reflect.h2"
+#line 5819 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::logical_and_expression> binexpr) -> void override;
 
-#line 5808 "reflect.h2"
+#line 5823 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::bit_or_expression> binexpr) -> void override;
 
-#line 5812 "reflect.h2"
+#line 5827 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::bit_xor_expression> binexpr) -> void override;
 
-#line 5816 "reflect.h2"
+#line 5831 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::bit_and_expression> binexpr) -> void override;
 
-#line 5820 "reflect.h2"
+#line 5835 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::equality_expression> binexpr) -> void override;
 
-#line 5824 "reflect.h2"
+#line 5839 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::relational_expression> binexpr) -> void override;
 
-#line 5828 "reflect.h2"
+#line 5843 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::compare_expression> binexpr) -> void override;
 
-#line 5832 "reflect.h2"
+#line 5847 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::shift_expression> binexpr) -> void override;
 
-#line 5836 "reflect.h2"
+#line 5851 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::additive_expression> binexpr) -> void override;
 
-#line 5840 "reflect.h2"
+#line 5855 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::multiplicative_expression> binexpr) -> void override;
 
-#line 5844 "reflect.h2"
+#line 5859 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::is_as_expression> isas) -> void override;
 
-#line 5848 "reflect.h2"
+#line 5863 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::prefix_expression> prefix) -> void override;
 
-#line 5853 "reflect.h2"
+#line 5868 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::postfix_expression> postfix) -> void override;
 
-#line 5885 "reflect.h2"
+#line 5900 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::primary_expression> primary) -> void override;
     public: autodiff_stmt_handler(autodiff_stmt_handler const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(autodiff_stmt_handler const&) -> void = delete;
 
 
-#line 5889 "reflect.h2"
+#line 5904 "reflect.h2"
 };
 
 class autodiff_declaration_handler: public simple_traverser, public autodiff_handler_base {
 
-#line 5895 "reflect.h2"
+#line 5910 "reflect.h2"
     public: using base = simple_traverser;
 
     private: meta::type_or_namespace_declaration decl; 
@@ -2236,37 +2242,37 @@ class autodiff_declaration_handler: public simple_traverser, public autodiff_han
 
     public: autodiff_declaration_handler(cpp2::impl::in<autodiff_context*> ctx_, cpp2::impl::in<meta::type_or_namespace_declaration> decl_);
 
-#line 5907 "reflect.h2"
+#line 5922 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::declaration> decl_) -> void override;
 
-#line 5912 "reflect.h2"
+#line 5927 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::function_declaration> f) -> void override;
 
-#line 6070 "reflect.h2"
+#line 6085 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::object_declaration> o) -> void override;
 
-#line 6098 "reflect.h2"
+#line 6113 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::type_declaration> t) -> void override;
 
-#line 6122 "reflect.h2"
+#line 6137 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::parameter_declaration> t) -> void override;
 
-#line 6127 "reflect.h2"
+#line 6142 "reflect.h2"
     public: auto traverse(cpp2::impl::in<meta::statement> stmt) -> void override;
     public: autodiff_declaration_handler(autodiff_declaration_handler const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(autodiff_declaration_handler const&) -> void = delete;
 
 
-#line 6130 "reflect.h2"
+#line 6145 "reflect.h2"
 };
 
-#line 6133 "reflect.h2"
+#line 6148 "reflect.h2"
 auto autodiff(meta::type_declaration& t) -> void;
 
-#line 6239 "reflect.h2"
+#line 6254 "reflect.h2"
 using error_func = std::function<void(cpp2::impl::in<std::string> x)>;
 
-#line 6243 "reflect.h2"
+#line 6258 "reflect.h2"
 class expression_flags
  {
 private: cpp2::u8 _value; private: constexpr expression_flags(cpp2::impl::in<cpp2::i64> _val);
@@ -2301,20 +2307,20 @@ public: [[nodiscard]] auto to_code() const& -> std::string;
 public: [[nodiscard]] static auto from_string(cpp2::impl::in<std::string_view> s) -> expression_flags;
 public: [[nodiscard]] static auto from_code(cpp2::impl::in<std::string_view> s) -> expression_flags;
 
-#line 6251 "reflect.h2"
+#line 6266 "reflect.h2"
 };
 
-#line 6259 "reflect.h2"
+#line 6274 "reflect.h2"
 class regex_token
  {
     public: std::string string_rep; 
 
     public: regex_token(cpp2::impl::in<std::string> str);
 
-#line 6267 "reflect.h2"
+#line 6282 "reflect.h2"
     public: explicit regex_token();
 
-#line 6272 "reflect.h2"
+#line 6287 "reflect.h2"
     public: virtual auto generate_code([[maybe_unused]] generation_context& unnamed_param_2) const -> void = 0;
     public: [[nodiscard]] virtual auto reverse() const -> std::shared_ptr<regex_token> = 0;
 
@@ -2326,103 +2332,103 @@ class regex_token
     public: regex_token(regex_token const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(regex_token const&) -> void = delete;
 
-#line 6278 "reflect.h2"
+#line 6293 "reflect.h2"
 };
 
 using token_ptr = std::shared_ptr<regex_token>;
 using token_vec = std::vector<token_ptr>;
 
-#line 6284 "reflect.h2"
+#line 6299 "reflect.h2"
 //  Adds a check in code generation.
 //
 class regex_token_check
 : public regex_token {
 
-#line 6290 "reflect.h2"
+#line 6305 "reflect.h2"
     private: std::string check; 
 
     public: regex_token_check(cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> check_);
 
-#line 6297 "reflect.h2"
+#line 6312 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 6301 "reflect.h2"
+#line 6316 "reflect.h2"
     public: [[nodiscard]] auto reverse() const -> token_ptr override;
     public: virtual ~regex_token_check() noexcept;
 
     public: regex_token_check(regex_token_check const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(regex_token_check const&) -> void = delete;
 
-#line 6302 "reflect.h2"
+#line 6317 "reflect.h2"
 };
 
-#line 6305 "reflect.h2"
+#line 6320 "reflect.h2"
 //  Adds code in code generation.
 //
 class regex_token_code
 : public regex_token {
 
-#line 6311 "reflect.h2"
+#line 6326 "reflect.h2"
     private: std::string code; 
 
     public: regex_token_code(cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> code_);
 
-#line 6318 "reflect.h2"
+#line 6333 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 6322 "reflect.h2"
+#line 6337 "reflect.h2"
     public: [[nodiscard]] auto reverse() const -> token_ptr override;
     public: virtual ~regex_token_code() noexcept;
 
     public: regex_token_code(regex_token_code const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(regex_token_code const&) -> void = delete;
 
-#line 6323 "reflect.h2"
+#line 6338 "reflect.h2"
 };
 
-#line 6326 "reflect.h2"
+#line 6341 "reflect.h2"
 //  Token that does not influence the matching. E.g. comment.
 //
 class regex_token_empty
 : public regex_token {
 
-#line 6332 "reflect.h2"
+#line 6347 "reflect.h2"
     public: regex_token_empty(cpp2::impl::in<std::string> str);
 
-#line 6336 "reflect.h2"
+#line 6351 "reflect.h2"
     public: auto generate_code([[maybe_unused]] generation_context& unnamed_param_2) const -> void override;
 
-#line 6340 "reflect.h2"
+#line 6355 "reflect.h2"
     public: [[nodiscard]] auto reverse() const -> token_ptr override;
     public: virtual ~regex_token_empty() noexcept;
 
     public: regex_token_empty(regex_token_empty const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(regex_token_empty const&) -> void = delete;
 
-#line 6341 "reflect.h2"
+#line 6356 "reflect.h2"
 };
 
-#line 6344 "reflect.h2"
+#line 6359 "reflect.h2"
 //  Represents a list of regex tokens as one token.
 //
 class regex_token_list
 : public regex_token {
 
-#line 6350 "reflect.h2"
+#line 6365 "reflect.h2"
     public: token_vec tokens; 
 
     public: regex_token_list(cpp2::impl::in<token_vec> t);
 
-#line 6357 "reflect.h2"
+#line 6372 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 6363 "reflect.h2"
+#line 6378 "reflect.h2"
     public: auto add_groups(std::set<int>& groups) const -> void override;
 
-#line 6369 "reflect.h2"
+#line 6384 "reflect.h2"
     public: [[nodiscard]] static auto gen_string(cpp2::impl::in<token_vec> vec) -> std::string;
 
-#line 6377 "reflect.h2"
+#line 6392 "reflect.h2"
     public: [[nodiscard]] auto reverse() const -> token_ptr override;
     public: virtual ~regex_token_list() noexcept;
 
@@ -2430,10 +2436,10 @@ class regex_token_list
     public: auto operator=(regex_token_list const&) -> void = delete;
 
 
-#line 6389 "reflect.h2"
+#line 6404 "reflect.h2"
 };
 
-#line 6392 "reflect.h2"
+#line 6407 "reflect.h2"
 //
 //  Parse and generation context.
 //
@@ -2449,33 +2455,33 @@ class parse_context_group_state
     //  Start a new alternative.
     public: auto next_alternative() & -> void;
 
-#line 6412 "reflect.h2"
+#line 6427 "reflect.h2"
     //  Swap this state with the other one. NOLINTNEXTLINE(performance-noexcept-swap)
     public: auto swap(parse_context_group_state& t) & -> void;
 
-#line 6419 "reflect.h2"
+#line 6434 "reflect.h2"
     //  Convert this state into a regex token.
     public: [[nodiscard]] auto get_as_token() & -> token_ptr;
 
-#line 6431 "reflect.h2"
+#line 6446 "reflect.h2"
     //  Add a token to the current matcher list.
     public: auto add(cpp2::impl::in<token_ptr> token) & -> void;
 
-#line 6436 "reflect.h2"
+#line 6451 "reflect.h2"
     //  True if current matcher list is empty.
     public: [[nodiscard]] auto empty() const& -> bool;
 
-#line 6440 "reflect.h2"
+#line 6455 "reflect.h2"
     //  Apply optimizations to the matcher list.
     public: static auto post_process_list(token_vec& list) -> void;
     public: parse_context_group_state(auto const& cur_match_list_, auto const& alternate_match_lists_, auto const& modifiers_);
 public: parse_context_group_state();
 
 
-#line 6454 "reflect.h2"
+#line 6469 "reflect.h2"
 };
 
-#line 6457 "reflect.h2"
+#line 6472 "reflect.h2"
 //  State for the branch reset. Takes care of the group numbering. See '(|<pattern>)'.
 //
 class parse_context_branch_reset_state
@@ -2488,25 +2494,25 @@ class parse_context_branch_reset_state
     //  Next group identifier.
     public: [[nodiscard]] auto next() & -> int;
 
-#line 6475 "reflect.h2"
+#line 6490 "reflect.h2"
     //  Set next group identifier.
     public: auto set_next(cpp2::impl::in<int> g) & -> void;
 
-#line 6481 "reflect.h2"
+#line 6496 "reflect.h2"
     //  Start a new alternative branch.
     public: auto next_alternative() & -> void;
 
-#line 6488 "reflect.h2"
+#line 6503 "reflect.h2"
     //  Initialize for a branch reset group.
     public: auto set_active_reset(cpp2::impl::in<int> restart) & -> void;
     public: parse_context_branch_reset_state(auto const& is_active_, auto const& cur_group_, auto const& max_group_, auto const& from_);
 public: parse_context_branch_reset_state();
 
 
-#line 6495 "reflect.h2"
+#line 6510 "reflect.h2"
 };
 
-#line 6498 "reflect.h2"
+#line 6513 "reflect.h2"
 //  Context during parsing of the regular expressions.
 // 
 //  Keeps track of the distributed group identifiers, current parsed group and branch resets.
@@ -2522,7 +2528,7 @@ class parse_context
     private: parse_context_group_state cur_group_state {}; 
     private: parse_context_branch_reset_state cur_branch_reset_state {}; 
 
-#line 6514 "reflect.h2"
+#line 6529 "reflect.h2"
            public: std::map<std::string,int> named_groups {}; 
 
     private: error_func error_out; // TODO: Declaring std::function<void(std::string)> fails for cpp2.
@@ -2530,64 +2536,64 @@ class parse_context
 
     public: parse_context(cpp2::impl::in<std::string_view> r, auto const& e);
 
-#line 6525 "reflect.h2"
+#line 6540 "reflect.h2"
     //  State management functions
     //
 
     //  Returned group state needs to be stored and provided in `end_group`.
     public: [[nodiscard]] auto start_group() & -> parse_context_group_state;
 
-#line 6538 "reflect.h2"
+#line 6553 "reflect.h2"
     //  `old_state` argument needs to be from start group.
     public: [[nodiscard]] auto end_group(cpp2::impl::in<parse_context_group_state> old_state) & -> token_ptr;
 
-#line 6546 "reflect.h2"
+#line 6561 "reflect.h2"
     public: [[nodiscard]] auto get_modifiers() const& -> expression_flags;
 
-#line 6550 "reflect.h2"
+#line 6565 "reflect.h2"
     public: auto set_modifiers(cpp2::impl::in<expression_flags> mod) & -> void;
 
-#line 6554 "reflect.h2"
+#line 6569 "reflect.h2"
     //  Branch reset management functions
     //
 
     public: [[nodiscard]] auto branch_reset_new_state() & -> parse_context_branch_reset_state;
 
-#line 6566 "reflect.h2"
+#line 6581 "reflect.h2"
     public: auto branch_reset_restore_state(cpp2::impl::in<parse_context_branch_reset_state> old_state) & -> void;
 
-#line 6573 "reflect.h2"
+#line 6588 "reflect.h2"
     public: auto next_alternative() & -> void;
 
-#line 6579 "reflect.h2"
+#line 6594 "reflect.h2"
     //  Regex token management
     //
     public: auto add_token(cpp2::impl::in<token_ptr> token) & -> void;
 
-#line 6585 "reflect.h2"
+#line 6600 "reflect.h2"
     public: [[nodiscard]] auto has_token() const& -> bool;
 
-#line 6589 "reflect.h2"
+#line 6604 "reflect.h2"
     public: [[nodiscard]] auto pop_token() & -> token_ptr;
 
-#line 6600 "reflect.h2"
+#line 6615 "reflect.h2"
     public: [[nodiscard]] auto get_as_token() & -> token_ptr;
 
-#line 6604 "reflect.h2"
+#line 6619 "reflect.h2"
     //  Group management
     //
     public: [[nodiscard]] auto get_cur_group() const& -> int;
 
-#line 6610 "reflect.h2"
+#line 6625 "reflect.h2"
     public: [[nodiscard]] auto next_group() & -> int;
 
-#line 6614 "reflect.h2"
+#line 6629 "reflect.h2"
     public: auto set_named_group(cpp2::impl::in<std::string> name, cpp2::impl::in<int> id) & -> void;
 
-#line 6621 "reflect.h2"
+#line 6636 "reflect.h2"
     public: [[nodiscard]] auto get_named_group(cpp2::impl::in<std::string> name) const& -> int;
 
-#line 6632 "reflect.h2"
+#line 6647 "reflect.h2"
     //  Position management functions
     //
     public: [[nodiscard]] auto current() const& -> char;
@@ -2595,51 +2601,51 @@ class parse_context
     //  Get the next token in the regex, skipping spaces according to the parameters. See `x` and `xx` modifiers.
     private: [[nodiscard]] auto get_next_position(cpp2::impl::in<bool> in_class, cpp2::impl::in<bool> no_skip) const& -> size_t;
 
-#line 6676 "reflect.h2"
+#line 6691 "reflect.h2"
     //  Return true if next token is available.
     private: [[nodiscard]] auto next_impl(cpp2::impl::in<bool> in_class, cpp2::impl::in<bool> no_skip) & -> bool;
 
-#line 6688 "reflect.h2"
+#line 6703 "reflect.h2"
     public: [[nodiscard]] auto next() & -> decltype(auto);
     public: [[nodiscard]] auto next_in_class() & -> decltype(auto);
     public: [[nodiscard]] auto next_no_skip() & -> decltype(auto);
 
     public: [[nodiscard]] auto next_n(cpp2::impl::in<int> n) & -> bool;
 
-#line 6701 "reflect.h2"
+#line 6716 "reflect.h2"
     public: [[nodiscard]] auto has_next() const& -> bool;
 
     private: [[nodiscard]] auto grab_until_impl(cpp2::impl::in<std::string> e, cpp2::impl::out<std::string> r, cpp2::impl::in<bool> any) & -> bool;
 
-#line 6724 "reflect.h2"
+#line 6739 "reflect.h2"
     public: [[nodiscard]] auto grab_until(cpp2::impl::in<std::string> e, cpp2::impl::out<std::string> r) & -> decltype(auto);
     public: [[nodiscard]] auto grab_until(cpp2::impl::in<char> e, cpp2::impl::out<std::string> r) & -> decltype(auto);
     public: [[nodiscard]] auto grab_until_one_of(cpp2::impl::in<std::string> e, cpp2::impl::out<std::string> r) & -> decltype(auto);
 
     public: [[nodiscard]] auto grab_n(cpp2::impl::in<int> n, cpp2::impl::out<std::string> r) & -> bool;
 
-#line 6741 "reflect.h2"
+#line 6756 "reflect.h2"
     public: [[nodiscard]] auto grab_number() & -> std::string;
 
-#line 6762 "reflect.h2"
+#line 6777 "reflect.h2"
     private: [[nodiscard]] auto peek_impl(cpp2::impl::in<bool> in_class) const& -> char;
 
-#line 6772 "reflect.h2"
+#line 6787 "reflect.h2"
     public: [[nodiscard]] auto peek() const& -> decltype(auto);
     public: [[nodiscard]] auto peek_in_class() const& -> decltype(auto);
 
-#line 6776 "reflect.h2"
+#line 6791 "reflect.h2"
     //  Parsing functions
     //
     public: [[nodiscard]] auto parser_group_modifiers(cpp2::impl::in<std::string> change_str, expression_flags& parser_modifiers) & -> bool;
 
-#line 6832 "reflect.h2"
+#line 6847 "reflect.h2"
     public: [[nodiscard]] auto parse_until(cpp2::impl::in<char> term) & -> bool;
 
-#line 6871 "reflect.h2"
+#line 6886 "reflect.h2"
     public: [[nodiscard]] auto parse(cpp2::impl::in<std::string> modifiers) & -> bool;
 
-#line 6886 "reflect.h2"
+#line 6901 "reflect.h2"
     //  Misc functions
 
     public: [[nodiscard]] auto get_pos() const& -> decltype(auto);
@@ -2651,10 +2657,10 @@ class parse_context
     public: auto operator=(parse_context const&) -> void = delete;
 
 
-#line 6897 "reflect.h2"
+#line 6912 "reflect.h2"
 };
 
-#line 6900 "reflect.h2"
+#line 6915 "reflect.h2"
 //  Context for one function generation. Generation of functions can be interleaved,
 //  therefore we buffer the code for one function here.
 //
@@ -2664,16 +2670,16 @@ class generation_function_context {
 
     public: auto add_tabs(cpp2::impl::in<int> c) & -> void;
 
-#line 6914 "reflect.h2"
+#line 6929 "reflect.h2"
     public: auto remove_tabs(cpp2::impl::in<int> c) & -> void;
     public: generation_function_context(auto const& code_, auto const& tabs_);
 public: generation_function_context();
 
 
-#line 6917 "reflect.h2"
+#line 6932 "reflect.h2"
 };
 
-#line 6920 "reflect.h2"
+#line 6935 "reflect.h2"
 //  Context for generating the state machine.
 class generation_context
  {
@@ -2693,68 +2699,68 @@ class generation_context
     //  Add code line.
     public: auto add(cpp2::impl::in<std::string> s) & -> void;
 
-#line 6942 "reflect.h2"
+#line 6957 "reflect.h2"
     //  Add check for token. The check needs to be a function call that returns a boolean.
     public: auto add_check(cpp2::impl::in<std::string> check) & -> void;
 
-#line 6948 "reflect.h2"
+#line 6963 "reflect.h2"
     //  Add a stateful check. The check needs to return a `match_return`.
     public: auto add_statefull(cpp2::impl::in<std::string> next_func, cpp2::impl::in<std::string> check) & -> void;
 
-#line 6957 "reflect.h2"
+#line 6972 "reflect.h2"
     protected: auto start_func_named(cpp2::impl::in<std::string> name) & -> void;
 
-#line 6968 "reflect.h2"
+#line 6983 "reflect.h2"
     protected: [[nodiscard]] auto start_func() & -> std::string;
 
-#line 6975 "reflect.h2"
+#line 6990 "reflect.h2"
     protected: auto end_func_statefull(cpp2::impl::in<std::string> s) & -> void;
 
-#line 6995 "reflect.h2"
+#line 7010 "reflect.h2"
     //  Generate the function for a token.
     public: [[nodiscard]] auto generate_func(cpp2::impl::in<token_ptr> token) & -> std::string;
 
-#line 7005 "reflect.h2"
+#line 7020 "reflect.h2"
     //  Generate the reset for a list of group identifiers.
     public: [[nodiscard]] auto generate_reset(cpp2::impl::in<std::set<int>> groups) & -> std::string;
 
-#line 7028 "reflect.h2"
+#line 7043 "reflect.h2"
     //  Name generation
     //
     protected: [[nodiscard]] auto gen_func_name() & -> std::string;
 
-#line 7036 "reflect.h2"
+#line 7051 "reflect.h2"
     public: [[nodiscard]] auto next_func_name() & -> std::string;
 
-#line 7040 "reflect.h2"
+#line 7055 "reflect.h2"
     protected: [[nodiscard]] auto gen_reset_func_name() & -> std::string;
 
-#line 7046 "reflect.h2"
+#line 7061 "reflect.h2"
     public: [[nodiscard]] auto gen_temp() & -> std::string;
 
-#line 7052 "reflect.h2"
+#line 7067 "reflect.h2"
     //  Context management
     //
     public: [[nodiscard]] auto new_context() & -> generation_function_context*;
 
-#line 7062 "reflect.h2"
+#line 7077 "reflect.h2"
     public: auto finish_context() & -> void;
 
-#line 7070 "reflect.h2"
+#line 7085 "reflect.h2"
     //  Misc functions
     //
     private: [[nodiscard]] auto get_current() & -> generation_function_context*;
 
-#line 7076 "reflect.h2"
+#line 7091 "reflect.h2"
     private: [[nodiscard]] auto get_base() & -> generation_function_context*;
 
-#line 7080 "reflect.h2"
+#line 7095 "reflect.h2"
     public: [[nodiscard]] auto get_entry_func() const& -> std::string;
 
-#line 7084 "reflect.h2"
+#line 7099 "reflect.h2"
     public: [[nodiscard]] auto create_named_group_lookup(cpp2::impl::in<std::map<std::string,int>> named_groups) const& -> std::string;
 
-#line 7108 "reflect.h2"
+#line 7123 "reflect.h2"
     //  Run the generation for the token.
     public: [[nodiscard]] auto run(cpp2::impl::in<token_ptr> token) & -> std::string;
     public: generation_context() = default;
@@ -2762,7 +2768,7 @@ class generation_context
     public: auto operator=(generation_context const&) -> void = delete;
 
 
-#line 7114 "reflect.h2"
+#line 7129 "reflect.h2"
 };
 
 //  Regex syntax: |  Example: ab|ba
@@ -2782,27 +2788,27 @@ class alternative_token
     public: auto operator=(alternative_token const&) -> void = delete;
 
 
-#line 7133 "reflect.h2"
+#line 7148 "reflect.h2"
 };
 
 class alternative_token_gen
 : public regex_token {
 
-#line 7139 "reflect.h2"
+#line 7154 "reflect.h2"
     private: token_vec alternatives; 
 
     public: alternative_token_gen(cpp2::impl::in<token_vec> a);
 
-#line 7146 "reflect.h2"
+#line 7161 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 7163 "reflect.h2"
+#line 7178 "reflect.h2"
     public: auto add_groups(std::set<int>& groups) const -> void override;
 
-#line 7170 "reflect.h2"
+#line 7185 "reflect.h2"
     public: [[nodiscard]] static auto gen_string(cpp2::impl::in<token_vec> a) -> std::string;
 
-#line 7183 "reflect.h2"
+#line 7198 "reflect.h2"
     public: [[nodiscard]] auto reverse() const -> token_ptr override;
     public: virtual ~alternative_token_gen() noexcept;
 
@@ -2810,19 +2816,19 @@ class alternative_token_gen
     public: auto operator=(alternative_token_gen const&) -> void = delete;
 
 
-#line 7195 "reflect.h2"
+#line 7210 "reflect.h2"
 };
 
-#line 7198 "reflect.h2"
+#line 7213 "reflect.h2"
 //  Regex syntax: .
 //
 class any_token
 : public regex_token_check {
 
-#line 7204 "reflect.h2"
+#line 7219 "reflect.h2"
     public: any_token(cpp2::impl::in<bool> single_line);
 
-#line 7208 "reflect.h2"
+#line 7223 "reflect.h2"
     public: [[nodiscard]] static auto parse(parse_context& ctx) -> token_ptr;
     public: virtual ~any_token() noexcept;
 
@@ -2830,7 +2836,7 @@ class any_token
     public: auto operator=(any_token const&) -> void = delete;
 
 
-#line 7213 "reflect.h2"
+#line 7228 "reflect.h2"
 };
 
 //  Regex syntax: (?><matcher>)  Example: a(?>bc|c)c
@@ -2838,17 +2844,17 @@ class any_token
 class atomic_group_token
 : public regex_token {
 
-#line 7221 "reflect.h2"
+#line 7236 "reflect.h2"
             public: token_ptr inner_token {nullptr}; 
 
     public: explicit atomic_group_token();
 
     public: [[nodiscard]] auto reverse() const -> token_ptr override;
 
-#line 7232 "reflect.h2"
+#line 7247 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 7240 "reflect.h2"
+#line 7255 "reflect.h2"
     public: auto add_groups(std::set<int>& groups) const -> void override;
     public: virtual ~atomic_group_token() noexcept;
 
@@ -2856,7 +2862,7 @@ class atomic_group_token
     public: auto operator=(atomic_group_token const&) -> void = delete;
 
 
-#line 7243 "reflect.h2"
+#line 7258 "reflect.h2"
 };
 
 //  Regex syntax: a
@@ -2864,34 +2870,34 @@ class atomic_group_token
 class char_token
 : public regex_token {
 
-#line 7251 "reflect.h2"
+#line 7266 "reflect.h2"
     private: std::string token; 
     private: bool ignore_case; 
 
     public: char_token(cpp2::impl::in<char> t, cpp2::impl::in<bool> ignore_case_);
 
-#line 7260 "reflect.h2"
+#line 7275 "reflect.h2"
     public: char_token(cpp2::impl::in<std::string> t, cpp2::impl::in<bool> ignore_case_);
 
-#line 7266 "reflect.h2"
+#line 7281 "reflect.h2"
     public: [[nodiscard]] static auto parse(parse_context& ctx) -> token_ptr;
 
-#line 7270 "reflect.h2"
+#line 7285 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 7293 "reflect.h2"
+#line 7308 "reflect.h2"
     public: auto gen_case_insensitive(cpp2::impl::in<std::string> lower, cpp2::impl::in<std::string> upper, generation_context& ctx) const& -> void;
 
-#line 7314 "reflect.h2"
+#line 7329 "reflect.h2"
     public: auto gen_case_sensitive(generation_context& ctx) const& -> void;
 
-#line 7332 "reflect.h2"
+#line 7347 "reflect.h2"
     public: [[nodiscard]] auto add_escapes(std::string str) const& -> std::string;
 
-#line 7347 "reflect.h2"
+#line 7362 "reflect.h2"
     public: [[nodiscard]] auto reverse() const -> token_ptr override;
 
-#line 7353 "reflect.h2"
+#line 7368 "reflect.h2"
     public: auto append(char_token const& that) & -> void;
     public: virtual ~char_token() noexcept;
 
@@ -2899,33 +2905,33 @@ class char_token
     public: auto operator=(char_token const&) -> void = delete;
 
 
-#line 7357 "reflect.h2"
+#line 7372 "reflect.h2"
 };
 
-#line 7360 "reflect.h2"
+#line 7375 "reflect.h2"
 //  Regex syntax: [<character classes>]  Example: [abcx-y[:digits:]]
 //
 class class_token
 : public regex_token {
 
-#line 7366 "reflect.h2"
+#line 7381 "reflect.h2"
     private: bool negate; 
     private: bool case_insensitive; 
     private: std::string class_str; 
 
     public: class_token(cpp2::impl::in<bool> negate_, cpp2::impl::in<bool> case_insensitive_, cpp2::impl::in<std::string> class_str_, cpp2::impl::in<std::string> str);
 
-#line 7378 "reflect.h2"
+#line 7393 "reflect.h2"
     //  TODO: Rework class generation: Generate check functions for classes.
     public: [[nodiscard]] static auto parse(parse_context& ctx) -> token_ptr;
 
-#line 7504 "reflect.h2"
+#line 7519 "reflect.h2"
     public: [[nodiscard]] auto reverse() const -> token_ptr override;
 
-#line 7513 "reflect.h2"
+#line 7528 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 7518 "reflect.h2"
+#line 7533 "reflect.h2"
     private: [[nodiscard]] static auto create_matcher(cpp2::impl::in<std::string> name, cpp2::impl::in<std::string> template_arguments) -> std::string;
     public: virtual ~class_token() noexcept;
 
@@ -2933,20 +2939,20 @@ class class_token
     public: auto operator=(class_token const&) -> void = delete;
 
 
-#line 7525 "reflect.h2"
+#line 7540 "reflect.h2"
 };
 
-#line 7528 "reflect.h2"
+#line 7543 "reflect.h2"
 //  Regex syntax: \a or \n or \[
 //
 [[nodiscard]] auto escape_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 7569 "reflect.h2"
+#line 7584 "reflect.h2"
 //  Regex syntax: \K Example: ab\Kcd
 //
 [[nodiscard]] auto global_group_reset_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 7580 "reflect.h2"
+#line 7595 "reflect.h2"
 //  Regex syntax: \<number>  Example: \1
 //                \g{name_or_number}
 //                \k{name_or_number}
@@ -2956,20 +2962,20 @@ class class_token
 class group_ref_token
 : public regex_token {
 
-#line 7590 "reflect.h2"
+#line 7605 "reflect.h2"
     private: int id; 
     private: bool case_insensitive; 
     private: bool reverse_eval; 
 
     public: group_ref_token(cpp2::impl::in<int> id_, cpp2::impl::in<bool> case_insensitive_, cpp2::impl::in<bool> reverse_, cpp2::impl::in<std::string> str);
 
-#line 7602 "reflect.h2"
+#line 7617 "reflect.h2"
     public: [[nodiscard]] static auto parse(parse_context& ctx) -> token_ptr;
 
-#line 7703 "reflect.h2"
+#line 7718 "reflect.h2"
     public: [[nodiscard]] auto reverse() const -> token_ptr override;
 
-#line 7707 "reflect.h2"
+#line 7722 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
     public: virtual ~group_ref_token() noexcept;
 
@@ -2977,10 +2983,10 @@ class group_ref_token
     public: auto operator=(group_ref_token const&) -> void = delete;
 
 
-#line 7710 "reflect.h2"
+#line 7725 "reflect.h2"
 };
 
-#line 7713 "reflect.h2"
+#line 7728 "reflect.h2"
 //  Regex syntax: (<tokens>)      Example: (abc)
 //                (?<modifiers)            (?i)
 //                (?<modifiers>:<tokens>)  (?i:abc)
@@ -2994,29 +3000,29 @@ class group_ref_token
 class group_token
 : public regex_token {
 
-#line 7727 "reflect.h2"
+#line 7742 "reflect.h2"
     private: int number {-1}; 
     private: bool reverse_eval {false}; 
     private: token_ptr inner {nullptr}; 
 
     public: [[nodiscard]] static auto parse_lookahead_lookbehind(parse_context& ctx, cpp2::impl::in<std::string> syntax, cpp2::impl::in<bool> lookahead, cpp2::impl::in<bool> positive) -> token_ptr;
 
-#line 7749 "reflect.h2"
+#line 7764 "reflect.h2"
     public: [[nodiscard]] static auto parse_atomic_pattern(parse_context& ctx, cpp2::impl::in<std::string> syntax) -> token_ptr;
 
-#line 7763 "reflect.h2"
+#line 7778 "reflect.h2"
     public: [[nodiscard]] static auto parse(parse_context& ctx) -> token_ptr;
 
-#line 7922 "reflect.h2"
+#line 7937 "reflect.h2"
     public: [[nodiscard]] auto reverse() const -> token_ptr override;
 
-#line 7930 "reflect.h2"
+#line 7945 "reflect.h2"
     public: [[nodiscard]] static auto gen_string(cpp2::impl::in<std::string> name, cpp2::impl::in<bool> name_brackets, cpp2::impl::in<bool> has_modifier, cpp2::impl::in<std::string> modifiers, cpp2::impl::in<token_ptr> inner_) -> std::string;
 
-#line 7948 "reflect.h2"
+#line 7963 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 7979 "reflect.h2"
+#line 7994 "reflect.h2"
     public: auto add_groups(std::set<int>& groups) const -> void override;
     public: virtual ~group_token() noexcept;
 
@@ -3025,25 +3031,25 @@ class group_token
     public: auto operator=(group_token const&) -> void = delete;
 
 
-#line 7986 "reflect.h2"
+#line 8001 "reflect.h2"
 };
 
-#line 7989 "reflect.h2"
+#line 8004 "reflect.h2"
 //  Regex syntax: \x<number> or \x{<number>}  Example: \x{62}
 //
 [[nodiscard]] auto hexadecimal_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 8030 "reflect.h2"
+#line 8045 "reflect.h2"
 //  Regex syntax: $  Example: aa$
 //
 [[nodiscard]] auto line_end_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 8050 "reflect.h2"
+#line 8065 "reflect.h2"
 //  Regex syntax: ^  Example: ^aa
 //
 [[nodiscard]] auto line_start_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 8066 "reflect.h2"
+#line 8081 "reflect.h2"
 //  Regex syntax: (?=) or (?!) or (*pla), etc.  Example: (?=AA)
 //
 //  Parsed in group_token.
@@ -3051,20 +3057,20 @@ class group_token
 class lookahead_lookbehind_token
 : public regex_token {
 
-#line 8074 "reflect.h2"
+#line 8089 "reflect.h2"
     protected: bool lookahead; 
     protected: bool positive; 
     public:   token_ptr inner {nullptr}; 
 
     public: lookahead_lookbehind_token(cpp2::impl::in<bool> lookahead_, cpp2::impl::in<bool> positive_);
 
-#line 8083 "reflect.h2"
+#line 8098 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 8094 "reflect.h2"
+#line 8109 "reflect.h2"
     public: [[nodiscard]] auto reverse() const -> token_ptr override;
 
-#line 8101 "reflect.h2"
+#line 8116 "reflect.h2"
     public: auto add_groups(std::set<int>& groups) const -> void override;
     public: virtual ~lookahead_lookbehind_token() noexcept;
 
@@ -3072,26 +3078,26 @@ class lookahead_lookbehind_token
     public: auto operator=(lookahead_lookbehind_token const&) -> void = delete;
 
 
-#line 8104 "reflect.h2"
+#line 8119 "reflect.h2"
 };
 
-#line 8107 "reflect.h2"
+#line 8122 "reflect.h2"
 // Named character classes
 //
 [[nodiscard]] auto named_class_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 8135 "reflect.h2"
+#line 8150 "reflect.h2"
 //  Regex syntax: \o{<number>}  Example: \o{142}
 //
 [[nodiscard]] auto octal_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 8163 "reflect.h2"
+#line 8178 "reflect.h2"
 //  Regex syntax: <matcher>{min, max}  Example: a{2,4}
 //
 class range_token
 : public regex_token {
 
-#line 8169 "reflect.h2"
+#line 8184 "reflect.h2"
               protected: int min_count {-1}; 
               protected: int max_count {-1}; 
               protected: int kind {range_flags::greedy}; 
@@ -3101,22 +3107,22 @@ class range_token
 
     public: [[nodiscard]] static auto parse(parse_context& ctx) -> token_ptr;
 
-#line 8249 "reflect.h2"
+#line 8264 "reflect.h2"
     public: auto parse_modifier(parse_context& ctx) & -> void;
 
-#line 8261 "reflect.h2"
+#line 8276 "reflect.h2"
     public: [[nodiscard]] auto gen_mod_string() const& -> std::string;
 
-#line 8274 "reflect.h2"
+#line 8289 "reflect.h2"
     public: [[nodiscard]] auto gen_range_string() const& -> std::string;
 
-#line 8293 "reflect.h2"
+#line 8308 "reflect.h2"
     public: [[nodiscard]] auto reverse() const -> token_ptr override;
 
-#line 8303 "reflect.h2"
+#line 8318 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 8314 "reflect.h2"
+#line 8329 "reflect.h2"
     public: auto add_groups(std::set<int>& groups) const -> void override;
     public: virtual ~range_token() noexcept;
 
@@ -3124,16 +3130,16 @@ class range_token
     public: auto operator=(range_token const&) -> void = delete;
 
 
-#line 8317 "reflect.h2"
+#line 8332 "reflect.h2"
 };
 
-#line 8320 "reflect.h2"
+#line 8335 "reflect.h2"
 //  Regex syntax: *, +, or ?  Example: aa*
 //
 class special_range_token
 : public range_token {
 
-#line 8326 "reflect.h2"
+#line 8341 "reflect.h2"
     public: [[nodiscard]] static auto parse(parse_context& ctx) -> token_ptr;
     public: virtual ~special_range_token() noexcept;
 
@@ -3142,7 +3148,7 @@ class special_range_token
     public: auto operator=(special_range_token const&) -> void = delete;
 
 
-#line 8356 "reflect.h2"
+#line 8371 "reflect.h2"
 };
 
 //  Regex syntax: \G  Example: \Gaa
@@ -3151,14 +3157,14 @@ class special_range_token
 //
 [[nodiscard]] auto start_match_parse(parse_context& ctx) -> token_ptr;
 
-#line 8378 "reflect.h2"
+#line 8393 "reflect.h2"
 //  Regex syntax: \b or \B  Example: \bword\b
 //
 //  Matches the start end end of word boundaries.
 //
 [[nodiscard]] auto word_boundary_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 8400 "reflect.h2"
+#line 8415 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  Parser for regular expression.
@@ -3179,24 +3185,24 @@ template<typename Error_out> class regex_generator
 
     public: regex_generator(cpp2::impl::in<std::string_view> r, Error_out const& e);
 
-#line 8423 "reflect.h2"
+#line 8438 "reflect.h2"
     public: [[nodiscard]] auto parse() & -> std::string;
 
-#line 8458 "reflect.h2"
+#line 8473 "reflect.h2"
     private: auto extract_modifiers() & -> void;
     public: regex_generator(regex_generator const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(regex_generator const&) -> void = delete;
 
 
-#line 8472 "reflect.h2"
+#line 8487 "reflect.h2"
 };
 
 template<typename Err> [[nodiscard]] auto generate_regex(cpp2::impl::in<std::string_view> regex, Err const& err) -> std::string;
 
-#line 8484 "reflect.h2"
+#line 8499 "reflect.h2"
 auto regex_gen(meta::type_declaration& t) -> void;
 
-#line 8539 "reflect.h2"
+#line 8554 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  apply_metafunctions
@@ -3207,7 +3213,7 @@ auto regex_gen(meta::type_declaration& t) -> void;
     auto const& error
     ) -> bool;
 
-#line 8671 "reflect.h2"
+#line 8688 "reflect.h2"
 }
 
 }
@@ -3294,7 +3300,19 @@ namespace meta {
 #line 92 "reflect.h2"
     [[nodiscard]] auto compiler_services::arguments_were_used() const& -> bool { return metafunctions_used;  }
 
-#line 94 "reflect.h2"
+    //  Parse function n's body, which was skipped to be parsed later
+    //  (see parser::defer_function_bodies), so that it can be reflected on
+    //
+#line 97 "reflect.h2"
+    auto compiler_services::parse_deferred_body(
+
+        cpp2::impl::in<declaration_node> n
+    ) & -> void
+    {
+        static_cast<void>(CPP2_UFCS(parse_deferred_body)(parser, n, *cpp2::impl::assert_not_null(generated_tokens)));
+    }
+
+#line 105 "reflect.h2"
     [[nodiscard]] auto compiler_services::parse_statement(
 
         std::string_view source
@@ -3302,7 +3320,7 @@ namespace meta {
 
     {
             cpp2::impl::deferred_init<std::unique_ptr<statement_node>> ret;
-#line 100 "reflect.h2"
+#line 111 "reflect.h2"
         auto original_source {source}; 
 
         CPP2_UFCS(push_back)(generated_lines, std::vector<source_line>());
@@ -3317,7 +3335,7 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
         //  First split this string into source_lines
         //
 
-#line 112 "reflect.h2"
+#line 123 "reflect.h2"
         if ( cpp2::impl::cmp_greater(CPP2_UFCS(ssize)(source),1) 
             && newline_pos != source.npos) 
         {
@@ -3330,24 +3348,24 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
         }
 }
 
-#line 123 "reflect.h2"
+#line 134 "reflect.h2"
         if (!(CPP2_UFCS(empty)(source))) {
             cpp2::move(add_line)(cpp2::move(source));
         }
 
         //  Now lex this source fragment to generate
-        //  a single grammar_map entry, whose .second
-        //  is the vector of tokens
+        //  a single token section, whose .tokens
+        //  are the tokens to parse
         static_cast<void>(CPP2_UFCS(emplace_back)(generated_lexers, *cpp2::impl::assert_not_null(errors)));
         auto tokens {&CPP2_UFCS(back)(generated_lexers)}; 
         CPP2_UFCS(lex)((*cpp2::impl::assert_not_null(tokens)), *cpp2::impl::assert_not_null(cpp2::move(lines)), true);
 
-        if (cpp2::cpp2_default.is_active() && !(std::ssize(CPP2_UFCS(get_map)((*cpp2::impl::assert_not_null(tokens)))) == 1) ) { cpp2::cpp2_default.report_violation(""); }
+        if (cpp2::cpp2_default.is_active() && !(std::ssize(CPP2_UFCS(get_sections)((*cpp2::impl::assert_not_null(tokens)))) == 1) ) { cpp2::cpp2_default.report_violation(""); }
 
         //  Now parse this single declaration from
         //  the lexed tokens
         ret.construct(CPP2_UFCS(parse_one_declaration)(parser, 
-                (*cpp2::impl::assert_not_null(CPP2_UFCS(begin)(CPP2_UFCS(get_map)(*cpp2::impl::assert_not_null(cpp2::move(tokens)))))).second, 
+                CPP2_UFCS(front)(CPP2_UFCS(get_sections)((*cpp2::impl::assert_not_null(cpp2::move(tokens))))).tokens, 
                 *cpp2::impl::assert_not_null(generated_tokens)
               ));
         if (!(ret.value())) {
@@ -3355,7 +3373,7 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
         }return std::move(ret.value()); 
     }
 
-#line 147 "reflect.h2"
+#line 158 "reflect.h2"
     auto compiler_services::add_runtime_support_include(cpp2::impl::in<std::string_view> s, cpp2::impl::in<bool> angles) & -> void{
         std::string inc {s}; 
         if (angles) {
@@ -3367,12 +3385,12 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
         static_cast<void>(CPP2_UFCS(emplace)((*cpp2::impl::assert_not_null(includes)), cpp2::move(inc)));
     }
 
-#line 158 "reflect.h2"
+#line 169 "reflect.h2"
     [[nodiscard]] auto compiler_services::add_extra_cpp1_code(cpp2::impl::in<std::string> s) & -> decltype(auto) { return CPP2_UFCS(push_back)((*cpp2::impl::assert_not_null(extra_cpp1)), s);  }
-#line 159 "reflect.h2"
+#line 170 "reflect.h2"
     [[nodiscard]] auto compiler_services::add_extra_build_step(cpp2::impl::in<std::string> s) & -> decltype(auto) { return CPP2_UFCS(push_back)((*cpp2::impl::assert_not_null(extra_build)), s + "\n");  }
 
-#line 161 "reflect.h2"
+#line 172 "reflect.h2"
     [[nodiscard]] auto compiler_services::position() const -> source_position
 
     {
@@ -3382,7 +3400,7 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
     //  Error diagnosis and handling, integrated with compiler output
     //  Unlike a contract violation, .requires continues further processing
     //
-#line 170 "reflect.h2"
+#line 181 "reflect.h2"
     auto compiler_services::require(
 
         cpp2::impl::in<bool> b, 
@@ -3394,7 +3412,7 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
         }
     }
 
-#line 181 "reflect.h2"
+#line 192 "reflect.h2"
     auto compiler_services::error(cpp2::impl::in<std::string_view> msg) const& -> void
     {
         auto message {cpp2::impl::as_<std::string>(msg)}; 
@@ -3407,7 +3425,7 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
     //  Enable custom contracts on this object, integrated with compiler output
     //  Unlike .requires, a contract violation stops further processing
     //
-#line 193 "reflect.h2"
+#line 204 "reflect.h2"
     auto compiler_services::report_violation(auto const& msg) const& -> void{
         error(msg);
         throw(std::runtime_error(
@@ -3416,7 +3434,7 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
         ));
     }
 
-#line 201 "reflect.h2"
+#line 212 "reflect.h2"
     [[nodiscard]] auto compiler_services::is_active() const& -> decltype(auto) { return true;  }
 
     compiler_services::~compiler_services() noexcept{}
@@ -3445,7 +3463,7 @@ compiler_services::compiler_services(compiler_services&& that) noexcept
                                      , metafunction_args{ std::move(that).metafunction_args }
                                      , metafunctions_used{ std::move(that).metafunctions_used }{}
 
-#line 205 "reflect.h2"
+#line 216 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  All reflection types are wrappers around a pointer to node
@@ -3453,7 +3471,7 @@ compiler_services::compiler_services(compiler_services&& that) noexcept
 //-----------------------------------------------------------------------
 //
 
-#line 218 "reflect.h2"
+#line 229 "reflect.h2"
     template <typename T> reflection_base<T>::reflection_base(
 
         cpp2::impl::in<T*> n_, 
@@ -3461,22 +3479,22 @@ compiler_services::compiler_services(compiler_services&& that) noexcept
     )
         : compiler_services{ s }
         , n{ n_ }
-#line 223 "reflect.h2"
+#line 234 "reflect.h2"
     {
 
-#line 226 "reflect.h2"
+#line 237 "reflect.h2"
         if (cpp2::cpp2_default.is_active() && !(n) ) { cpp2::cpp2_default.report_violation(CPP2_CONTRACT_MSG("a meta:: reflection must point to a valid node, not null")); }
     }
 
-#line 229 "reflect.h2"
+#line 240 "reflect.h2"
     template <typename T> [[nodiscard]] auto reflection_base<T>::position() const -> source_position { return CPP2_UFCS(position)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 231 "reflect.h2"
+#line 242 "reflect.h2"
     template <typename T> [[nodiscard]] auto reflection_base<T>::print() const& -> std::string { return CPP2_UFCS(pretty_print_visualize)((*cpp2::impl::assert_not_null(n)), 0);  }
 
-#line 233 "reflect.h2"
+#line 244 "reflect.h2"
     template <typename T> [[nodiscard]] auto reflection_base<T>::is_same(cpp2::impl::in<reflection_base> o) const& -> bool { return n == o.n; }// Test pointers
-#line 234 "reflect.h2"
+#line 245 "reflect.h2"
     template <typename T> template<typename TO> [[nodiscard]] auto reflection_base<T>::is_same([[maybe_unused]] reflection_base<TO> const& unnamed_param_2) const& -> bool { return false;  }
 
     template <typename T> reflection_base<T>::~reflection_base() noexcept{}
@@ -3487,7 +3505,7 @@ template <typename T> reflection_base<T>::reflection_base(reflection_base&& that
                                      : compiler_services{ static_cast<compiler_services&&>(that) }
                                      , n{ std::move(that).n }{}// Different types => false
 
-#line 238 "reflect.h2"
+#line 249 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  Declarations
@@ -3499,126 +3517,130 @@ template <typename T> reflection_base<T>::reflection_base(reflection_base&& that
 //  All declarations
 //
 
-#line 252 "reflect.h2"
+#line 263 "reflect.h2"
     declaration::declaration(
 
         cpp2::impl::in<declaration_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<declaration_node>{ n_, s }
-#line 257 "reflect.h2"
+#line 268 "reflect.h2"
     {
 
+#line 271 "reflect.h2"
+        if (CPP2_UFCS(has_unparsed_body)((*cpp2::impl::assert_not_null(n)))) {
+            parse_deferred_body(*cpp2::impl::assert_not_null(n));
+        }
     }
 
-#line 261 "reflect.h2"
+#line 276 "reflect.h2"
     [[nodiscard]] auto declaration::is_public() const& -> bool { return CPP2_UFCS(is_public)((*cpp2::impl::assert_not_null(n))); }
-#line 262 "reflect.h2"
+#line 277 "reflect.h2"
     [[nodiscard]] auto declaration::is_protected() const& -> bool { return CPP2_UFCS(is_protected)((*cpp2::impl::assert_not_null(n))); }
-#line 263 "reflect.h2"
+#line 278 "reflect.h2"
     [[nodiscard]] auto declaration::is_private() const& -> bool { return CPP2_UFCS(is_private)((*cpp2::impl::assert_not_null(n))); }
-#line 264 "reflect.h2"
+#line 279 "reflect.h2"
     [[nodiscard]] auto declaration::is_default_access() const& -> bool { return CPP2_UFCS(is_default_access)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 266 "reflect.h2"
+#line 281 "reflect.h2"
     [[nodiscard]] auto declaration::default_to_public() & -> decltype(auto) { return static_cast<void>(CPP2_UFCS(make_public)((*cpp2::impl::assert_not_null(n)))); }
-#line 267 "reflect.h2"
+#line 282 "reflect.h2"
     [[nodiscard]] auto declaration::default_to_protected() & -> decltype(auto) { return static_cast<void>(CPP2_UFCS(make_protected)((*cpp2::impl::assert_not_null(n))));  }
-#line 268 "reflect.h2"
+#line 283 "reflect.h2"
     [[nodiscard]] auto declaration::default_to_private() & -> decltype(auto) { return static_cast<void>(CPP2_UFCS(make_private)((*cpp2::impl::assert_not_null(n)))); }
 
-#line 270 "reflect.h2"
+#line 285 "reflect.h2"
     [[nodiscard]] auto declaration::make_public() & -> bool { return CPP2_UFCS(make_public)((*cpp2::impl::assert_not_null(n))); }
-#line 271 "reflect.h2"
+#line 286 "reflect.h2"
     [[nodiscard]] auto declaration::make_protected() & -> bool { return CPP2_UFCS(make_protected)((*cpp2::impl::assert_not_null(n))); }
-#line 272 "reflect.h2"
+#line 287 "reflect.h2"
     [[nodiscard]] auto declaration::make_private() & -> bool { return CPP2_UFCS(make_private)((*cpp2::impl::assert_not_null(n))); }
 
-#line 274 "reflect.h2"
+#line 289 "reflect.h2"
     [[nodiscard]] auto declaration::has_name() const& -> bool { return CPP2_UFCS(has_name)((*cpp2::impl::assert_not_null(n))); }
-#line 275 "reflect.h2"
+#line 290 "reflect.h2"
     [[nodiscard]] auto declaration::has_name(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_name)((*cpp2::impl::assert_not_null(n)), s); }
 
-#line 277 "reflect.h2"
+#line 292 "reflect.h2"
     [[nodiscard]] auto declaration::name() const& -> std::string_view{
         if (has_name()) {return CPP2_UFCS(as_string_view)((*cpp2::impl::assert_not_null(CPP2_UFCS(name)(*cpp2::impl::assert_not_null(n))))); }
         else          { return ""; }
     }
 
-#line 282 "reflect.h2"
+#line 297 "reflect.h2"
     [[nodiscard]] auto declaration::has_initializer() const& -> bool { return CPP2_UFCS(has_initializer)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 284 "reflect.h2"
+#line 299 "reflect.h2"
     [[nodiscard]] auto declaration::get_initializer() const& -> statement { return { CPP2_UFCS(get)((*cpp2::impl::assert_not_null(n)).initializer), (*this) };  }
 
-#line 286 "reflect.h2"
+#line 301 "reflect.h2"
     [[nodiscard]] auto declaration::is_global() const& -> bool { return CPP2_UFCS(is_global)((*cpp2::impl::assert_not_null(n))); }
-#line 287 "reflect.h2"
+#line 302 "reflect.h2"
     [[nodiscard]] auto declaration::is_function() const& -> bool { return CPP2_UFCS(is_function)((*cpp2::impl::assert_not_null(n))); }
-#line 288 "reflect.h2"
+#line 303 "reflect.h2"
     [[nodiscard]] auto declaration::is_object() const& -> bool { return CPP2_UFCS(is_object)((*cpp2::impl::assert_not_null(n))); }
-#line 289 "reflect.h2"
+#line 304 "reflect.h2"
     [[nodiscard]] auto declaration::is_base_object() const& -> bool { return CPP2_UFCS(is_base_object)((*cpp2::impl::assert_not_null(n))); }
-#line 290 "reflect.h2"
+#line 305 "reflect.h2"
     [[nodiscard]] auto declaration::is_member_object() const& -> bool { return CPP2_UFCS(is_member_object)((*cpp2::impl::assert_not_null(n)));  }
-#line 291 "reflect.h2"
+#line 306 "reflect.h2"
     [[nodiscard]] auto declaration::is_type() const& -> bool { return CPP2_UFCS(is_type)((*cpp2::impl::assert_not_null(n))); }
-#line 292 "reflect.h2"
+#line 307 "reflect.h2"
     [[nodiscard]] auto declaration::is_namespace() const& -> bool { return CPP2_UFCS(is_namespace)((*cpp2::impl::assert_not_null(n))); }
-#line 293 "reflect.h2"
+#line 308 "reflect.h2"
     [[nodiscard]] auto declaration::is_alias() const& -> bool { return CPP2_UFCS(is_alias)((*cpp2::impl::assert_not_null(n))); }
 
-#line 295 "reflect.h2"
+#line 310 "reflect.h2"
     [[nodiscard]] auto declaration::is_type_alias() const& -> bool { return CPP2_UFCS(is_type_alias)((*cpp2::impl::assert_not_null(n))); }
-#line 296 "reflect.h2"
+#line 311 "reflect.h2"
     [[nodiscard]] auto declaration::is_namespace_alias() const& -> bool { return CPP2_UFCS(is_namespace_alias)((*cpp2::impl::assert_not_null(n)));  }
-#line 297 "reflect.h2"
+#line 312 "reflect.h2"
     [[nodiscard]] auto declaration::is_object_alias() const& -> bool { return CPP2_UFCS(is_object_alias)((*cpp2::impl::assert_not_null(n))); }
 
-#line 299 "reflect.h2"
+#line 314 "reflect.h2"
     [[nodiscard]] auto declaration::is_function_expression() const& -> bool { return CPP2_UFCS(is_function_expression)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 301 "reflect.h2"
+#line 316 "reflect.h2"
     [[nodiscard]] auto declaration::as_function() const& -> function_declaration { return { n, (*this) }; }
-#line 302 "reflect.h2"
+#line 317 "reflect.h2"
     [[nodiscard]] auto declaration::as_object() const& -> object_declaration { return { n, (*this) }; }
-#line 303 "reflect.h2"
+#line 318 "reflect.h2"
     [[nodiscard]] auto declaration::as_type() const& -> type_declaration { return { n, (*this) }; }
-#line 304 "reflect.h2"
+#line 319 "reflect.h2"
     [[nodiscard]] auto declaration::as_nonglobal_namespace() const& -> namespace_declaration { return { n, (*this) };  }
-#line 305 "reflect.h2"
+#line 320 "reflect.h2"
     [[nodiscard]] auto declaration::as_alias() const& -> alias_declaration { return { n, (*this) }; }
 
-#line 307 "reflect.h2"
+#line 322 "reflect.h2"
     [[nodiscard]] auto declaration::get_parent() const& -> declaration { return declaration((*cpp2::impl::assert_not_null(n)).parent_declaration, (*this)); }
 
-#line 309 "reflect.h2"
+#line 324 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_function() const& -> bool { return CPP2_UFCS(parent_is_function)((*cpp2::impl::assert_not_null(n))); }
-#line 310 "reflect.h2"
+#line 325 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_object() const& -> bool { return CPP2_UFCS(parent_is_object)((*cpp2::impl::assert_not_null(n))); }
-#line 311 "reflect.h2"
+#line 326 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_type() const& -> bool { return CPP2_UFCS(parent_is_type)((*cpp2::impl::assert_not_null(n))); }
-#line 312 "reflect.h2"
+#line 327 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_nonglobal_namespace() const& -> bool { return CPP2_UFCS(parent_is_nonglobal_namespace)((*cpp2::impl::assert_not_null(n)));  }
-#line 313 "reflect.h2"
+#line 328 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_alias() const& -> bool { return CPP2_UFCS(parent_is_alias)((*cpp2::impl::assert_not_null(n))); }
 
-#line 315 "reflect.h2"
+#line 330 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_type_alias() const& -> bool { return CPP2_UFCS(parent_is_type_alias)((*cpp2::impl::assert_not_null(n))); }
-#line 316 "reflect.h2"
+#line 331 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_namespace_alias() const& -> bool { return CPP2_UFCS(parent_is_namespace_alias)((*cpp2::impl::assert_not_null(n)));  }
-#line 317 "reflect.h2"
+#line 332 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_object_alias() const& -> bool { return CPP2_UFCS(parent_is_object_alias)((*cpp2::impl::assert_not_null(n))); }
 
-#line 319 "reflect.h2"
+#line 334 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_polymorphic() const& -> bool { return CPP2_UFCS(parent_is_polymorphic)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 321 "reflect.h2"
+#line 336 "reflect.h2"
     auto declaration::mark_for_removal_from_enclosing_type() & -> void
                                                     // this precondition should be sufficient ...
     {
         if (cpp2::type_safety.is_active() && !(parent_is_type()) ) { cpp2::type_safety.report_violation(""); }
-#line 324 "reflect.h2"
+#line 339 "reflect.h2"
         auto test {CPP2_UFCS(type_member_mark_for_removal)((*cpp2::impl::assert_not_null(n)))}; 
         if (cpp2::cpp2_default.is_active() && !(cpp2::move(test)) ) { cpp2::cpp2_default.report_violation(""); }// ... to ensure this assert is true
     }
@@ -3629,111 +3651,111 @@ declaration::declaration(declaration const& that)
 declaration::declaration(declaration&& that) noexcept
                                      : reflection_base<declaration_node>{ static_cast<reflection_base<declaration_node>&&>(that) }{}
 
-#line 330 "reflect.h2"
+#line 345 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Function declarations
 //
 
-#line 337 "reflect.h2"
+#line 352 "reflect.h2"
     function_declaration::function_declaration(
 
         cpp2::impl::in<declaration_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : declaration{ n_, s }
-#line 342 "reflect.h2"
+#line 357 "reflect.h2"
     {
 
         if (cpp2::cpp2_default.is_active() && !(CPP2_UFCS(is_function)((*cpp2::impl::assert_not_null(n)))) ) { cpp2::cpp2_default.report_violation(""); }
     }
 
-#line 347 "reflect.h2"
+#line 362 "reflect.h2"
     [[nodiscard]] auto function_declaration::index_of_parameter_named(cpp2::impl::in<std::string_view> s) const& -> int { return CPP2_UFCS(index_of_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 348 "reflect.h2"
+#line 363 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 349 "reflect.h2"
+#line 364 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_return_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_return_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 350 "reflect.h2"
+#line 365 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_parameter_or_return_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_parameter_or_return_named)((*cpp2::impl::assert_not_null(n)), s);  }
-#line 351 "reflect.h2"
+#line 366 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_in_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_in_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 352 "reflect.h2"
+#line 367 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_in_ref_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_in_ref_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 353 "reflect.h2"
+#line 368 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_copy_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_copy_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 354 "reflect.h2"
+#line 369 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_inout_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_inout_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 355 "reflect.h2"
+#line 370 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_out_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_out_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 356 "reflect.h2"
+#line 371 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_move_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_move_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 357 "reflect.h2"
+#line 372 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_forward_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_forward_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 358 "reflect.h2"
+#line 373 "reflect.h2"
     [[nodiscard]] auto function_declaration::first_parameter_name() const& -> std::string { return CPP2_UFCS(first_parameter_name)((*cpp2::impl::assert_not_null(n))); }
 
-#line 360 "reflect.h2"
+#line 375 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_parameter_with_name_and_pass(cpp2::impl::in<std::string_view> s, cpp2::impl::in<passing_style> pass) const& -> bool { 
                                                   return CPP2_UFCS(has_parameter_with_name_and_pass)((*cpp2::impl::assert_not_null(n)), s, pass);  }
-#line 362 "reflect.h2"
+#line 377 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_function_with_this() const& -> bool { return CPP2_UFCS(is_function_with_this)((*cpp2::impl::assert_not_null(n))); }
-#line 363 "reflect.h2"
+#line 378 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_virtual() const& -> bool { return CPP2_UFCS(is_virtual_function)((*cpp2::impl::assert_not_null(n))); }
-#line 364 "reflect.h2"
+#line 379 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_defaultable() const& -> bool { return CPP2_UFCS(is_defaultable_function)((*cpp2::impl::assert_not_null(n))); }
-#line 365 "reflect.h2"
+#line 380 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_constructor() const& -> bool { return CPP2_UFCS(is_constructor)((*cpp2::impl::assert_not_null(n))); }
-#line 366 "reflect.h2"
+#line 381 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_default_constructor() const& -> bool { return CPP2_UFCS(is_default_constructor)((*cpp2::impl::assert_not_null(n))); }
-#line 367 "reflect.h2"
+#line 382 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_move() const& -> bool { return CPP2_UFCS(is_move)((*cpp2::impl::assert_not_null(n))); }
-#line 368 "reflect.h2"
+#line 383 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_swap() const& -> bool { return CPP2_UFCS(is_swap)((*cpp2::impl::assert_not_null(n))); }
-#line 369 "reflect.h2"
+#line 384 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_constructor_with_that() const& -> bool { return CPP2_UFCS(is_constructor_with_that)((*cpp2::impl::assert_not_null(n))); }
-#line 370 "reflect.h2"
+#line 385 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_constructor_with_in_that() const& -> bool { return CPP2_UFCS(is_constructor_with_in_that)((*cpp2::impl::assert_not_null(n))); }
-#line 371 "reflect.h2"
+#line 386 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_constructor_with_move_that() const& -> bool { return CPP2_UFCS(is_constructor_with_move_that)((*cpp2::impl::assert_not_null(n)));  }
-#line 372 "reflect.h2"
+#line 387 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_assignment() const& -> bool { return CPP2_UFCS(is_assignment)((*cpp2::impl::assert_not_null(n))); }
-#line 373 "reflect.h2"
+#line 388 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_assignment_with_that() const& -> bool { return CPP2_UFCS(is_assignment_with_that)((*cpp2::impl::assert_not_null(n))); }
-#line 374 "reflect.h2"
+#line 389 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_assignment_with_in_that() const& -> bool { return CPP2_UFCS(is_assignment_with_in_that)((*cpp2::impl::assert_not_null(n))); }
-#line 375 "reflect.h2"
+#line 390 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_assignment_with_move_that() const& -> bool { return CPP2_UFCS(is_assignment_with_move_that)((*cpp2::impl::assert_not_null(n)));  }
-#line 376 "reflect.h2"
+#line 391 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_destructor() const& -> bool { return CPP2_UFCS(is_destructor)((*cpp2::impl::assert_not_null(n))); }
 
-#line 378 "reflect.h2"
+#line 393 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_copy_or_move() const& -> bool { return is_constructor_with_that() || is_assignment_with_that(); }
 
-#line 380 "reflect.h2"
+#line 395 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_declared_return_type() const& -> bool { return CPP2_UFCS(has_declared_return_type)((*cpp2::impl::assert_not_null(n))); }
-#line 381 "reflect.h2"
+#line 396 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_deduced_return_type() const& -> bool { return CPP2_UFCS(has_deduced_return_type)((*cpp2::impl::assert_not_null(n))); }
-#line 382 "reflect.h2"
+#line 397 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_bool_return_type() const& -> bool { return CPP2_UFCS(has_bool_return_type)((*cpp2::impl::assert_not_null(n))); }
-#line 383 "reflect.h2"
+#line 398 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_non_void_return_type() const& -> bool { return CPP2_UFCS(has_non_void_return_type)((*cpp2::impl::assert_not_null(n))); }
 
-#line 385 "reflect.h2"
+#line 400 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_compound_body() const& -> bool { return CPP2_UFCS(is_function_with_compound_body)((*cpp2::impl::assert_not_null(n))); }
 
-#line 387 "reflect.h2"
+#line 402 "reflect.h2"
     [[nodiscard]] auto function_declaration::get_body() const& -> statement { return { CPP2_UFCS(get_function_body)((*cpp2::impl::assert_not_null(n))), (*this) }; }
-#line 388 "reflect.h2"
+#line 403 "reflect.h2"
     [[nodiscard]] auto function_declaration::get_compound_body() const& -> compound_statement { return { CPP2_UFCS(get_function_compound_body)((*cpp2::impl::assert_not_null(n))), (*this) }; }
-#line 389 "reflect.h2"
+#line 404 "reflect.h2"
     [[nodiscard]] auto function_declaration::get_unnamed_return_type() const& -> std::string { return CPP2_UFCS(unnamed_return_type_to_string)((*cpp2::impl::assert_not_null(n))); }
-#line 390 "reflect.h2"
+#line 405 "reflect.h2"
     [[nodiscard]] auto function_declaration::get_signature() const& -> std::string { return CPP2_UFCS(signature_to_string)((*cpp2::impl::assert_not_null(n))); }
 
-#line 392 "reflect.h2"
+#line 407 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_binary_comparison_function() const& -> bool { return CPP2_UFCS(is_binary_comparison_function)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 394 "reflect.h2"
+#line 409 "reflect.h2"
     [[nodiscard]] auto function_declaration::get_parameters() const& -> std::vector<parameter_declaration>
 
     {
@@ -3744,7 +3766,7 @@ declaration::declaration(declaration&& that) noexcept
         return ret; 
     }
 
-#line 404 "reflect.h2"
+#line 419 "reflect.h2"
     [[nodiscard]] auto function_declaration::get_returns() const& -> std::vector<parameter_declaration>
 
     {
@@ -3757,20 +3779,20 @@ declaration::declaration(declaration&& that) noexcept
 
     //  Modifying operations
     //
-#line 416 "reflect.h2"
+#line 431 "reflect.h2"
     [[nodiscard]] auto function_declaration::default_to_virtual() & -> decltype(auto) { return static_cast<void>(CPP2_UFCS(make_function_virtual)((*cpp2::impl::assert_not_null(n)))); }
 
-#line 418 "reflect.h2"
+#line 433 "reflect.h2"
     [[nodiscard]] auto function_declaration::make_virtual() & -> bool { return CPP2_UFCS(make_function_virtual)((*cpp2::impl::assert_not_null(n))); }
 
-#line 420 "reflect.h2"
+#line 435 "reflect.h2"
     auto function_declaration::add_initializer(cpp2::impl::in<std::string_view> source) & -> void
 
-#line 423 "reflect.h2"
+#line 438 "reflect.h2"
     {
         if ((*this).is_active() && !(!(has_initializer())) ) { (*this).report_violation(CPP2_CONTRACT_MSG("cannot add an initializer to a function that already has one")); }
         if ((*this).is_active() && !(parent_is_type()) ) { (*this).report_violation(CPP2_CONTRACT_MSG("cannot add an initializer to a function that isn't in a type scope")); }
-#line 424 "reflect.h2"
+#line 439 "reflect.h2"
         auto stmt {parse_statement(source)}; 
         if (!((cpp2::impl::as_<bool>(stmt)))) {
             error("cannot add an initializer that is not a valid statement");
@@ -3785,30 +3807,30 @@ declaration::declaration(declaration&& that) noexcept
 function_declaration::function_declaration(function_declaration&& that) noexcept
                                      : declaration{ static_cast<declaration&&>(that) }{}
 
-#line 435 "reflect.h2"
+#line 450 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Object declarations
 //
 
-#line 442 "reflect.h2"
+#line 457 "reflect.h2"
     object_declaration::object_declaration(
 
         cpp2::impl::in<declaration_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : declaration{ n_, s }
-#line 447 "reflect.h2"
+#line 462 "reflect.h2"
     {
 
         if (cpp2::cpp2_default.is_active() && !(CPP2_UFCS(is_object)((*cpp2::impl::assert_not_null(n)))) ) { cpp2::cpp2_default.report_violation(""); }
     }
 
-#line 452 "reflect.h2"
+#line 467 "reflect.h2"
     [[nodiscard]] auto object_declaration::is_const() const& -> bool { return CPP2_UFCS(is_const)((*cpp2::impl::assert_not_null(n))); }
-#line 453 "reflect.h2"
+#line 468 "reflect.h2"
     [[nodiscard]] auto object_declaration::has_wildcard_type() const& -> bool { return CPP2_UFCS(has_wildcard_type)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 455 "reflect.h2"
+#line 470 "reflect.h2"
     [[nodiscard]] auto object_declaration::type() const& -> std::string{
         auto ret {CPP2_UFCS(object_type)((*cpp2::impl::assert_not_null(n)))}; 
         require(!(contains(ret, "(*ERROR*)")), 
@@ -3816,7 +3838,7 @@ function_declaration::function_declaration(function_declaration&& that) noexcept
         return ret; 
     }
 
-#line 462 "reflect.h2"
+#line 477 "reflect.h2"
     [[nodiscard]] auto object_declaration::initializer() const& -> std::string{
         auto ret {CPP2_UFCS(object_initializer)((*cpp2::impl::assert_not_null(n)))}; 
         require(!(contains(ret, "(*ERROR*)")), 
@@ -3829,25 +3851,25 @@ function_declaration::function_declaration(function_declaration&& that) noexcept
 object_declaration::object_declaration(object_declaration&& that) noexcept
                                      : declaration{ static_cast<declaration&&>(that) }{}
 
-#line 471 "reflect.h2"
+#line 486 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Type and namespace declarations
 //
 
-#line 478 "reflect.h2"
+#line 493 "reflect.h2"
     type_or_namespace_declaration::type_or_namespace_declaration(
 
         cpp2::impl::in<declaration_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : declaration{ n_, s }
-#line 483 "reflect.h2"
+#line 498 "reflect.h2"
     {
 
         if (cpp2::cpp2_default.is_active() && !(CPP2_UFCS(is_type)((*cpp2::impl::assert_not_null(n))) || CPP2_UFCS(is_namespace)((*cpp2::impl::assert_not_null(n)))) ) { cpp2::cpp2_default.report_violation(""); }
     }
 
-#line 488 "reflect.h2"
+#line 503 "reflect.h2"
     auto type_or_namespace_declaration::reserve_names(cpp2::impl::in<std::string_view> name, auto&& ...etc) const& -> void
     {                           // etc is not declared ':string_view' for compatibility with GCC 10.x
         for ( 
@@ -3862,7 +3884,7 @@ object_declaration::object_declaration(object_declaration&& that) noexcept
         }
     }
 
-#line 502 "reflect.h2"
+#line 517 "reflect.h2"
     [[nodiscard]] auto type_or_namespace_declaration::get_member_functions() const& -> std::vector<function_declaration>
 
     {
@@ -3874,7 +3896,7 @@ object_declaration::object_declaration(object_declaration&& that) noexcept
         return ret; 
     }
 
-#line 513 "reflect.h2"
+#line 528 "reflect.h2"
     [[nodiscard]] auto type_or_namespace_declaration::get_member_functions_needing_initializer() const& -> std::vector<function_declaration>
 
     {
@@ -3890,7 +3912,7 @@ object_declaration::object_declaration(object_declaration&& that) noexcept
         return ret; 
     }
 
-#line 528 "reflect.h2"
+#line 543 "reflect.h2"
     [[nodiscard]] auto type_or_namespace_declaration::get_member_objects() const& -> std::vector<object_declaration>
 
     {
@@ -3901,7 +3923,7 @@ object_declaration::object_declaration(object_declaration&& that) noexcept
         return ret; 
     }
 
-#line 538 "reflect.h2"
+#line 553 "reflect.h2"
     [[nodiscard]] auto type_or_namespace_declaration::get_member_types() const& -> std::vector<type_declaration>
 
     {
@@ -3912,7 +3934,7 @@ object_declaration::object_declaration(object_declaration&& that) noexcept
         return ret; 
     }
 
-#line 548 "reflect.h2"
+#line 563 "reflect.h2"
     [[nodiscard]] auto type_or_namespace_declaration::get_member_aliases() const& -> std::vector<alias_declaration>
 
     {
@@ -3923,7 +3945,7 @@ object_declaration::object_declaration(object_declaration&& that) noexcept
         return ret; 
     }
 
-#line 558 "reflect.h2"
+#line 573 "reflect.h2"
     [[nodiscard]] auto type_or_namespace_declaration::get_members() const& -> std::vector<declaration>
 
     {
@@ -3934,7 +3956,7 @@ object_declaration::object_declaration(object_declaration&& that) noexcept
         return ret; 
     }
 
-#line 568 "reflect.h2"
+#line 583 "reflect.h2"
     auto type_or_namespace_declaration::add_member(cpp2::impl::in<std::string_view> source) & -> void
     {
         auto decl {parse_statement(source)}; 
@@ -3955,36 +3977,36 @@ object_declaration::object_declaration(object_declaration&& that) noexcept
 type_or_namespace_declaration::type_or_namespace_declaration(type_or_namespace_declaration&& that) noexcept
                                      : declaration{ static_cast<declaration&&>(that) }{}
 
-#line 589 "reflect.h2"
+#line 604 "reflect.h2"
     type_declaration::type_declaration(
 
         cpp2::impl::in<declaration_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : type_or_namespace_declaration{ n_, s }
-#line 594 "reflect.h2"
+#line 609 "reflect.h2"
     {
 
         if (cpp2::cpp2_default.is_active() && !(CPP2_UFCS(is_type)((*cpp2::impl::assert_not_null(n)))) ) { cpp2::cpp2_default.report_violation(""); }
     }
 
-#line 600 "reflect.h2"
+#line 615 "reflect.h2"
     [[nodiscard]] auto type_declaration::is_polymorphic() const& -> bool { return CPP2_UFCS(is_polymorphic)((*cpp2::impl::assert_not_null(n))); }
-#line 601 "reflect.h2"
+#line 616 "reflect.h2"
     [[nodiscard]] auto type_declaration::is_final() const& -> bool { return CPP2_UFCS(is_type_final)((*cpp2::impl::assert_not_null(n))); }
-#line 602 "reflect.h2"
+#line 617 "reflect.h2"
     [[nodiscard]] auto type_declaration::make_final() & -> bool { return CPP2_UFCS(make_type_final)((*cpp2::impl::assert_not_null(n))); }
 
-#line 604 "reflect.h2"
+#line 619 "reflect.h2"
     [[nodiscard]] auto type_declaration::query_declared_value_set_functions() const& -> query_declared_value_set_functions_ret
 
-#line 611 "reflect.h2"
+#line 626 "reflect.h2"
     {
             cpp2::impl::deferred_init<bool> out_this_in_that;
             cpp2::impl::deferred_init<bool> out_this_move_that;
             cpp2::impl::deferred_init<bool> inout_this_in_that;
             cpp2::impl::deferred_init<bool> inout_this_move_that;
-#line 612 "reflect.h2"
+#line 627 "reflect.h2"
         auto declared {CPP2_UFCS(find_declared_value_set_functions)((*cpp2::impl::assert_not_null(n)))}; 
         out_this_in_that.construct(declared.out_this_in_that != nullptr);
         out_this_move_that.construct(declared.out_this_move_that != nullptr);
@@ -3993,15 +4015,15 @@ type_or_namespace_declaration::type_or_namespace_declaration(type_or_namespace_d
         return  { std::move(out_this_in_that.value()), std::move(out_this_move_that.value()), std::move(inout_this_in_that.value()), std::move(inout_this_move_that.value()) }; // NOLINT(performance-move-const-arg)
     }
 
-#line 620 "reflect.h2"
+#line 635 "reflect.h2"
     [[nodiscard]] auto type_declaration::disable_member_function_generation() & -> decltype(auto) { return CPP2_UFCS(type_disable_member_function_generation)((*cpp2::impl::assert_not_null(n)));  }
-#line 621 "reflect.h2"
+#line 636 "reflect.h2"
     [[nodiscard]] auto type_declaration::disable_ref_qualifier_generation() & -> decltype(auto) { return CPP2_UFCS(type_disable_ref_qualifier_generation)((*cpp2::impl::assert_not_null(n))); }
 
     //  At some point we may want to allow this also for namespaces, but for now only types
-#line 624 "reflect.h2"
+#line 639 "reflect.h2"
     [[nodiscard]] auto type_declaration::remove_marked_members() & -> decltype(auto) { return CPP2_UFCS(type_remove_marked_members)((*cpp2::impl::assert_not_null(n)));  }
-#line 625 "reflect.h2"
+#line 640 "reflect.h2"
     [[nodiscard]] auto type_declaration::remove_all_members() & -> decltype(auto) { return CPP2_UFCS(type_remove_all_members)((*cpp2::impl::assert_not_null(n))); }
 
     type_declaration::type_declaration(type_declaration const& that)
@@ -4009,14 +4031,14 @@ type_or_namespace_declaration::type_or_namespace_declaration(type_or_namespace_d
 type_declaration::type_declaration(type_declaration&& that) noexcept
                                      : type_or_namespace_declaration{ static_cast<type_or_namespace_declaration&&>(that) }{}
 
-#line 633 "reflect.h2"
+#line 648 "reflect.h2"
     namespace_declaration::namespace_declaration(
 
         cpp2::impl::in<declaration_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : type_or_namespace_declaration{ n_, s }
-#line 638 "reflect.h2"
+#line 653 "reflect.h2"
     {
 
         if (cpp2::cpp2_default.is_active() && !(CPP2_UFCS(is_namespace)((*cpp2::impl::assert_not_null(n)))) ) { cpp2::cpp2_default.report_violation(""); }
@@ -4027,19 +4049,19 @@ type_declaration::type_declaration(type_declaration&& that) noexcept
 namespace_declaration::namespace_declaration(namespace_declaration&& that) noexcept
                                      : type_or_namespace_declaration{ static_cast<type_or_namespace_declaration&&>(that) }{}
 
-#line 645 "reflect.h2"
+#line 660 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Alias declarations
 //
 
-#line 652 "reflect.h2"
+#line 667 "reflect.h2"
     alias_declaration::alias_declaration(
 
         cpp2::impl::in<declaration_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : declaration{ n_, s }
-#line 657 "reflect.h2"
+#line 672 "reflect.h2"
     {
 
         if (cpp2::cpp2_default.is_active() && !(CPP2_UFCS(is_alias)((*cpp2::impl::assert_not_null(n)))) ) { cpp2::cpp2_default.report_violation(""); }
@@ -4050,35 +4072,35 @@ namespace_declaration::namespace_declaration(namespace_declaration&& that) noexc
 alias_declaration::alias_declaration(alias_declaration&& that) noexcept
                                      : declaration{ static_cast<declaration&&>(that) }{}
 
-#line 664 "reflect.h2"
+#line 679 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Parameter declarations
 //
 
-#line 671 "reflect.h2"
+#line 686 "reflect.h2"
     parameter_declaration::parameter_declaration(
 
         cpp2::impl::in<parameter_declaration_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<parameter_declaration_node>{ n_, s }
-#line 676 "reflect.h2"
+#line 691 "reflect.h2"
     {
 
     }
 
-#line 680 "reflect.h2"
+#line 695 "reflect.h2"
     [[nodiscard]] auto parameter_declaration::get_declaration() const& -> object_declaration { return { CPP2_UFCS(get)((*cpp2::impl::assert_not_null(n)).declaration), (*this) }; }
-#line 681 "reflect.h2"
+#line 696 "reflect.h2"
     [[nodiscard]] auto parameter_declaration::get_passing_style() const& -> passing_style { return (*cpp2::impl::assert_not_null(n)).pass; }
 
-#line 683 "reflect.h2"
+#line 698 "reflect.h2"
     [[nodiscard]] auto parameter_declaration::is_implicit() const& -> bool { return (*cpp2::impl::assert_not_null(n)).mod == parameter_declaration_node::modifier::implicit;  }
-#line 684 "reflect.h2"
+#line 699 "reflect.h2"
     [[nodiscard]] auto parameter_declaration::is_virtual() const& -> bool { return (*cpp2::impl::assert_not_null(n)).mod == parameter_declaration_node::modifier::virtual_;  }
-#line 685 "reflect.h2"
+#line 700 "reflect.h2"
     [[nodiscard]] auto parameter_declaration::is_override() const& -> bool { return (*cpp2::impl::assert_not_null(n)).mod == parameter_declaration_node::modifier::override_;  }
-#line 686 "reflect.h2"
+#line 701 "reflect.h2"
     [[nodiscard]] auto parameter_declaration::is_final() const& -> bool { return (*cpp2::impl::assert_not_null(n)).mod == parameter_declaration_node::modifier::final_; }
 
     parameter_declaration::parameter_declaration(parameter_declaration const& that)
@@ -4086,7 +4108,7 @@ alias_declaration::alias_declaration(alias_declaration&& that) noexcept
 parameter_declaration::parameter_declaration(parameter_declaration&& that) noexcept
                                      : reflection_base<parameter_declaration_node>{ static_cast<reflection_base<parameter_declaration_node>&&>(that) }{}
 
-#line 690 "reflect.h2"
+#line 705 "reflect.h2"
 //-----------------------------------------------------------------------
 // 
 //  Expressions
@@ -4098,45 +4120,45 @@ parameter_declaration::parameter_declaration(parameter_declaration&& that) noexc
 //  Binary expressions
 //
 
-#line 717 "reflect.h2"
+#line 732 "reflect.h2"
     template <String Name, typename Term> binary_expression<Name,Term>::binary_expression(
 
         binary_expression_node<Name,Term>* const& n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<binary_expression_node<Name,Term>>{ n_, s }
-#line 722 "reflect.h2"
+#line 737 "reflect.h2"
     {
 
     }
 
-#line 726 "reflect.h2"
+#line 741 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::is_fold_expression() const& -> bool { return CPP2_UFCS(is_fold_expression)((*cpp2::impl::assert_not_null((*this).n))); }
-#line 727 "reflect.h2"
+#line 742 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::lhs_is_id_expression() const& -> bool { return CPP2_UFCS(lhs_is_id_expression)((*cpp2::impl::assert_not_null((*this).n))); }
-#line 728 "reflect.h2"
+#line 743 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::is_standalone_expression() const& -> bool { return CPP2_UFCS(is_standalone_expression)((*cpp2::impl::assert_not_null((*this).n)));  }
-#line 729 "reflect.h2"
+#line 744 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::terms_size() const& -> int { return CPP2_UFCS(terms_size)((*cpp2::impl::assert_not_null((*this).n))); }
-#line 730 "reflect.h2"
+#line 745 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::is_identifier() const& -> bool { return CPP2_UFCS(is_identifier)((*cpp2::impl::assert_not_null((*this).n))); }
-#line 731 "reflect.h2"
+#line 746 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::is_id_expression() const& -> bool { return CPP2_UFCS(is_id_expression)((*cpp2::impl::assert_not_null((*this).n))); }
-#line 732 "reflect.h2"
+#line 747 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::is_unqualified_id() const& -> bool { return CPP2_UFCS(is_unqualified_id)((*cpp2::impl::assert_not_null((*this).n))); }
-#line 733 "reflect.h2"
+#line 748 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::is_expression_list() const& -> bool { return CPP2_UFCS(is_expression_list)((*cpp2::impl::assert_not_null((*this).n))); }
-#line 734 "reflect.h2"
+#line 749 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::is_literal() const& -> bool { return CPP2_UFCS(is_literal)((*cpp2::impl::assert_not_null((*this).n))); }
 
-#line 740 "reflect.h2"
+#line 755 "reflect.h2"
         template <String Name, typename Term> template <typename T> binary_expression<Name,Term>::term_t<T>::term_t(auto&& o, auto&& ptr, auto&& cs)
                                                                       : op{ CPP2_FORWARD(o) }
                                                                       , term{ CPP2_FORWARD(ptr), CPP2_FORWARD(cs) }{}
 
-#line 742 "reflect.h2"
+#line 757 "reflect.h2"
         template <String Name, typename Term> template <typename T> [[nodiscard]] auto binary_expression<Name,Term>::term_t<T>::get_op() const& -> std::string { return op; }
-#line 743 "reflect.h2"
+#line 758 "reflect.h2"
         template <String Name, typename Term> template <typename T> [[nodiscard]] auto binary_expression<Name,Term>::term_t<T>::get_term() const& -> T { return term; }
 
         template <String Name, typename Term> template <typename T> binary_expression<Name,Term>::term_t<T>::term_t(term_t const& that)
@@ -4154,7 +4176,7 @@ template <String Name, typename Term> template <typename T> auto binary_expressi
                                 op = std::move(that).op;
                                 term = std::move(that).term;
                                 return *this;}
-#line 746 "reflect.h2"
+#line 761 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::get_terms() const& -> auto{
         if constexpr (std::is_same_v<Term,is_as_expression_node>) {
             std::vector<term_t<is_as_expression>> ret {}; 
@@ -4230,25 +4252,25 @@ template <String Name, typename Term> template <typename T> auto binary_expressi
         }
     }
 
-#line 821 "reflect.h2"
+#line 836 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::as_expression_list() const& -> expression_list { return { CPP2_UFCS(get_expression_list)((*cpp2::impl::assert_not_null((*this).n))), (*this) };  }
-#line 822 "reflect.h2"
+#line 837 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::as_literal() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_literal)(*cpp2::impl::assert_not_null((*this).n))))); }
 
     //  Get the postfix-expression, if that's the entire expression (not actually binary)
-#line 825 "reflect.h2"
+#line 840 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::get_if_only_a_postfix_expression() const& -> postfix_expression { return { CPP2_UFCS(get_if_only_a_postfix_expression_node)((*cpp2::impl::assert_not_null((*this).n))), (*this) };  }
     //  Get left-hand postfix-expression
-#line 827 "reflect.h2"
+#line 842 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::get_lhs_postfix_expression() const& -> postfix_expression { return { CPP2_UFCS(get_postfix_expression_node)((*cpp2::impl::assert_not_null((*this).n))), (*this) }; }
     //  Get first right-hand postfix-expression, if there is one
-#line 829 "reflect.h2"
+#line 844 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::get_second_postfix_expression() const& -> postfix_expression { return { CPP2_UFCS(get_second_postfix_expression_node)((*cpp2::impl::assert_not_null((*this).n))), (*this) }; }
 
-#line 831 "reflect.h2"
+#line 846 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::is_result_a_temporary_variable() const& -> bool { return CPP2_UFCS(is_result_a_temporary_variable)((*cpp2::impl::assert_not_null((*this).n))); }
 
-#line 833 "reflect.h2"
+#line 848 "reflect.h2"
     template <String Name, typename Term> [[nodiscard]] auto binary_expression<Name,Term>::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null((*this).n)));  }
 
     template <String Name, typename Term> binary_expression<Name,Term>::binary_expression(binary_expression const& that)
@@ -4256,29 +4278,29 @@ template <String Name, typename Term> template <typename T> auto binary_expressi
 template <String Name, typename Term> binary_expression<Name,Term>::binary_expression(binary_expression&& that) noexcept
                                      : reflection_base<binary_expression_node<Name,Term>>{ static_cast<reflection_base<binary_expression_node<Name,Term>>&&>(that) }{}
 
-#line 837 "reflect.h2"
+#line 852 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Expression list
 //
 
-#line 844 "reflect.h2"
+#line 859 "reflect.h2"
     expression_list::expression_list(
 
         cpp2::impl::in<expression_list_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<expression_list_node>{ n_, s }
-#line 849 "reflect.h2"
+#line 864 "reflect.h2"
     {
 
     }
 
-#line 853 "reflect.h2"
+#line 868 "reflect.h2"
     [[nodiscard]] auto expression_list::is_empty() const& -> bool { return CPP2_UFCS(is_empty)((*cpp2::impl::assert_not_null(n))); }
-#line 854 "reflect.h2"
+#line 869 "reflect.h2"
     [[nodiscard]] auto expression_list::is_fold_expression() const& -> bool { return CPP2_UFCS(is_fold_expression)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 856 "reflect.h2"
+#line 871 "reflect.h2"
     [[nodiscard]] auto expression_list::get_expressions() const& -> std::vector<expression>
 
     {
@@ -4289,7 +4311,7 @@ template <String Name, typename Term> binary_expression<Name,Term>::binary_expre
         return ret; 
     }
 
-#line 866 "reflect.h2"
+#line 881 "reflect.h2"
     [[nodiscard]] auto expression_list::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(n)));  }
 
     expression_list::expression_list(expression_list const& that)
@@ -4297,24 +4319,24 @@ template <String Name, typename Term> binary_expression<Name,Term>::binary_expre
 expression_list::expression_list(expression_list&& that) noexcept
                                      : reflection_base<expression_list_node>{ static_cast<reflection_base<expression_list_node>&&>(that) }{}
 
-#line 870 "reflect.h2"
+#line 885 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Prefix expressions
 //
 
-#line 877 "reflect.h2"
+#line 892 "reflect.h2"
     prefix_expression::prefix_expression(
 
         cpp2::impl::in<prefix_expression_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<prefix_expression_node>{ n_, s }
-#line 882 "reflect.h2"
+#line 897 "reflect.h2"
     {
 
     }
 
-#line 886 "reflect.h2"
+#line 901 "reflect.h2"
     [[nodiscard]] auto prefix_expression::get_ops() const& -> std::vector<std::string>{
         std::vector<std::string> ret {}; 
         for ( auto const& op : (*cpp2::impl::assert_not_null(n)).ops ) {
@@ -4323,32 +4345,32 @@ expression_list::expression_list(expression_list&& that) noexcept
         return ret; 
     }
 
-#line 894 "reflect.h2"
+#line 909 "reflect.h2"
     [[nodiscard]] auto prefix_expression::get_postfix_expression() const& -> postfix_expression { return { CPP2_UFCS(get)((*cpp2::impl::assert_not_null((*this).n)).expr), (*this) };  }
 
-#line 896 "reflect.h2"
+#line 911 "reflect.h2"
     [[nodiscard]] auto prefix_expression::is_fold_expression() const& -> bool { return CPP2_UFCS(is_fold_expression)((*cpp2::impl::assert_not_null(n))); }
-#line 897 "reflect.h2"
+#line 912 "reflect.h2"
     [[nodiscard]] auto prefix_expression::is_identifier() const& -> bool { return CPP2_UFCS(is_identifier)((*cpp2::impl::assert_not_null(n))); }
-#line 898 "reflect.h2"
+#line 913 "reflect.h2"
     [[nodiscard]] auto prefix_expression::is_id_expression() const& -> bool { return CPP2_UFCS(is_id_expression)((*cpp2::impl::assert_not_null(n))); }
-#line 899 "reflect.h2"
+#line 914 "reflect.h2"
     [[nodiscard]] auto prefix_expression::is_unqualified_id() const& -> bool { return CPP2_UFCS(is_unqualified_id)((*cpp2::impl::assert_not_null(n))); }
-#line 900 "reflect.h2"
+#line 915 "reflect.h2"
     [[nodiscard]] auto prefix_expression::is_expression_list() const& -> bool { return CPP2_UFCS(is_expression_list)((*cpp2::impl::assert_not_null(n))); }
-#line 901 "reflect.h2"
+#line 916 "reflect.h2"
     [[nodiscard]] auto prefix_expression::is_literal() const& -> bool { return CPP2_UFCS(is_literal)((*cpp2::impl::assert_not_null(n))); }
-#line 902 "reflect.h2"
+#line 917 "reflect.h2"
     [[nodiscard]] auto prefix_expression::is_result_a_temporary_variable() const& -> bool { return CPP2_UFCS(is_result_a_temporary_variable)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 904 "reflect.h2"
+#line 919 "reflect.h2"
     [[nodiscard]] auto prefix_expression::as_expression_list() const& -> expression_list { return { CPP2_UFCS(get_expression_list)((*cpp2::impl::assert_not_null((*this).n))), (*this) };  }
-#line 905 "reflect.h2"
+#line 920 "reflect.h2"
     [[nodiscard]] auto prefix_expression::as_literal() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_literal)(*cpp2::impl::assert_not_null(n))))); }
-#line 906 "reflect.h2"
+#line 921 "reflect.h2"
     [[nodiscard]] auto prefix_expression::as_identifier() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_identifier)(*cpp2::impl::assert_not_null(n))))); }
 
-#line 908 "reflect.h2"
+#line 923 "reflect.h2"
     [[nodiscard]] auto prefix_expression::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null((*this).n)));  }
 
     prefix_expression::~prefix_expression() noexcept{}
@@ -4357,32 +4379,32 @@ prefix_expression::prefix_expression(prefix_expression const& that)
 prefix_expression::prefix_expression(prefix_expression&& that) noexcept
                                      : reflection_base<prefix_expression_node>{ static_cast<reflection_base<prefix_expression_node>&&>(that) }{}
 
-#line 912 "reflect.h2"
+#line 927 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Postfix expressions
 //
 
-#line 919 "reflect.h2"
+#line 934 "reflect.h2"
     postfix_expression::postfix_expression(
 
         cpp2::impl::in<postfix_expression_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<postfix_expression_node>{ n_, s }
-#line 924 "reflect.h2"
+#line 939 "reflect.h2"
     {
 
     }
 
-#line 928 "reflect.h2"
+#line 943 "reflect.h2"
     [[nodiscard]] auto postfix_expression::get_primary_expression() const& -> primary_expression { return { CPP2_UFCS(get)((*cpp2::impl::assert_not_null((*this).n)).expr), (*this) };  }
 
-#line 934 "reflect.h2"
+#line 949 "reflect.h2"
         postfix_expression::term_t::term_t(auto&& term, auto&& cs)
                                                             : term_{ CPP2_FORWARD(term) }
                                                             , cs_{ CPP2_FORWARD(cs) }{}
 
-#line 936 "reflect.h2"
+#line 951 "reflect.h2"
         [[nodiscard]] auto postfix_expression::term_t::get_op() const& -> std::string_view { return CPP2_UFCS(as_string_view)((*cpp2::impl::assert_not_null((*cpp2::impl::assert_not_null(term_)).op))); }
 
         //  If op is        More is contained in the        Notes
@@ -4391,18 +4413,18 @@ prefix_expression::prefix_expression(prefix_expression&& that) noexcept
         //  [ (             expression_list                 subscript or function call
         //  ...             expression                      fold expression
 
-#line 944 "reflect.h2"
+#line 959 "reflect.h2"
         [[nodiscard]] auto postfix_expression::term_t::is_id_expression() const& -> bool { return CPP2_UFCS(get)((*cpp2::impl::assert_not_null(term_)).id_expr) != nullptr; }
-#line 945 "reflect.h2"
+#line 960 "reflect.h2"
         [[nodiscard]] auto postfix_expression::term_t::is_expression_list() const& -> bool { return CPP2_UFCS(get)((*cpp2::impl::assert_not_null(term_)).expr_list) != nullptr; }
-#line 946 "reflect.h2"
+#line 961 "reflect.h2"
         [[nodiscard]] auto postfix_expression::term_t::is_expression() const& -> bool { return CPP2_UFCS(get)((*cpp2::impl::assert_not_null(term_)).last_expr) != nullptr; }
 
-#line 948 "reflect.h2"
+#line 963 "reflect.h2"
         [[nodiscard]] auto postfix_expression::term_t::get_id_expression() const& -> id_expression { return { CPP2_UFCS(get)((*cpp2::impl::assert_not_null(term_)).id_expr), *cpp2::impl::assert_not_null(cs_) }; }
-#line 949 "reflect.h2"
+#line 964 "reflect.h2"
         [[nodiscard]] auto postfix_expression::term_t::get_expression_list() const& -> expression_list { return { CPP2_UFCS(get)((*cpp2::impl::assert_not_null(term_)).expr_list), *cpp2::impl::assert_not_null(cs_) };  }
-#line 950 "reflect.h2"
+#line 965 "reflect.h2"
         [[nodiscard]] auto postfix_expression::term_t::get_expression() const& -> expression { return { CPP2_UFCS(get)((*cpp2::impl::assert_not_null(term_)).last_expr), *cpp2::impl::assert_not_null(cs_) }; }
 
         postfix_expression::term_t::term_t(term_t const& that)
@@ -4412,46 +4434,46 @@ postfix_expression::term_t::term_t(term_t&& that) noexcept
                                      : term_{ std::move(that).term_ }
                                      , cs_{ std::move(that).cs_ }{}
 
-#line 953 "reflect.h2"
+#line 968 "reflect.h2"
     [[nodiscard]] auto postfix_expression::get_terms() const& -> auto{
         std::vector<term_t> ret {}; 
         for ( auto const& t : (*cpp2::impl::assert_not_null((*this).n)).ops ) {static_cast<void>(CPP2_UFCS(emplace_back)(ret, &t, &(*this))); }
         return ret; 
     }
 
-#line 959 "reflect.h2"
+#line 974 "reflect.h2"
     [[nodiscard]] auto postfix_expression::is_fold_expression() const& -> bool { return CPP2_UFCS(is_fold_expression)((*cpp2::impl::assert_not_null(n)));  }
-#line 960 "reflect.h2"
+#line 975 "reflect.h2"
     [[nodiscard]] auto postfix_expression::is_identifier() const& -> bool { return CPP2_UFCS(is_identifier)((*cpp2::impl::assert_not_null(n))); }
-#line 961 "reflect.h2"
+#line 976 "reflect.h2"
     [[nodiscard]] auto postfix_expression::is_id_expression() const& -> bool { return CPP2_UFCS(is_id_expression)((*cpp2::impl::assert_not_null(n))); }
-#line 962 "reflect.h2"
+#line 977 "reflect.h2"
     [[nodiscard]] auto postfix_expression::is_unqualified_id() const& -> bool { return CPP2_UFCS(is_unqualified_id)((*cpp2::impl::assert_not_null(n)));  }
-#line 963 "reflect.h2"
+#line 978 "reflect.h2"
     [[nodiscard]] auto postfix_expression::is_expression_list() const& -> bool { return CPP2_UFCS(is_expression_list)((*cpp2::impl::assert_not_null(n)));  }
-#line 964 "reflect.h2"
+#line 979 "reflect.h2"
     [[nodiscard]] auto postfix_expression::is_literal() const& -> bool { return CPP2_UFCS(is_literal)((*cpp2::impl::assert_not_null(n))); }
 
-#line 966 "reflect.h2"
+#line 981 "reflect.h2"
     [[nodiscard]] auto postfix_expression::as_identifier() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_identifier)(*cpp2::impl::assert_not_null(n))))); }
-#line 967 "reflect.h2"
+#line 982 "reflect.h2"
     [[nodiscard]] auto postfix_expression::as_expression_list() const& -> expression_list { return { CPP2_UFCS(get_expression_list)((*cpp2::impl::assert_not_null((*this).n))), (*this) };  }
-#line 968 "reflect.h2"
+#line 983 "reflect.h2"
     [[nodiscard]] auto postfix_expression::as_literal() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_literal)(*cpp2::impl::assert_not_null(n))))); }
 
-#line 970 "reflect.h2"
+#line 985 "reflect.h2"
     [[nodiscard]] auto postfix_expression::get_first_token_ignoring_this() const& -> std::string_view{
         auto ptok {CPP2_UFCS(get_first_token_ignoring_this)((*cpp2::impl::assert_not_null(n)))}; 
         if (ptok) {return *cpp2::impl::assert_not_null(cpp2::move(ptok)); }
         return ""; 
     }
 
-#line 976 "reflect.h2"
+#line 991 "reflect.h2"
     [[nodiscard]] auto postfix_expression::starts_with_function_call_with_num_parameters(cpp2::impl::in<int> num) const& -> bool { return CPP2_UFCS(starts_with_function_call_with_n_parameters)((*cpp2::impl::assert_not_null(n)), num);  }
-#line 977 "reflect.h2"
+#line 992 "reflect.h2"
     [[nodiscard]] auto postfix_expression::is_result_a_temporary_variable() const& -> bool { return CPP2_UFCS(is_result_a_temporary_variable)((*cpp2::impl::assert_not_null(n))); }
 
-#line 979 "reflect.h2"
+#line 994 "reflect.h2"
     [[nodiscard]] auto postfix_expression::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(n)));  }
 
     postfix_expression::postfix_expression(postfix_expression const& that)
@@ -4459,34 +4481,34 @@ postfix_expression::term_t::term_t(term_t&& that) noexcept
 postfix_expression::postfix_expression(postfix_expression&& that) noexcept
                                      : reflection_base<postfix_expression_node>{ static_cast<reflection_base<postfix_expression_node>&&>(that) }{}
 
-#line 983 "reflect.h2"
+#line 998 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Template arguments
 //
 
-#line 990 "reflect.h2"
+#line 1005 "reflect.h2"
     template_arg::template_arg(
 
         cpp2::impl::in<template_argument*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<template_argument>{ n_, s }
-#line 995 "reflect.h2"
+#line 1010 "reflect.h2"
     {
 
     }
 
-#line 999 "reflect.h2"
+#line 1014 "reflect.h2"
     [[nodiscard]] auto template_arg::is_expression() const& -> bool { return CPP2_UFCS(is_expression)((*cpp2::impl::assert_not_null(n)));  }
-#line 1000 "reflect.h2"
+#line 1015 "reflect.h2"
     [[nodiscard]] auto template_arg::is_type_id() const& -> bool { return CPP2_UFCS(is_type_id)((*cpp2::impl::assert_not_null(n))); }
 
-#line 1002 "reflect.h2"
+#line 1017 "reflect.h2"
     [[nodiscard]] auto template_arg::as_expression() const& -> expression { return { CPP2_UFCS(get_expression)((*cpp2::impl::assert_not_null((*this).n))), (*this) };  }
-#line 1003 "reflect.h2"
+#line 1018 "reflect.h2"
     [[nodiscard]] auto template_arg::as_type_id() const& -> type_id { return { CPP2_UFCS(get_type_id)((*cpp2::impl::assert_not_null((*this).n))), (*this) }; }
 
-#line 1005 "reflect.h2"
+#line 1020 "reflect.h2"
     [[nodiscard]] auto template_arg::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(n)));  }
 
     template_arg::template_arg(template_arg const& that)
@@ -4494,27 +4516,27 @@ postfix_expression::postfix_expression(postfix_expression&& that) noexcept
 template_arg::template_arg(template_arg&& that) noexcept
                                      : reflection_base<template_argument>{ static_cast<reflection_base<template_argument>&&>(that) }{}
 
-#line 1009 "reflect.h2"
+#line 1024 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Unqualified IDs
 //
 
-#line 1016 "reflect.h2"
+#line 1031 "reflect.h2"
     unqualified_id::unqualified_id(
 
         cpp2::impl::in<unqualified_id_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<unqualified_id_node>{ n_, s }
-#line 1021 "reflect.h2"
+#line 1036 "reflect.h2"
     {
 
     }
 
-#line 1025 "reflect.h2"
+#line 1040 "reflect.h2"
     [[nodiscard]] auto unqualified_id::is_identifier() const& -> bool { return CPP2_UFCS(is_identifier)((*cpp2::impl::assert_not_null(n))); }
 
-#line 1027 "reflect.h2"
+#line 1042 "reflect.h2"
     [[nodiscard]] auto unqualified_id::get_identifier() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_identifier)(*cpp2::impl::assert_not_null(n)))));  }
 
     //get_template_args: (this) -> std::vector<template_arg> = {
@@ -4523,10 +4545,10 @@ template_arg::template_arg(template_arg&& that) noexcept
     //    return ret;
     //}
 
-#line 1035 "reflect.h2"
+#line 1050 "reflect.h2"
     [[nodiscard]] auto unqualified_id::as_token() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_token)(*cpp2::impl::assert_not_null(n)))));  }
 
-#line 1037 "reflect.h2"
+#line 1052 "reflect.h2"
     [[nodiscard]] auto unqualified_id::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(n)));  }
 
     unqualified_id::unqualified_id(unqualified_id const& that)
@@ -4534,31 +4556,31 @@ template_arg::template_arg(template_arg&& that) noexcept
 unqualified_id::unqualified_id(unqualified_id&& that) noexcept
                                      : reflection_base<unqualified_id_node>{ static_cast<reflection_base<unqualified_id_node>&&>(that) }{}
 
-#line 1041 "reflect.h2"
+#line 1056 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Qualified IDs
 //
 
-#line 1048 "reflect.h2"
+#line 1063 "reflect.h2"
     qualified_id::qualified_id(
 
         cpp2::impl::in<qualified_id_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<qualified_id_node>{ n_, s }
-#line 1053 "reflect.h2"
+#line 1068 "reflect.h2"
     {
 
     }
 
-#line 1061 "reflect.h2"
+#line 1076 "reflect.h2"
         qualified_id::term_t::term_t(auto&& o, auto&& ptr, auto&& cs)
                                                                       : op{ CPP2_FORWARD(o) }
                                                                       , unqualified{ CPP2_FORWARD(ptr), CPP2_FORWARD(cs) }{}
 
-#line 1063 "reflect.h2"
+#line 1078 "reflect.h2"
         [[nodiscard]] auto qualified_id::term_t::get_op() const& -> std::string { return op; }
-#line 1064 "reflect.h2"
+#line 1079 "reflect.h2"
         [[nodiscard]] auto qualified_id::term_t::get_unqualified() const& -> unqualified_id { return unqualified;  }
 
         qualified_id::term_t::term_t(term_t const& that)
@@ -4568,7 +4590,7 @@ qualified_id::term_t::term_t(term_t&& that) noexcept
                                      : op{ std::move(that).op }
                                      , unqualified{ std::move(that).unqualified }{}
 
-#line 1067 "reflect.h2"
+#line 1082 "reflect.h2"
     [[nodiscard]] auto qualified_id::get_terms() const& -> auto{
         std::vector<term_t> ret {}; 
         for ( auto const& t : (*cpp2::impl::assert_not_null((*this).n)).ids ) {static_cast<void>(CPP2_UFCS(emplace_back)(ret, *cpp2::impl::assert_not_null(t.scope_op), CPP2_UFCS(get)(t.id), (*this))); }
@@ -4581,10 +4603,10 @@ qualified_id::term_t::term_t(term_t&& that) noexcept
     //    return ret;
     //}
 
-#line 1079 "reflect.h2"
+#line 1094 "reflect.h2"
     [[nodiscard]] auto qualified_id::as_token() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_token)(*cpp2::impl::assert_not_null(n)))));  }
 
-#line 1081 "reflect.h2"
+#line 1096 "reflect.h2"
     [[nodiscard]] auto qualified_id::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(n)));  }
 
     qualified_id::qualified_id(qualified_id const& that)
@@ -4592,19 +4614,19 @@ qualified_id::term_t::term_t(term_t&& that) noexcept
 qualified_id::qualified_id(qualified_id&& that) noexcept
                                      : reflection_base<qualified_id_node>{ static_cast<reflection_base<qualified_id_node>&&>(that) }{}
 
-#line 1085 "reflect.h2"
+#line 1100 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Type IDs
 //
 
-#line 1092 "reflect.h2"
+#line 1107 "reflect.h2"
     type_id::type_id(
 
         cpp2::impl::in<type_id_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<type_id_node>{ n_, s }
-#line 1097 "reflect.h2"
+#line 1112 "reflect.h2"
     {
 
     }
@@ -4615,37 +4637,37 @@ qualified_id::qualified_id(qualified_id&& that) noexcept
     //    return ret;
     //}
 
-#line 1107 "reflect.h2"
+#line 1122 "reflect.h2"
     [[nodiscard]] auto type_id::is_postfix_expression() const& -> bool { return CPP2_UFCS(is_postfix_expression)((*cpp2::impl::assert_not_null((*this).n)));  }
-#line 1108 "reflect.h2"
+#line 1123 "reflect.h2"
     [[nodiscard]] auto type_id::is_qualified_id() const& -> bool { return CPP2_UFCS(is_qualified_id)((*cpp2::impl::assert_not_null((*this).n))); }
-#line 1109 "reflect.h2"
+#line 1124 "reflect.h2"
     [[nodiscard]] auto type_id::is_unqualified_id() const& -> bool { return CPP2_UFCS(is_unqualified_id)((*cpp2::impl::assert_not_null((*this).n))); }
-#line 1110 "reflect.h2"
+#line 1125 "reflect.h2"
     [[nodiscard]] auto type_id::is_function_typeid() const& -> bool { return CPP2_UFCS(is_function_typeid)((*cpp2::impl::assert_not_null((*this).n))); }
-#line 1111 "reflect.h2"
+#line 1126 "reflect.h2"
     [[nodiscard]] auto type_id::is_keyword() const& -> bool { return CPP2_UFCS(is_keyword)((*cpp2::impl::assert_not_null((*this).n))); }
-#line 1112 "reflect.h2"
+#line 1127 "reflect.h2"
     [[nodiscard]] auto type_id::is_wildcard() const& -> bool { return CPP2_UFCS(is_wildcard)((*cpp2::impl::assert_not_null((*this).n))); }
-#line 1113 "reflect.h2"
+#line 1128 "reflect.h2"
     [[nodiscard]] auto type_id::is_pointer_qualified() const& -> bool { return CPP2_UFCS(is_pointer_qualified)((*cpp2::impl::assert_not_null((*this).n)));  }
-#line 1114 "reflect.h2"
+#line 1129 "reflect.h2"
     [[nodiscard]] auto type_id::is_concept() const& -> bool { return CPP2_UFCS(is_concept)((*cpp2::impl::assert_not_null((*this).n))); }
 
-#line 1116 "reflect.h2"
+#line 1131 "reflect.h2"
     [[nodiscard]] auto type_id::as_postfix_expression() const& -> postfix_expression { return { CPP2_UFCS(get_postfix_expression)((*cpp2::impl::assert_not_null(n))), (*this) };  }
-#line 1117 "reflect.h2"
+#line 1132 "reflect.h2"
     [[nodiscard]] auto type_id::as_qualified_id() const& -> qualified_id { return { CPP2_UFCS(get_qualified_id)((*cpp2::impl::assert_not_null(n))), (*this) }; }
-#line 1118 "reflect.h2"
+#line 1133 "reflect.h2"
     [[nodiscard]] auto type_id::as_unqualified_id() const& -> unqualified_id { return { CPP2_UFCS(get_unqualified_id)((*cpp2::impl::assert_not_null(n))), (*this) }; }
     // TODO
     //as_function_typeid   : (this) -> function_typeid    = (n*.get_function_typeid(),    this);
-#line 1121 "reflect.h2"
+#line 1136 "reflect.h2"
     [[nodiscard]] auto type_id::as_keyword() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_keyword)(*cpp2::impl::assert_not_null(n))))); }
-#line 1122 "reflect.h2"
+#line 1137 "reflect.h2"
     [[nodiscard]] auto type_id::as_token() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_token)(*cpp2::impl::assert_not_null(n))))); }
 
-#line 1124 "reflect.h2"
+#line 1139 "reflect.h2"
     [[nodiscard]] auto type_id::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(n)));  }
 
     type_id::type_id(type_id const& that)
@@ -4653,19 +4675,19 @@ qualified_id::qualified_id(qualified_id&& that) noexcept
 type_id::type_id(type_id&& that) noexcept
                                      : reflection_base<type_id_node>{ static_cast<reflection_base<type_id_node>&&>(that) }{}
 
-#line 1128 "reflect.h2"
+#line 1143 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Primary expressions
 //
 
-#line 1135 "reflect.h2"
+#line 1150 "reflect.h2"
     primary_expression::primary_expression(
 
         cpp2::impl::in<primary_expression_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<primary_expression_node>{ n_, s }
-#line 1140 "reflect.h2"
+#line 1155 "reflect.h2"
     {
 
     }
@@ -4676,31 +4698,31 @@ type_id::type_id(type_id&& that) noexcept
     //    return ret;
     //}
 
-#line 1150 "reflect.h2"
+#line 1165 "reflect.h2"
     [[nodiscard]] auto primary_expression::is_fold_expression() const& -> bool { return CPP2_UFCS(is_fold_expression)((*cpp2::impl::assert_not_null(n)));  }
-#line 1151 "reflect.h2"
+#line 1166 "reflect.h2"
     [[nodiscard]] auto primary_expression::is_identifier() const& -> bool { return CPP2_UFCS(is_identifier)((*cpp2::impl::assert_not_null(n))); }
-#line 1152 "reflect.h2"
+#line 1167 "reflect.h2"
     [[nodiscard]] auto primary_expression::is_id_expression() const& -> bool { return CPP2_UFCS(is_id_expression)((*cpp2::impl::assert_not_null(n))); }
-#line 1153 "reflect.h2"
+#line 1168 "reflect.h2"
     [[nodiscard]] auto primary_expression::is_unqualified_id() const& -> bool { return CPP2_UFCS(is_unqualified_id)((*cpp2::impl::assert_not_null(n)));  }
-#line 1154 "reflect.h2"
+#line 1169 "reflect.h2"
     [[nodiscard]] auto primary_expression::is_expression_list() const& -> bool { return CPP2_UFCS(is_expression_list)((*cpp2::impl::assert_not_null(n)));  }
-#line 1155 "reflect.h2"
+#line 1170 "reflect.h2"
     [[nodiscard]] auto primary_expression::is_literal() const& -> bool { return CPP2_UFCS(is_literal)((*cpp2::impl::assert_not_null(n))); }
-#line 1156 "reflect.h2"
+#line 1171 "reflect.h2"
     [[nodiscard]] auto primary_expression::is_declaration() const& -> bool { return CPP2_UFCS(is_declaration)((*cpp2::impl::assert_not_null(n))); }
 
-#line 1158 "reflect.h2"
+#line 1173 "reflect.h2"
     [[nodiscard]] auto primary_expression::as_identifier() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_identifier)(*cpp2::impl::assert_not_null(n))))); }
-#line 1159 "reflect.h2"
+#line 1174 "reflect.h2"
     [[nodiscard]] auto primary_expression::as_expression_list() const& -> expression_list { return { CPP2_UFCS(get_expression_list)((*cpp2::impl::assert_not_null((*this).n))), (*this) };  }
-#line 1160 "reflect.h2"
+#line 1175 "reflect.h2"
     [[nodiscard]] auto primary_expression::as_literal() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_literal)(*cpp2::impl::assert_not_null(n))))); }
-#line 1161 "reflect.h2"
+#line 1176 "reflect.h2"
     [[nodiscard]] auto primary_expression::as_declaration() const& -> declaration { return { CPP2_UFCS(get_declaration)((*cpp2::impl::assert_not_null((*this).n))), (*this) }; }
 
-#line 1163 "reflect.h2"
+#line 1178 "reflect.h2"
     [[nodiscard]] auto primary_expression::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(n)));  }
 
     primary_expression::primary_expression(primary_expression const& that)
@@ -4708,19 +4730,19 @@ type_id::type_id(type_id&& that) noexcept
 primary_expression::primary_expression(primary_expression&& that) noexcept
                                      : reflection_base<primary_expression_node>{ static_cast<reflection_base<primary_expression_node>&&>(that) }{}
 
-#line 1167 "reflect.h2"
+#line 1182 "reflect.h2"
 //-----------------------------------------------------------------------
 //  ID expression
 //
 
-#line 1174 "reflect.h2"
+#line 1189 "reflect.h2"
     id_expression::id_expression(
 
         cpp2::impl::in<id_expression_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<id_expression_node>{ n_, s }
-#line 1179 "reflect.h2"
+#line 1194 "reflect.h2"
     {
 
     }
@@ -4731,25 +4753,25 @@ primary_expression::primary_expression(primary_expression&& that) noexcept
     //    return ret;
     //}
 
-#line 1189 "reflect.h2"
+#line 1204 "reflect.h2"
     [[nodiscard]] auto id_expression::is_fold_expression() const& -> bool { return CPP2_UFCS(is_fold_expression)((*cpp2::impl::assert_not_null(n))); }
-#line 1190 "reflect.h2"
+#line 1205 "reflect.h2"
     [[nodiscard]] auto id_expression::is_empty() const& -> bool { return CPP2_UFCS(is_empty)((*cpp2::impl::assert_not_null(n))); }
-#line 1191 "reflect.h2"
+#line 1206 "reflect.h2"
     [[nodiscard]] auto id_expression::is_identifier() const& -> bool { return CPP2_UFCS(is_identifier)((*cpp2::impl::assert_not_null(n))); }
-#line 1192 "reflect.h2"
+#line 1207 "reflect.h2"
     [[nodiscard]] auto id_expression::is_qualified() const& -> bool { return CPP2_UFCS(is_qualified)((*cpp2::impl::assert_not_null(n))); }
-#line 1193 "reflect.h2"
+#line 1208 "reflect.h2"
     [[nodiscard]] auto id_expression::is_unqualified() const& -> bool { return CPP2_UFCS(is_unqualified)((*cpp2::impl::assert_not_null(n))); }
 
-#line 1195 "reflect.h2"
+#line 1210 "reflect.h2"
     [[nodiscard]] auto id_expression::as_identifier() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_identifier)(*cpp2::impl::assert_not_null(n))))); }
-#line 1196 "reflect.h2"
+#line 1211 "reflect.h2"
     [[nodiscard]] auto id_expression::as_qualified() const& -> qualified_id { return { CPP2_UFCS(get_qualified_id)((*cpp2::impl::assert_not_null(n))), (*this) }; }
-#line 1197 "reflect.h2"
+#line 1212 "reflect.h2"
     [[nodiscard]] auto id_expression::as_unqualified() const& -> unqualified_id { return { CPP2_UFCS(get_unqualified_id)((*cpp2::impl::assert_not_null(n))), (*this) }; }
 
-#line 1199 "reflect.h2"
+#line 1214 "reflect.h2"
     [[nodiscard]] auto id_expression::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(n)));  }
 
     id_expression::~id_expression() noexcept{}
@@ -4758,71 +4780,71 @@ id_expression::id_expression(id_expression const& that)
 id_expression::id_expression(id_expression&& that) noexcept
                                      : reflection_base<id_expression_node>{ static_cast<reflection_base<id_expression_node>&&>(that) }{}
 
-#line 1203 "reflect.h2"
+#line 1218 "reflect.h2"
 //-----------------------------------------------------------------------
 //  General expression
 //
 
-#line 1210 "reflect.h2"
+#line 1225 "reflect.h2"
     expression::expression(
 
         cpp2::impl::in<expression_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<expression_node>{ n_, s }
-#line 1215 "reflect.h2"
+#line 1230 "reflect.h2"
     {
 
     }
 
-#line 1219 "reflect.h2"
+#line 1234 "reflect.h2"
     [[nodiscard]] auto expression::is_fold_expression() const& -> bool { return CPP2_UFCS(is_fold_expression)((*cpp2::impl::assert_not_null(n))); }
-#line 1220 "reflect.h2"
+#line 1235 "reflect.h2"
     [[nodiscard]] auto expression::is_standalone_expression() const& -> bool { return CPP2_UFCS(is_standalone_expression)((*cpp2::impl::assert_not_null(n)));  }
-#line 1221 "reflect.h2"
+#line 1236 "reflect.h2"
     [[nodiscard]] auto expression::subexpression_count() const& -> int { return CPP2_UFCS(subexpression_count)((*cpp2::impl::assert_not_null(n))); }
-#line 1222 "reflect.h2"
+#line 1237 "reflect.h2"
     [[nodiscard]] auto expression::is_identifier() const& -> bool { return CPP2_UFCS(is_identifier)((*cpp2::impl::assert_not_null(n))); }
-#line 1223 "reflect.h2"
+#line 1238 "reflect.h2"
     [[nodiscard]] auto expression::is_id_expression() const& -> bool { return CPP2_UFCS(is_id_expression)((*cpp2::impl::assert_not_null(n))); }
-#line 1224 "reflect.h2"
+#line 1239 "reflect.h2"
     [[nodiscard]] auto expression::is_unqualified_id() const& -> bool { return CPP2_UFCS(is_unqualified_id)((*cpp2::impl::assert_not_null(n))); }
-#line 1225 "reflect.h2"
+#line 1240 "reflect.h2"
     [[nodiscard]] auto expression::is_expression_list() const& -> bool { return CPP2_UFCS(is_expression_list)((*cpp2::impl::assert_not_null(n))); }
-#line 1226 "reflect.h2"
+#line 1241 "reflect.h2"
     [[nodiscard]] auto expression::is_empty_expression_list() const& -> bool { return CPP2_UFCS(is_empty_expression_list)((*cpp2::impl::assert_not_null(n)));  }
-#line 1227 "reflect.h2"
+#line 1242 "reflect.h2"
     [[nodiscard]] auto expression::is_literal() const& -> bool { return CPP2_UFCS(is_literal)((*cpp2::impl::assert_not_null(n))); }
-#line 1228 "reflect.h2"
+#line 1243 "reflect.h2"
     [[nodiscard]] auto expression::is_assignment_expression() const& -> bool { return CPP2_UFCS(is_assignment_expression)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 1230 "reflect.h2"
+#line 1245 "reflect.h2"
     [[nodiscard]] auto expression::is_simple_assignment() const& -> bool{
         auto ret {CPP2_UFCS(get_lhs_rhs_if_simple_assignment)((*cpp2::impl::assert_not_null(n)))}; 
         return ret.lhs && ret.rhs; 
     }
 
-#line 1235 "reflect.h2"
+#line 1250 "reflect.h2"
     [[nodiscard]] auto expression::get_lhs_rhs_if_simple_assignment() const& -> get_lhs_rhs_if_simple_assignment_ret
 
-#line 1240 "reflect.h2"
+#line 1255 "reflect.h2"
     {
             cpp2::impl::deferred_init<postfix_expression> lhs;
             cpp2::impl::deferred_init<logical_or_expression> rhs;
-#line 1241 "reflect.h2"
+#line 1256 "reflect.h2"
         auto ret {CPP2_UFCS(get_lhs_rhs_if_simple_assignment)((*cpp2::impl::assert_not_null(n)))}; 
         lhs.construct(ret.lhs, (*this));
         rhs.construct(cpp2::move(ret).rhs, (*this));
     return  { std::move(lhs.value()), std::move(rhs.value()) }; }
 
-#line 1246 "reflect.h2"
+#line 1261 "reflect.h2"
     [[nodiscard]] auto expression::as_assignment_expression() const& -> assignment_expression { return { CPP2_UFCS(get_assignment_expression)((*cpp2::impl::assert_not_null(n))), (*this) };  }
-#line 1247 "reflect.h2"
+#line 1262 "reflect.h2"
     [[nodiscard]] auto expression::as_expression_list() const& -> expression_list { return { CPP2_UFCS(get_expression_list)((*cpp2::impl::assert_not_null(n))), (*this) }; }
-#line 1248 "reflect.h2"
+#line 1263 "reflect.h2"
     [[nodiscard]] auto expression::as_literal() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_literal)(*cpp2::impl::assert_not_null(n))))); }
 
-#line 1250 "reflect.h2"
+#line 1265 "reflect.h2"
     [[nodiscard]] auto expression::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(n)));  }
 
     expression::~expression() noexcept{}
@@ -4831,31 +4853,31 @@ expression::expression(expression const& that)
 expression::expression(expression&& that) noexcept
                                      : reflection_base<expression_node>{ static_cast<reflection_base<expression_node>&&>(that) }{}
 
-#line 1254 "reflect.h2"
+#line 1269 "reflect.h2"
 //-----------------------------------------------------------------------
 //  is_as_expression
 //
 
-#line 1261 "reflect.h2"
+#line 1276 "reflect.h2"
     is_as_expression::is_as_expression(
 
         cpp2::impl::in<is_as_expression_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<is_as_expression_node>{ n_, s }
-#line 1266 "reflect.h2"
+#line 1281 "reflect.h2"
     {
 
     }
 
-#line 1274 "reflect.h2"
+#line 1289 "reflect.h2"
         is_as_expression::term_t::term_t(auto&& o, auto&& ptr, auto&& cs)
                                                                       : op{ CPP2_FORWARD(o) }
                                                                       , expr{ CPP2_FORWARD(ptr), CPP2_FORWARD(cs) }{}
 
-#line 1276 "reflect.h2"
+#line 1291 "reflect.h2"
         [[nodiscard]] auto is_as_expression::term_t::get_op() const& -> std::string { return op; }
-#line 1277 "reflect.h2"
+#line 1292 "reflect.h2"
         [[nodiscard]] auto is_as_expression::term_t::get_expr() const& -> expression { return expr; }
 
         is_as_expression::term_t::term_t(term_t const& that)
@@ -4865,42 +4887,42 @@ is_as_expression::term_t::term_t(term_t&& that) noexcept
                                      : op{ std::move(that).op }
                                      , expr{ std::move(that).expr }{}
 
-#line 1280 "reflect.h2"
+#line 1295 "reflect.h2"
     [[nodiscard]] auto is_as_expression::get_expression() const& -> prefix_expression { return { CPP2_UFCS(get)((*cpp2::impl::assert_not_null(n)).expr), (*this) };  }
 
-#line 1282 "reflect.h2"
+#line 1297 "reflect.h2"
     [[nodiscard]] auto is_as_expression::get_terms() const& -> auto{
         std::vector<term_t> ret {}; 
         for ( auto const& t : (*cpp2::impl::assert_not_null((*this).n)).ops ) {static_cast<void>(CPP2_UFCS(emplace_back)(ret, *cpp2::impl::assert_not_null(t.op), CPP2_UFCS(get)(t.expr), (*this))); }
         return ret; 
     }
 
-#line 1288 "reflect.h2"
+#line 1303 "reflect.h2"
     [[nodiscard]] auto is_as_expression::is_fold_expression() const& -> bool { return CPP2_UFCS(is_fold_expression)((*cpp2::impl::assert_not_null((*this).n)));  }
-#line 1289 "reflect.h2"
+#line 1304 "reflect.h2"
     [[nodiscard]] auto is_as_expression::is_identifier() const& -> bool { return CPP2_UFCS(is_identifier)((*cpp2::impl::assert_not_null((*this).n))); }
-#line 1290 "reflect.h2"
+#line 1305 "reflect.h2"
     [[nodiscard]] auto is_as_expression::is_id_expression() const& -> bool { return CPP2_UFCS(is_id_expression)((*cpp2::impl::assert_not_null((*this).n))); }
-#line 1291 "reflect.h2"
+#line 1306 "reflect.h2"
     [[nodiscard]] auto is_as_expression::is_unqualified_id() const& -> bool { return CPP2_UFCS(is_unqualified_id)((*cpp2::impl::assert_not_null((*this).n)));  }
-#line 1292 "reflect.h2"
+#line 1307 "reflect.h2"
     [[nodiscard]] auto is_as_expression::is_expression_list() const& -> bool { return CPP2_UFCS(is_expression_list)((*cpp2::impl::assert_not_null((*this).n)));  }
-#line 1293 "reflect.h2"
+#line 1308 "reflect.h2"
     [[nodiscard]] auto is_as_expression::is_literal() const& -> bool { return CPP2_UFCS(is_literal)((*cpp2::impl::assert_not_null((*this).n))); }
 
-#line 1295 "reflect.h2"
+#line 1310 "reflect.h2"
     [[nodiscard]] auto is_as_expression::as_expression_list() const& -> expression_list { return { CPP2_UFCS(get_expression_list)((*cpp2::impl::assert_not_null((*this).n))), (*this) };  }
-#line 1296 "reflect.h2"
+#line 1311 "reflect.h2"
     [[nodiscard]] auto is_as_expression::as_literal() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_literal)(*cpp2::impl::assert_not_null(n))))); }
 
-#line 1298 "reflect.h2"
+#line 1313 "reflect.h2"
     [[nodiscard]] auto is_as_expression::get_identifier() const& -> std::string_view{
         auto ptok {CPP2_UFCS(get_identifier)((*cpp2::impl::assert_not_null((*this).n)))}; 
         if (ptok) {return *cpp2::impl::assert_not_null(cpp2::move(ptok)); }
         return ""; 
     }
 
-#line 1304 "reflect.h2"
+#line 1319 "reflect.h2"
     [[nodiscard]] auto is_as_expression::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null((*this).n)));  }
 
     is_as_expression::~is_as_expression() noexcept{}
@@ -4909,7 +4931,7 @@ is_as_expression::is_as_expression(is_as_expression const& that)
 is_as_expression::is_as_expression(is_as_expression&& that) noexcept
                                      : reflection_base<is_as_expression_node>{ static_cast<reflection_base<is_as_expression_node>&&>(that) }{}
 
-#line 1308 "reflect.h2"
+#line 1323 "reflect.h2"
 //-----------------------------------------------------------------------
 // 
 //  Statements
@@ -4921,19 +4943,19 @@ is_as_expression::is_as_expression(is_as_expression&& that) noexcept
 //  General statement
 //
 
-#line 1322 "reflect.h2"
+#line 1337 "reflect.h2"
     statement::statement(
 
         cpp2::impl::in<statement_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<statement_node>{ n_, s }
-#line 1327 "reflect.h2"
+#line 1342 "reflect.h2"
     {
 
     }
 
-#line 1331 "reflect.h2"
+#line 1346 "reflect.h2"
     [[nodiscard]] auto statement::get_parameters() const& -> std::vector<parameter_declaration>
 
     {
@@ -4944,45 +4966,45 @@ is_as_expression::is_as_expression(is_as_expression&& that) noexcept
         return ret; 
     }
 
-#line 1341 "reflect.h2"
+#line 1356 "reflect.h2"
     [[nodiscard]] auto statement::is_expression_statement() const& -> bool { return CPP2_UFCS(is_expression)((*cpp2::impl::assert_not_null(n)));  }
-#line 1342 "reflect.h2"
+#line 1357 "reflect.h2"
     [[nodiscard]] auto statement::is_compound_statement() const& -> bool { return CPP2_UFCS(is_compound)((*cpp2::impl::assert_not_null(n))); }
-#line 1343 "reflect.h2"
+#line 1358 "reflect.h2"
     [[nodiscard]] auto statement::is_selection_statement() const& -> bool { return CPP2_UFCS(is_selection)((*cpp2::impl::assert_not_null(n))); }
-#line 1344 "reflect.h2"
+#line 1359 "reflect.h2"
     [[nodiscard]] auto statement::is_declaration() const& -> bool { return CPP2_UFCS(is_declaration)((*cpp2::impl::assert_not_null(n))); }
-#line 1345 "reflect.h2"
+#line 1360 "reflect.h2"
     [[nodiscard]] auto statement::is_return_statement() const& -> bool { return CPP2_UFCS(is_return)((*cpp2::impl::assert_not_null(n))); }
-#line 1346 "reflect.h2"
+#line 1361 "reflect.h2"
     [[nodiscard]] auto statement::is_iteration_statement() const& -> bool { return CPP2_UFCS(is_iteration)((*cpp2::impl::assert_not_null(n))); }
-#line 1347 "reflect.h2"
+#line 1362 "reflect.h2"
     [[nodiscard]] auto statement::is_using_statement() const& -> bool { return CPP2_UFCS(is_using)((*cpp2::impl::assert_not_null(n))); }
-#line 1348 "reflect.h2"
+#line 1363 "reflect.h2"
     [[nodiscard]] auto statement::is_contract() const& -> bool { return CPP2_UFCS(is_contract)((*cpp2::impl::assert_not_null(n))); }
-#line 1349 "reflect.h2"
+#line 1364 "reflect.h2"
     [[nodiscard]] auto statement::is_inspect_expression() const& -> bool { return CPP2_UFCS(is_inspect)((*cpp2::impl::assert_not_null(n))); }
-#line 1350 "reflect.h2"
+#line 1365 "reflect.h2"
     [[nodiscard]] auto statement::is_jump_statement() const& -> bool { return CPP2_UFCS(is_jump)((*cpp2::impl::assert_not_null(n))); }
 
-#line 1352 "reflect.h2"
+#line 1367 "reflect.h2"
     [[nodiscard]] auto statement::as_expression_statement() const& -> expression_statement { return { CPP2_UFCS_TEMPLATE(get_if<expression_statement_node>)((*cpp2::impl::assert_not_null(n))), (*this) }; }
-#line 1353 "reflect.h2"
+#line 1368 "reflect.h2"
     [[nodiscard]] auto statement::as_compound_statement() const& -> compound_statement { return { CPP2_UFCS_TEMPLATE(get_if<compound_statement_node>)((*cpp2::impl::assert_not_null(n))), (*this) }; }
-#line 1354 "reflect.h2"
+#line 1369 "reflect.h2"
     [[nodiscard]] auto statement::as_selection_statement() const& -> selection_statement { return selection_statement(CPP2_UFCS_TEMPLATE(get_if<selection_statement_node>)((*cpp2::impl::assert_not_null(n))), (*this)); }
-#line 1355 "reflect.h2"
+#line 1370 "reflect.h2"
     [[nodiscard]] auto statement::as_declaration() const& -> declaration { return declaration(CPP2_UFCS_TEMPLATE(get_if<declaration_node>)((*cpp2::impl::assert_not_null(n))), (*this)); }
-#line 1356 "reflect.h2"
+#line 1371 "reflect.h2"
     [[nodiscard]] auto statement::as_return_statement() const& -> return_statement { return return_statement(CPP2_UFCS_TEMPLATE(get_if<return_statement_node>)((*cpp2::impl::assert_not_null(n))), (*this)); }
-#line 1357 "reflect.h2"
+#line 1372 "reflect.h2"
     [[nodiscard]] auto statement::as_iteration_statement() const& -> iteration_statement { return iteration_statement(CPP2_UFCS_TEMPLATE(get_if<iteration_statement_node>)((*cpp2::impl::assert_not_null(n))), (*this)); }
     //as_using_statement      : (this) -> using_statement       = using_statement      (n*.get_if<using_statement_node>(), this);
     //as_contract             : (this) -> contract              = contract             (n*.get_if<contract_node>(), this);
     //as_inspect_expression   : (this) -> inspect_expression    = inspect_expression   (n*.get_if<inspect_expression_node>(), this);
     //as_jump_statement       : (this) -> jump_statement        = jump_statement       (n*.get_if<jump_statement_node>(), this);
 
-#line 1363 "reflect.h2"
+#line 1378 "reflect.h2"
     [[nodiscard]] auto statement::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(n)));  }
 
     statement::~statement() noexcept{}
@@ -4991,27 +5013,27 @@ statement::statement(statement const& that)
 statement::statement(statement&& that) noexcept
                                      : reflection_base<statement_node>{ static_cast<reflection_base<statement_node>&&>(that) }{}
 
-#line 1367 "reflect.h2"
+#line 1382 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Expression statements
 //
 
-#line 1374 "reflect.h2"
+#line 1389 "reflect.h2"
     expression_statement::expression_statement(
 
         cpp2::impl::in<expression_statement_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<expression_statement_node>{ n_, s }
-#line 1379 "reflect.h2"
+#line 1394 "reflect.h2"
     {
 
     }
 
-#line 1383 "reflect.h2"
+#line 1398 "reflect.h2"
     [[nodiscard]] auto expression_statement::get_expression() const& -> expression { return { CPP2_UFCS(get)((*cpp2::impl::assert_not_null(n)).expr), (*this) }; }
 
-#line 1385 "reflect.h2"
+#line 1400 "reflect.h2"
     [[nodiscard]] auto expression_statement::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(n))); }
 
     expression_statement::expression_statement(expression_statement const& that)
@@ -5019,24 +5041,24 @@ statement::statement(statement&& that) noexcept
 expression_statement::expression_statement(expression_statement&& that) noexcept
                                      : reflection_base<expression_statement_node>{ static_cast<reflection_base<expression_statement_node>&&>(that) }{}
 
-#line 1389 "reflect.h2"
+#line 1404 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Compound statements
 //
 
-#line 1396 "reflect.h2"
+#line 1411 "reflect.h2"
     compound_statement::compound_statement(
 
         cpp2::impl::in<compound_statement_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<compound_statement_node>{ n_, s }
-#line 1401 "reflect.h2"
+#line 1416 "reflect.h2"
     {
 
     }
 
-#line 1405 "reflect.h2"
+#line 1420 "reflect.h2"
     [[nodiscard]] auto compound_statement::get_statements() const& -> std::vector<statement>
 
     {
@@ -5047,7 +5069,7 @@ expression_statement::expression_statement(expression_statement&& that) noexcept
         return ret; 
     }
 
-#line 1415 "reflect.h2"
+#line 1430 "reflect.h2"
     auto compound_statement::add_statement(cpp2::impl::in<std::string_view> source, cpp2::impl::in<int> before_position) & -> void
     {
         auto stmt {parse_statement(source)}; 
@@ -5064,35 +5086,35 @@ expression_statement::expression_statement(expression_statement&& that) noexcept
 compound_statement::compound_statement(compound_statement&& that) noexcept
                                      : reflection_base<compound_statement_node>{ static_cast<reflection_base<compound_statement_node>&&>(that) }{}
 
-#line 1428 "reflect.h2"
+#line 1443 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Selection statements
 //
 
-#line 1435 "reflect.h2"
+#line 1450 "reflect.h2"
     selection_statement::selection_statement(
 
         cpp2::impl::in<selection_statement_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<selection_statement_node>{ n_, s }
-#line 1440 "reflect.h2"
+#line 1455 "reflect.h2"
     {
 
     }
 
-#line 1444 "reflect.h2"
+#line 1459 "reflect.h2"
     [[nodiscard]] auto selection_statement::has_false_branch_in_source_code() const& -> bool { return CPP2_UFCS(has_false_branch_in_source_code)((*cpp2::impl::assert_not_null(n)));  }
-#line 1445 "reflect.h2"
+#line 1460 "reflect.h2"
     [[nodiscard]] auto selection_statement::has_false_branch() const& -> bool { return CPP2_UFCS(has_false_branch)((*cpp2::impl::assert_not_null(n))); }
 
-#line 1447 "reflect.h2"
+#line 1462 "reflect.h2"
     [[nodiscard]] auto selection_statement::get_identifier() const& -> std::string_view { return CPP2_UFCS(as_string_view)((*cpp2::impl::assert_not_null(CPP2_UFCS(get_identifier)(*cpp2::impl::assert_not_null(n))))); }
-#line 1448 "reflect.h2"
+#line 1463 "reflect.h2"
     [[nodiscard]] auto selection_statement::get_expression() const& -> logical_or_expression { return { CPP2_UFCS(get_expression)((*cpp2::impl::assert_not_null(n))), (*this) }; }
-#line 1449 "reflect.h2"
+#line 1464 "reflect.h2"
     [[nodiscard]] auto selection_statement::get_true_branch() const& -> compound_statement { return { CPP2_UFCS(get_true_branch)((*cpp2::impl::assert_not_null(n))), (*this) }; }
-#line 1450 "reflect.h2"
+#line 1465 "reflect.h2"
     [[nodiscard]] auto selection_statement::get_false_branch() const& -> compound_statement { return { CPP2_UFCS(get_false_branch)((*cpp2::impl::assert_not_null(n))), (*this) }; }
 
     selection_statement::selection_statement(selection_statement const& that)
@@ -5100,27 +5122,27 @@ compound_statement::compound_statement(compound_statement&& that) noexcept
 selection_statement::selection_statement(selection_statement&& that) noexcept
                                      : reflection_base<selection_statement_node>{ static_cast<reflection_base<selection_statement_node>&&>(that) }{}
 
-#line 1454 "reflect.h2"
+#line 1469 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Return statements
 //
 
-#line 1461 "reflect.h2"
+#line 1476 "reflect.h2"
     return_statement::return_statement(
 
         cpp2::impl::in<return_statement_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<return_statement_node>{ n_, s }
-#line 1466 "reflect.h2"
+#line 1481 "reflect.h2"
     {
 
     }
 
-#line 1470 "reflect.h2"
+#line 1485 "reflect.h2"
     [[nodiscard]] auto return_statement::has_expression() const& -> bool { return CPP2_UFCS(has_expression)((*cpp2::impl::assert_not_null(n))); }
 
-#line 1472 "reflect.h2"
+#line 1487 "reflect.h2"
     [[nodiscard]] auto return_statement::get_expression() const& -> expression { return { CPP2_UFCS(get_expression)((*cpp2::impl::assert_not_null(n))), (*this) };  }
 
     return_statement::return_statement(return_statement const& that)
@@ -5128,45 +5150,45 @@ selection_statement::selection_statement(selection_statement&& that) noexcept
 return_statement::return_statement(return_statement&& that) noexcept
                                      : reflection_base<return_statement_node>{ static_cast<reflection_base<return_statement_node>&&>(that) }{}
 
-#line 1476 "reflect.h2"
+#line 1491 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Iteration statements - for, do, while
 //
 
-#line 1483 "reflect.h2"
+#line 1498 "reflect.h2"
     iteration_statement::iteration_statement(
 
         cpp2::impl::in<iteration_statement_node*> n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<iteration_statement_node>{ n_, s }
-#line 1488 "reflect.h2"
+#line 1503 "reflect.h2"
     {
 
     }
 
-#line 1492 "reflect.h2"
+#line 1507 "reflect.h2"
     [[nodiscard]] auto iteration_statement::is_do() const& -> bool { return CPP2_UFCS(is_do)((*cpp2::impl::assert_not_null(n))); }
-#line 1493 "reflect.h2"
+#line 1508 "reflect.h2"
     [[nodiscard]] auto iteration_statement::is_while() const& -> bool { return CPP2_UFCS(is_while)((*cpp2::impl::assert_not_null(n)));  }
-#line 1494 "reflect.h2"
+#line 1509 "reflect.h2"
     [[nodiscard]] auto iteration_statement::is_for() const& -> bool { return CPP2_UFCS(is_for)((*cpp2::impl::assert_not_null(n))); }
-#line 1495 "reflect.h2"
+#line 1510 "reflect.h2"
     [[nodiscard]] auto iteration_statement::has_next() const& -> bool { return CPP2_UFCS(has_next)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 1497 "reflect.h2"
+#line 1512 "reflect.h2"
     [[nodiscard]] auto iteration_statement::get_label() const& -> std::string { return CPP2_UFCS(to_string)(CPP2_UFCS(get_label)((*cpp2::impl::assert_not_null(n)))); }
-#line 1498 "reflect.h2"
+#line 1513 "reflect.h2"
     [[nodiscard]] auto iteration_statement::get_next_expression() const& -> assignment_expression { return { CPP2_UFCS(get_next_expression)((*cpp2::impl::assert_not_null(n))), (*this) }; }
-#line 1499 "reflect.h2"
+#line 1514 "reflect.h2"
     [[nodiscard]] auto iteration_statement::get_do_while_condition() const& -> logical_or_expression { return { CPP2_UFCS(get_do_while_condition)((*cpp2::impl::assert_not_null(n))), (*this) };  }
-#line 1500 "reflect.h2"
+#line 1515 "reflect.h2"
     [[nodiscard]] auto iteration_statement::get_do_while_body() const& -> compound_statement { return { CPP2_UFCS(get_do_while_body)((*cpp2::impl::assert_not_null(n))), (*this) }; }
-#line 1501 "reflect.h2"
+#line 1516 "reflect.h2"
     [[nodiscard]] auto iteration_statement::get_for_range() const& -> expression { return { CPP2_UFCS(get_for_range)((*cpp2::impl::assert_not_null(n))), (*this) }; }
-#line 1502 "reflect.h2"
+#line 1517 "reflect.h2"
     [[nodiscard]] auto iteration_statement::get_for_parameter() const& -> parameter_declaration { return { CPP2_UFCS(get_for_parameter)((*cpp2::impl::assert_not_null(n))), (*this) }; }
-#line 1503 "reflect.h2"
+#line 1518 "reflect.h2"
     [[nodiscard]] auto iteration_statement::get_for_body() const& -> statement { return { CPP2_UFCS(get_for_body)((*cpp2::impl::assert_not_null(n))), (*this) }; }
 
     iteration_statement::iteration_statement(iteration_statement const& that)
@@ -5174,7 +5196,7 @@ return_statement::return_statement(return_statement&& that) noexcept
 iteration_statement::iteration_statement(iteration_statement&& that) noexcept
                                      : reflection_base<iteration_statement_node>{ static_cast<reflection_base<iteration_statement_node>&&>(that) }{}
 
-#line 1507 "reflect.h2"
+#line 1522 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  Metafunctions - these are hardwired for now until we get to the
@@ -5187,13 +5209,13 @@ iteration_statement::iteration_statement(iteration_statement&& that) noexcept
 //  Some common metafunction helpers (metafunctions are just functions,
 //  so they can be factored as usual)
 //
-#line 1519 "reflect.h2"
+#line 1534 "reflect.h2"
 auto add_virtual_destructor(meta::type_declaration& t) -> void
 {
     CPP2_UFCS(add_member)(t, "operator=: (virtual move this) = { }");
 }
 
-#line 1525 "reflect.h2"
+#line 1540 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //      "... an abstract base class defines an interface ..."
@@ -5208,7 +5230,7 @@ auto add_virtual_destructor(meta::type_declaration& t) -> void
 //  a public default constructor, a public virtual destructor, and
 //  protected copy/move operations
 //
-#line 1539 "reflect.h2"
+#line 1554 "reflect.h2"
 auto interface(meta::type_declaration& t) -> void
 {
     auto has_dtor {false}; 
@@ -5240,7 +5262,7 @@ auto interface(meta::type_declaration& t) -> void
     }
 }
 
-#line 1571 "reflect.h2"
+#line 1586 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //     "C.35: A base class destructor should be either public and
@@ -5257,7 +5279,7 @@ auto interface(meta::type_declaration& t) -> void
 //
 //  Unlike an interface, it can have nonpublic and nonvirtual functions.
 //
-#line 1587 "reflect.h2"
+#line 1602 "reflect.h2"
 auto polymorphic_base(meta::type_declaration& t) -> void
 {
     auto has_dtor {false}; 
@@ -5282,7 +5304,7 @@ auto polymorphic_base(meta::type_declaration& t) -> void
     }
 }
 
-#line 1612 "reflect.h2"
+#line 1627 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //     "... A totally ordered type ... requires operator<=> that
@@ -5303,7 +5325,7 @@ auto polymorphic_base(meta::type_declaration& t) -> void
 //-----------------------------------------------------------------------
 //
 
-#line 1632 "reflect.h2"
+#line 1647 "reflect.h2"
 auto ordered_impl(
     meta::type_declaration& t, 
     cpp2::impl::in<std::string_view> ordering// must be "strong_ordering" etc.
@@ -5333,7 +5355,7 @@ auto ordered_impl(
 //
 //  Note: the ordering that should be encouraged as default gets the nice name
 //
-#line 1661 "reflect.h2"
+#line 1676 "reflect.h2"
 auto ordered(meta::type_declaration& t) -> void
 {
     ordered_impl(t, "strong_ordering");
@@ -5342,7 +5364,7 @@ auto ordered(meta::type_declaration& t) -> void
 //-----------------------------------------------------------------------
 //  weakly_ordered - a weakly ordered type
 //
-#line 1669 "reflect.h2"
+#line 1684 "reflect.h2"
 auto weakly_ordered(meta::type_declaration& t) -> void
 {
     ordered_impl(t, "weak_ordering");
@@ -5351,13 +5373,13 @@ auto weakly_ordered(meta::type_declaration& t) -> void
 //-----------------------------------------------------------------------
 //  partially_ordered - a partially ordered type
 //
-#line 1677 "reflect.h2"
+#line 1692 "reflect.h2"
 auto partially_ordered(meta::type_declaration& t) -> void
 {
     ordered_impl(t, "partial_ordering");
 }
 
-#line 1683 "reflect.h2"
+#line 1698 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //     "A value is ... a regular type. It must have all public
@@ -5374,7 +5396,7 @@ auto partially_ordered(meta::type_declaration& t) -> void
 //
 //  A type with (copy and move) x (construction and assignment)
 //
-#line 1699 "reflect.h2"
+#line 1714 "reflect.h2"
 auto copyable(meta::type_declaration& t) -> void
 {
     //  If the user explicitly wrote any of the copy/move functions,
@@ -5402,12 +5424,12 @@ auto copyable(meta::type_declaration& t) -> void
     }}
 }
 
-#line 1727 "reflect.h2"
+#line 1742 "reflect.h2"
 //  copy_constructible
 //
 //  A type with (copy and move) construction
 //
-#line 1731 "reflect.h2"
+#line 1746 "reflect.h2"
 auto copy_constructible(meta::type_declaration& t) -> void
 {
     //  If the user explicitly wrote any of the copy/move constructors,
@@ -5433,14 +5455,14 @@ auto copy_constructible(meta::type_declaration& t) -> void
     }}
 }
 
-#line 1757 "reflect.h2"
+#line 1772 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  hashable
 //
 //  A memberwise hashable type
 //
-#line 1763 "reflect.h2"
+#line 1778 "reflect.h2"
 auto hashable(meta::type_declaration& t) -> void
 {
     CPP2_UFCS(require)(t, !(CPP2_UFCS(empty)(CPP2_UFCS(get_member_objects)(t))), 
@@ -5466,7 +5488,7 @@ auto hashable(meta::type_declaration& t) -> void
     CPP2_UFCS(add_member)(t, cpp2::move(hash) + "\n        return ret;\n    }");
 }
 
-#line 1789 "reflect.h2"
+#line 1804 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  basic_value
@@ -5474,7 +5496,7 @@ auto hashable(meta::type_declaration& t) -> void
 //  A regular type: copyable, plus has public default construction
 //  and no protected or virtual functions
 //
-#line 1796 "reflect.h2"
+#line 1811 "reflect.h2"
 auto basic_value(meta::type_declaration& t) -> void
 {
     CPP2_UFCS(copyable)(t);
@@ -5503,28 +5525,28 @@ auto basic_value(meta::type_declaration& t) -> void
 //
 //  Note: the ordering that should be encouraged as default gets the nice name
 //
-#line 1824 "reflect.h2"
+#line 1839 "reflect.h2"
 auto value(meta::type_declaration& t) -> void
 {
     CPP2_UFCS(ordered)(t);
     CPP2_UFCS(basic_value)(t);
 }
 
-#line 1830 "reflect.h2"
+#line 1845 "reflect.h2"
 auto weakly_ordered_value(meta::type_declaration& t) -> void
 {
     CPP2_UFCS(weakly_ordered)(t);
     CPP2_UFCS(basic_value)(t);
 }
 
-#line 1836 "reflect.h2"
+#line 1851 "reflect.h2"
 auto partially_ordered_value(meta::type_declaration& t) -> void
 {
     CPP2_UFCS(partially_ordered)(t);
     CPP2_UFCS(basic_value)(t);
 }
 
-#line 1843 "reflect.h2"
+#line 1858 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //     C.20: If you can avoid defining default operations, do
@@ -5547,7 +5569,7 @@ auto partially_ordered_value(meta::type_declaration& t) -> void
 //
 //  a type without declared copy/move/destructor functions
 //
-#line 1865 "reflect.h2"
+#line 1880 "reflect.h2"
 auto cpp1_rule_of_zero(meta::type_declaration& t) -> void
 {
     for ( auto& mf : CPP2_UFCS(get_member_functions)(t) ) 
@@ -5590,7 +5612,7 @@ auto cpp1_rule_of_zero(meta::type_declaration& t) -> void
 //  parameters instead of concrete forwarding parameters (mainly used
 //  for cppfront internal use, so cppfront builds under GCC 10)
 //
-#line 1907 "reflect.h2"
+#line 1922 "reflect.h2"
 auto cpp2_struct(meta::type_declaration& t) -> void
 {
     std::string ctor_params {}; 
@@ -5647,7 +5669,7 @@ value_member_info::value_member_info(auto const& name_, auto const& type_, auto
                                                                , type{ type_ }
                                                                , value{ value_ }{}
 
-#line 1959 "reflect.h2"
+#line 1974 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //     "C enumerations constitute a curiously half-baked concept. ...
@@ -5666,7 +5688,7 @@ value_member_info::value_member_info(auto const& name_, auto const& type_, auto
 //  a type together with named constants that are its possible values
 //
 
-#line 1982 "reflect.h2"
+#line 1997 "reflect.h2"
 auto basic_enum(
     meta::type_declaration& t, 
     auto const& nextval, 
@@ -5691,7 +5713,7 @@ auto basic_enum(
 {
 std::string value{"-1"};
 
-#line 2005 "reflect.h2"
+#line 2020 "reflect.h2"
     for ( 
           auto const& m : CPP2_UFCS(get_members)(t) ) 
     if (  CPP2_UFCS(is_member_object)(m)) 
@@ -5733,7 +5755,7 @@ std::string value{"-1"};
     }
 }
 
-#line 2045 "reflect.h2"
+#line 2060 "reflect.h2"
     if ((CPP2_UFCS(empty)(enumerators))) {
         CPP2_UFCS(error)(t, "an enumeration must contain at least one enumerator value");
         return ; 
@@ -5784,7 +5806,7 @@ std::string value{"-1"};
         }
     }
 
-#line 2096 "reflect.h2"
+#line 2111 "reflect.h2"
     //  2. Replace: Erase the contents and replace with modified contents
     //
     //  Note that most values and functions are declared as '==' compile-time values, i.e. Cpp1 'constexpr'
@@ -5834,7 +5856,7 @@ std::string to_string_impl{"    to_string_impl: (this, prefix: std::string_view"
     //  Provide 'to_string' and 'to_code' functions to print enumerator
     //  name(s) as human-readable strings or as code expressions
 
-#line 2143 "reflect.h2"
+#line 2158 "reflect.h2"
     {
         if (bitwise) {
             to_string_impl += ", separator: std::string_view ) -> std::string = { \n"
@@ -5875,7 +5897,7 @@ std::string to_string_impl{"    to_string_impl: (this, prefix: std::string_view"
     }
 }
 
-#line 2182 "reflect.h2"
+#line 2197 "reflect.h2"
     if (bitwise) {
         CPP2_UFCS(add_member)(t, "    to_string: (this) -> std::string = to_string_impl( \"\", \", \" );");
         CPP2_UFCS(add_member)(t, "    to_code  : (this) -> std::string = to_string_impl( \"" + cpp2::to_string(CPP2_UFCS(name)(t)) + "::\", \" | \" );");
@@ -5889,7 +5911,7 @@ std::string from_string{"    from_string: (s: std::string_view) -> " + cpp2::to_
 
     //  Provide a 'from_string' function to parse strings into enumerators    
 
-#line 2193 "reflect.h2"
+#line 2208 "reflect.h2"
     {
         std::string_view prefix {""}; 
         std::string_view combine_op {"return"}; 
@@ -5911,7 +5933,7 @@ std::string from_string{"    from_string: (s: std::string_view) -> " + cpp2::to_
 {
 std::string_view else_{""};
 
-#line 2213 "reflect.h2"
+#line 2228 "reflect.h2"
         for ( 
               auto const& e : cpp2::move(enumerators) ) {
             from_string += "            " + cpp2::to_string(else_) + "if \"" + cpp2::to_string(e.name) + "\" == x { " + cpp2::to_string(combine_op) + " " + cpp2::to_string(CPP2_UFCS(name)(t)) + "::" + cpp2::to_string(e.name) + "; }\n";
@@ -5919,7 +5941,7 @@ std::string_view else_{""};
         }
 }
 
-#line 2219 "reflect.h2"
+#line 2234 "reflect.h2"
         if (bitwise) {
             from_string += "            else { break outer; }\n"
                            "        }\n"
@@ -5935,11 +5957,11 @@ std::string_view else_{""};
     }
 }
 
-#line 2233 "reflect.h2"
+#line 2248 "reflect.h2"
     CPP2_UFCS(add_member)(t, "    from_code: (s: std::string_view) -> " + cpp2::to_string(CPP2_UFCS(name)(t)) + " = { str: std::string = s; return from_string( cpp2::string_util::replace_all(str, \"" + cpp2::to_string(CPP2_UFCS(name)(t)) + "::\", \"\" ) ); }");
 }
 
-#line 2237 "reflect.h2"
+#line 2252 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //    "An enum[...] is a totally ordered value type that stores a
@@ -5949,7 +5971,7 @@ std::string_view else_{""};
 //
 //          -- P0707R4, section 3
 //
-#line 2246 "reflect.h2"
+#line 2261 "reflect.h2"
 auto cpp2_enum(meta::type_declaration& t) -> void
 {
     //  Let basic_enum do its thing, with an incrementing value generator
@@ -5966,7 +5988,7 @@ auto cpp2_enum(meta::type_declaration& t) -> void
     );
 }
 
-#line 2263 "reflect.h2"
+#line 2278 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //     "flag_enum expresses an enumeration that stores values
@@ -5977,7 +5999,7 @@ auto cpp2_enum(meta::type_declaration& t) -> void
 //
 //          -- P0707R4, section 3
 //
-#line 2273 "reflect.h2"
+#line 2288 "reflect.h2"
 auto flag_enum(meta::type_declaration& t) -> void
 {
     //  Let basic_enum do its thing, with a power-of-two value generator
@@ -5999,7 +6021,7 @@ auto flag_enum(meta::type_declaration& t) -> void
     );
 }
 
-#line 2295 "reflect.h2"
+#line 2310 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //     "As with void*, programmers should know that unions [...] are
@@ -6024,7 +6046,7 @@ auto flag_enum(meta::type_declaration& t) -> void
 //  a type that contains exactly one of a fixed set of values at a time
 //
 
-#line 2319 "reflect.h2"
+#line 2334 "reflect.h2"
 auto cpp2_union(meta::type_declaration& t) -> void
 {
     std::vector<value_member_info> alternatives {}; 
@@ -6033,7 +6055,7 @@ auto value{0};
 
     //  1. Gather: All the user-written members, and find/compute the max size
 
-#line 2326 "reflect.h2"
+#line 2341 "reflect.h2"
     for ( 
 
            auto const& m : CPP2_UFCS(get_members)(t) )  { do 
@@ -6063,7 +6085,7 @@ auto value{0};
     } while (false); ++value; }
 }
 
-#line 2354 "reflect.h2"
+#line 2369 "reflect.h2"
     std::string discriminator_type {}; 
     if (cpp2::impl::cmp_less(CPP2_UFCS(ssize)(alternatives),std::numeric_limits<cpp2::i8>::max())) {
         discriminator_type = "i8";
@@ -6078,7 +6100,7 @@ auto value{0};
         discriminator_type = "i64";
     }}}
 
-#line 2369 "reflect.h2"
+#line 2384 "reflect.h2"
     //  2. Replace: Erase the contents and replace with modified contents
 
     CPP2_UFCS(remove_marked_members)(t);
@@ -6087,7 +6109,7 @@ std::string storage{"    _storage: cpp2::aligned_storage<cpp2::max( "};
 
     //  Provide storage
 
-#line 2375 "reflect.h2"
+#line 2390 "reflect.h2"
     {
         for ( 
               auto const& e : alternatives ) {
@@ -6107,7 +6129,7 @@ std::string storage{"    _storage: cpp2::aligned_storage<cpp2::max( "};
 }
 
     //  Provide discriminator
-#line 2393 "reflect.h2"
+#line 2408 "reflect.h2"
     CPP2_UFCS(add_member)(t, "    _discriminator: " + cpp2::to_string(cpp2::move(discriminator_type)) + " = -1;\n");
 
     //  Add the alternatives: is_alternative, get_alternative, and set_alternative
@@ -6143,7 +6165,7 @@ std::string destroy{"    private _destroy: (inout this) = {\n"};
 
     //  Add destroy
 
-#line 2426 "reflect.h2"
+#line 2441 "reflect.h2"
     {
         for ( 
               auto const& a : alternatives ) {
@@ -6157,7 +6179,7 @@ std::string destroy{"    private _destroy: (inout this) = {\n"};
 }
 
     //  Add the destructor
-#line 2438 "reflect.h2"
+#line 2453 "reflect.h2"
     CPP2_UFCS(add_member)(t, "    operator=: (move this) = { _destroy(); _ = this; }");
 
     //  Add default constructor
@@ -6167,7 +6189,7 @@ std::string value_set{""};
 
     //  Add copy/move construction and assignment
 
-#line 2445 "reflect.h2"
+#line 2460 "reflect.h2"
     {
         for ( 
               auto const& a : cpp2::move(alternatives) ) {
@@ -6187,27 +6209,27 @@ std::string value_set{""};
                     );
     }
 }
-#line 2463 "reflect.h2"
+#line 2478 "reflect.h2"
 }
 
-#line 2466 "reflect.h2"
+#line 2481 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  print - output a pretty-printed visualization of t
 //
-#line 2470 "reflect.h2"
+#line 2485 "reflect.h2"
 auto print(cpp2::impl::in<meta::type_declaration> t) -> void
 {
-    std::cout << CPP2_UFCS(print)(t) << "\n";
+    *cpp2::impl::assert_not_null(compile_time_out) << CPP2_UFCS(print)(t) << "\n";
 }
 
-#line 2476 "reflect.h2"
+#line 2491 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  noisy - make each function print its name and signature,
 //          so the programmer can see what's called
 //
-#line 2481 "reflect.h2"
+#line 2496 "reflect.h2"
 auto noisy(cpp2::impl::in<meta::type_declaration> t) -> void
 {
     for ( 
@@ -6224,7 +6246,7 @@ auto noisy(cpp2::impl::in<meta::type_declaration> t) -> void
     }
 }
 
-#line 2498 "reflect.h2"
+#line 2513 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  python - expose the type using pybind11
@@ -6232,14 +6254,14 @@ auto noisy(cpp2::impl::in<meta::type_declaration> t) -> void
 //  *** Basic proof of concept only, limited and not well tested
 //      Hardcoded for pybind11 and g++10 and my local cppfront include path
 //
-#line 2505 "reflect.h2"
+#line 2520 "reflect.h2"
 [[nodiscard]] auto python_param_names_and_types(cpp2::impl::in<meta::function_declaration> mf) -> python_param_names_and_types_ret
 
-#line 2511 "reflect.h2"
+#line 2526 "reflect.h2"
 {
     std::string names {};
     std::string types {};
-#line 2512 "reflect.h2"
+#line 2527 "reflect.h2"
     for ( 
          auto const& param : CPP2_UFCS(get_parameters)(mf) ) 
     if ( CPP2_UFCS(name)(CPP2_UFCS(get_declaration)(param)) != "this") 
@@ -6255,7 +6277,7 @@ auto noisy(cpp2::impl::in<meta::type_declaration> t) -> void
     static_cast<void>(names);
 return  { std::move(names), std::move(types) }; }
 
-#line 2527 "reflect.h2"
+#line 2542 "reflect.h2"
 auto python(meta::type_declaration& t) -> void
 {
     std::string bind {}; 
@@ -6292,14 +6314,14 @@ auto python(meta::type_declaration& t) -> void
     CPP2_UFCS(add_extra_build_step)(t, cpp2::move(build));
 }
 
-#line 2564 "reflect.h2"
+#line 2579 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  javascript - expose the type using emscripten
 // 
 //  *** Basic proof of concept only, limited and not well tested
 //
-#line 2570 "reflect.h2"
+#line 2585 "reflect.h2"
 auto javascript(meta::type_declaration& t) -> void
 {
     std::string bind {}; 
@@ -6336,26 +6358,26 @@ auto javascript(meta::type_declaration& t) -> void
     CPP2_UFCS(disable_ref_qualifier_generation)(t);
 }
 
-#line 2607 "reflect.h2"
+#line 2622 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  For reflection test cases
 //
-#line 2611 "reflect.h2"
+#line 2626 "reflect.h2"
 auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32> indent) -> void
 {
-    std::cout 
+    *cpp2::impl::assert_not_null(compile_time_out) 
         << pre(indent) 
         << s 
         << "\n";
 }
 
-#line 2621 "reflect.h2"
+#line 2636 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::declaration> decl) -> void{
         traverse(decl);
     }
 
-#line 2625 "reflect.h2"
+#line 2640 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::declaration> decl) -> void
     {
         if (CPP2_UFCS(is_function)(decl)) {
@@ -6375,12 +6397,12 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         // ...
     }
 
-#line 2645 "reflect.h2"
+#line 2660 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::function_declaration> f) -> void{
         traverse(f);
     }
 
-#line 2649 "reflect.h2"
+#line 2664 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::function_declaration> f) -> void
     {
         auto parameters {CPP2_UFCS(get_parameters)(f)}; 
@@ -6401,12 +6423,12 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2670 "reflect.h2"
+#line 2685 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::object_declaration> o) -> void{
         traverse(o);
     }
 
-#line 2674 "reflect.h2"
+#line 2689 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::object_declaration> o) -> void
     {
         if (CPP2_UFCS(has_initializer)(o)) {
@@ -6414,12 +6436,12 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2682 "reflect.h2"
+#line 2697 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::type_declaration> t) -> void{
         traverse(t);
     }
 
-#line 2686 "reflect.h2"
+#line 2701 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::type_declaration> t) -> void
     {
         for ( auto const& m : CPP2_UFCS(get_members)(t) ) {
@@ -6427,23 +6449,23 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2694 "reflect.h2"
+#line 2709 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::parameter_declaration> t) -> void{
         traverse(t);
     }
 
-#line 2698 "reflect.h2"
+#line 2713 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::parameter_declaration> t) -> void
     {
         pre_traverse(CPP2_UFCS(get_declaration)(t));
     }
 
-#line 2703 "reflect.h2"
+#line 2718 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::statement> stmt) -> void{
         traverse(stmt);
     }
 
-#line 2707 "reflect.h2"
+#line 2722 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::statement> stmt) -> void
     {
         if (CPP2_UFCS(is_expression_statement)(stmt)) {
@@ -6478,12 +6500,12 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         //  jump
     }
 
-#line 2742 "reflect.h2"
+#line 2757 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::compound_statement> stmt) -> void{
         traverse(stmt);
     }
 
-#line 2746 "reflect.h2"
+#line 2761 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::compound_statement> stmt) -> void
     {
         auto stmts {CPP2_UFCS(get_statements)(stmt)}; 
@@ -6493,12 +6515,12 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2756 "reflect.h2"
+#line 2771 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::return_statement> stmt) -> void{
         traverse(stmt);
     }
 
-#line 2760 "reflect.h2"
+#line 2775 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::return_statement> stmt) -> void
     {
         if (CPP2_UFCS(has_expression)(stmt)) {
@@ -6506,12 +6528,12 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2768 "reflect.h2"
+#line 2783 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::iteration_statement> stmt) -> void{
         traverse(stmt);
     }
 
-#line 2772 "reflect.h2"
+#line 2787 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::iteration_statement> stmt) -> void
     {
         if (CPP2_UFCS(is_do)(stmt) || CPP2_UFCS(is_while)(stmt)) {
@@ -6530,12 +6552,12 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2791 "reflect.h2"
+#line 2806 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::selection_statement> stmt) -> void{
         traverse(stmt);
     }
 
-#line 2795 "reflect.h2"
+#line 2810 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::selection_statement> stmt) -> void
     {
         pre_traverse(CPP2_UFCS(get_expression)(stmt));
@@ -6546,14 +6568,14 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2806 "reflect.h2"
+#line 2821 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::expression> expr) -> void
     {
         // Nothing to select here.
         traverse(expr);
     }
 
-#line 2812 "reflect.h2"
+#line 2827 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::expression> expr) -> void
     {
         //  An expression has other shortcuts to query deeper properties,
@@ -6567,7 +6589,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         pre_traverse(CPP2_UFCS(as_assignment_expression)(expr));
     }
 
-#line 2826 "reflect.h2"
+#line 2841 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::assignment_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6585,7 +6607,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2843 "reflect.h2"
+#line 2858 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::assignment_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6597,7 +6619,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2854 "reflect.h2"
+#line 2869 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::logical_or_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6615,7 +6637,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2871 "reflect.h2"
+#line 2886 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::logical_or_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6627,7 +6649,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2883 "reflect.h2"
+#line 2898 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::logical_and_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6645,7 +6667,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2900 "reflect.h2"
+#line 2915 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::logical_and_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6657,7 +6679,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2911 "reflect.h2"
+#line 2926 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::bit_or_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6675,7 +6697,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2928 "reflect.h2"
+#line 2943 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::bit_or_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6687,7 +6709,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2939 "reflect.h2"
+#line 2954 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::bit_xor_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6705,7 +6727,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2956 "reflect.h2"
+#line 2971 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::bit_xor_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6717,7 +6739,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2968 "reflect.h2"
+#line 2983 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::bit_and_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6735,7 +6757,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2985 "reflect.h2"
+#line 3000 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::bit_and_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6747,7 +6769,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 2997 "reflect.h2"
+#line 3012 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::equality_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6765,7 +6787,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3014 "reflect.h2"
+#line 3029 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::equality_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6777,7 +6799,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3025 "reflect.h2"
+#line 3040 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::relational_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6795,7 +6817,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3042 "reflect.h2"
+#line 3057 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::relational_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6807,7 +6829,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3053 "reflect.h2"
+#line 3068 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::compare_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6825,7 +6847,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3070 "reflect.h2"
+#line 3085 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::compare_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6837,7 +6859,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3081 "reflect.h2"
+#line 3096 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::shift_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6855,7 +6877,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3098 "reflect.h2"
+#line 3113 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::shift_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6867,7 +6889,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3109 "reflect.h2"
+#line 3124 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::additive_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6885,7 +6907,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3126 "reflect.h2"
+#line 3141 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::additive_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6897,7 +6919,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3138 "reflect.h2"
+#line 3153 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::multiplicative_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6915,7 +6937,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3155 "reflect.h2"
+#line 3170 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::multiplicative_expression> binexpr) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -6927,7 +6949,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3166 "reflect.h2"
+#line 3181 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::is_as_expression> isas) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(isas)}; 
@@ -6944,7 +6966,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3182 "reflect.h2"
+#line 3197 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::is_as_expression> isas) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(isas)}; 
@@ -6956,7 +6978,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3193 "reflect.h2"
+#line 3208 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::expression_list> exprs) -> void
     {
         for ( auto const& expr : CPP2_UFCS(get_expressions)(exprs) ) {
@@ -6964,7 +6986,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3200 "reflect.h2"
+#line 3215 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::prefix_expression> prefix) -> void
     {
         auto ops {CPP2_UFCS(get_ops)(prefix)}; 
@@ -6981,13 +7003,13 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3216 "reflect.h2"
+#line 3231 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::prefix_expression> prefix) -> void
     {
         pre_traverse(CPP2_UFCS(get_postfix_expression)(prefix));
     }
 
-#line 3221 "reflect.h2"
+#line 3236 "reflect.h2"
     auto simple_traverser::pre_traverse(cpp2::impl::in<meta::postfix_expression> postfix) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(postfix)}; 
@@ -7004,7 +7026,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3237 "reflect.h2"
+#line 3252 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::postfix_expression> postfix) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(postfix)}; 
@@ -7024,13 +7046,13 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3256 "reflect.h2"
+#line 3271 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::unqualified_id> uid) -> void
     {
         static_cast<void>(uid);
     }
 
-#line 3262 "reflect.h2"
+#line 3277 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::qualified_id> qid) -> void
     {
         for ( 
@@ -7040,7 +7062,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }
     }
 
-#line 3272 "reflect.h2"
+#line 3287 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::type_id> tid) -> void
     {
         if (CPP2_UFCS(is_postfix_expression)(tid)) {
@@ -7057,7 +7079,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }}}
     }
 
-#line 3289 "reflect.h2"
+#line 3304 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::primary_expression> primary) -> void
     {
         if (CPP2_UFCS(is_identifier)(primary)) {
@@ -7077,7 +7099,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }}}}
     }
 
-#line 3309 "reflect.h2"
+#line 3324 "reflect.h2"
     auto simple_traverser::traverse(cpp2::impl::in<meta::id_expression> idexpr) -> void
     {
         if (CPP2_UFCS(is_identifier)(idexpr)) {
@@ -7094,7 +7116,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
         }}}
     }
 
-#line 3327 "reflect.h2"
+#line 3342 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  sample_traverser serves two purposes:
@@ -7105,7 +7127,7 @@ auto sample_print(cpp2::impl::in<std::string_view> s, cpp2::impl::in<cpp2::i32>
 //        for reflecting on function bodies (statements, expressions)
 //
 
-#line 3337 "reflect.h2"
+#line 3352 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::declaration> decl, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     sample_print("Declaration: " + cpp2::to_string(CPP2_UFCS(name)(decl)) + "", indent);
@@ -7127,7 +7149,7 @@ auto sample_traverser(cpp2::impl::in<meta::declaration> decl, cpp2::impl::in<cpp
     // ...
 }
 
-#line 3359 "reflect.h2"
+#line 3374 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::function_declaration> f, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     sample_print("Function: " + cpp2::to_string(CPP2_UFCS(name)(f)) + "", indent + 1);
@@ -7157,7 +7179,7 @@ auto sample_traverser(cpp2::impl::in<meta::function_declaration> f, cpp2::impl::
     }
 }
 
-#line 3389 "reflect.h2"
+#line 3404 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::object_declaration> o, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     sample_print("Object: name " + cpp2::to_string(CPP2_UFCS(name)(o)) + ", type " + cpp2::to_string(CPP2_UFCS(type)(o)) + "", indent);
@@ -7167,7 +7189,7 @@ auto sample_traverser(cpp2::impl::in<meta::object_declaration> o, cpp2::impl::in
     }
 }
 
-#line 3399 "reflect.h2"
+#line 3414 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::type_declaration> t, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     sample_print("Type: " + cpp2::to_string(CPP2_UFCS(name)(t)) + "", indent);
@@ -7188,7 +7210,7 @@ auto sample_traverser(cpp2::impl::in<meta::type_declaration> t, cpp2::impl::in<c
     }
 }
 
-#line 3420 "reflect.h2"
+#line 3435 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::parameter_declaration> t, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     sample_print("parameter:", indent);
@@ -7207,7 +7229,7 @@ auto sample_traverser(cpp2::impl::in<meta::parameter_declaration> t, cpp2::impl:
     sample_traverser(CPP2_UFCS(get_declaration)(t), indent + 2);
 }
 
-#line 3439 "reflect.h2"
+#line 3454 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::statement> stmt, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto params {CPP2_UFCS(get_parameters)(stmt)}; 
@@ -7262,7 +7284,7 @@ auto sample_traverser(cpp2::impl::in<meta::statement> stmt, cpp2::impl::in<cpp2:
     //  jump
 }
 
-#line 3494 "reflect.h2"
+#line 3509 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::compound_statement> stmt, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto stmts {CPP2_UFCS(get_statements)(stmt)}; 
@@ -7279,7 +7301,7 @@ auto sample_traverser(cpp2::impl::in<meta::compound_statement> stmt, cpp2::impl:
     }
 }
 
-#line 3511 "reflect.h2"
+#line 3526 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::return_statement> stmt, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     sample_print("return statement", indent);
@@ -7289,7 +7311,7 @@ auto sample_traverser(cpp2::impl::in<meta::return_statement> stmt, cpp2::impl::i
     }
 }
 
-#line 3521 "reflect.h2"
+#line 3536 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::iteration_statement> stmt, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     if (CPP2_UFCS(is_do)(stmt) || CPP2_UFCS(is_while)(stmt)) {
@@ -7321,7 +7343,7 @@ auto sample_traverser(cpp2::impl::in<meta::iteration_statement> stmt, cpp2::impl
     }
 }
 
-#line 3553 "reflect.h2"
+#line 3568 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::expression> expr, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     //  An expression has other shortcuts to query deeper properties,
@@ -7335,7 +7357,7 @@ auto sample_traverser(cpp2::impl::in<meta::expression> expr, cpp2::impl::in<cpp2
     }
 }
 
-#line 3567 "reflect.h2"
+#line 3582 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::assignment_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -7353,7 +7375,7 @@ auto sample_traverser(cpp2::impl::in<meta::assignment_expression> binexpr, cpp2:
 {
 auto first{true};
 
-#line 3583 "reflect.h2"
+#line 3598 "reflect.h2"
         for ( 
              auto const& term : cpp2::move(terms) ) 
         {
@@ -7365,11 +7387,11 @@ auto first{true};
             sample_traverser(CPP2_UFCS(get_term)(term), indent + 2);
         }
 }
-#line 3593 "reflect.h2"
+#line 3608 "reflect.h2"
     }
 }
 
-#line 3597 "reflect.h2"
+#line 3612 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::logical_or_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -7387,7 +7409,7 @@ auto sample_traverser(cpp2::impl::in<meta::logical_or_expression> binexpr, cpp2:
 {
 auto first{true};
 
-#line 3613 "reflect.h2"
+#line 3628 "reflect.h2"
         for ( 
              auto const& term : cpp2::move(terms) ) 
         {
@@ -7399,11 +7421,11 @@ auto first{true};
             sample_traverser(CPP2_UFCS(get_term)(term), indent + 2);
         }
 }
-#line 3623 "reflect.h2"
+#line 3638 "reflect.h2"
     }
 }
 
-#line 3627 "reflect.h2"
+#line 3642 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::logical_and_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -7421,7 +7443,7 @@ auto sample_traverser(cpp2::impl::in<meta::logical_and_expression> binexpr, cpp2
 {
 auto first{true};
 
-#line 3643 "reflect.h2"
+#line 3658 "reflect.h2"
         for ( 
              auto const& term : cpp2::move(terms) ) 
         {
@@ -7433,11 +7455,11 @@ auto first{true};
             sample_traverser(CPP2_UFCS(get_term)(term), indent + 2);
         }
 }
-#line 3653 "reflect.h2"
+#line 3668 "reflect.h2"
     }
 }
 
-#line 3657 "reflect.h2"
+#line 3672 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::bit_or_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -7455,7 +7477,7 @@ auto sample_traverser(cpp2::impl::in<meta::bit_or_expression> binexpr, cpp2::imp
 {
 auto first{true};
 
-#line 3673 "reflect.h2"
+#line 3688 "reflect.h2"
         for ( 
              auto const& term : cpp2::move(terms) ) 
         {
@@ -7467,11 +7489,11 @@ auto first{true};
             sample_traverser(CPP2_UFCS(get_term)(term), indent + 2);
         }
 }
-#line 3683 "reflect.h2"
+#line 3698 "reflect.h2"
     }
 }
 
-#line 3687 "reflect.h2"
+#line 3702 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::bit_xor_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -7489,7 +7511,7 @@ auto sample_traverser(cpp2::impl::in<meta::bit_xor_expression> binexpr, cpp2::im
 {
 auto first{true};
 
-#line 3703 "reflect.h2"
+#line 3718 "reflect.h2"
         for ( 
              auto const& term : cpp2::move(terms) ) 
         {
@@ -7501,11 +7523,11 @@ auto first{true};
             sample_traverser(CPP2_UFCS(get_term)(term), indent + 2);
         }
 }
-#line 3713 "reflect.h2"
+#line 3728 "reflect.h2"
     }
 }
 
-#line 3717 "reflect.h2"
+#line 3732 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::bit_and_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -7523,7 +7545,7 @@ auto sample_traverser(cpp2::impl::in<meta::bit_and_expression> binexpr, cpp2::im
 {
 auto first{true};
 
-#line 3733 "reflect.h2"
+#line 3748 "reflect.h2"
         for ( 
              auto const& term : cpp2::move(terms) ) 
         {
@@ -7535,11 +7557,11 @@ auto first{true};
             sample_traverser(CPP2_UFCS(get_term)(term), indent + 2);
         }
 }
-#line 3743 "reflect.h2"
+#line 3758 "reflect.h2"
     }
 }
 
-#line 3747 "reflect.h2"
+#line 3762 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::equality_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -7557,7 +7579,7 @@ auto sample_traverser(cpp2::impl::in<meta::equality_expression> binexpr, cpp2::i
 {
 auto first{true};
 
-#line 3763 "reflect.h2"
+#line 3778 "reflect.h2"
         for ( 
              auto const& term : cpp2::move(terms) ) 
         {
@@ -7569,11 +7591,11 @@ auto first{true};
             sample_traverser(CPP2_UFCS(get_term)(term), indent + 2);
         }
 }
-#line 3773 "reflect.h2"
+#line 3788 "reflect.h2"
     }
 }
 
-#line 3777 "reflect.h2"
+#line 3792 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::relational_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -7591,7 +7613,7 @@ auto sample_traverser(cpp2::impl::in<meta::relational_expression> binexpr, cpp2:
 {
 auto first{true};
 
-#line 3793 "reflect.h2"
+#line 3808 "reflect.h2"
         for ( 
              auto const& term : cpp2::move(terms) ) 
         {
@@ -7603,11 +7625,11 @@ auto first{true};
             sample_traverser(CPP2_UFCS(get_term)(term), indent + 2);
         }
 }
-#line 3803 "reflect.h2"
+#line 3818 "reflect.h2"
     }
 }
 
-#line 3807 "reflect.h2"
+#line 3822 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::compare_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -7625,7 +7647,7 @@ auto sample_traverser(cpp2::impl::in<meta::compare_expression> binexpr, cpp2::im
 {
 auto first{true};
 
-#line 3823 "reflect.h2"
+#line 3838 "reflect.h2"
         for ( 
              auto const& term : cpp2::move(terms) ) 
         {
@@ -7637,11 +7659,11 @@ auto first{true};
             sample_traverser(CPP2_UFCS(get_term)(term), indent + 2);
         }
 }
-#line 3833 "reflect.h2"
+#line 3848 "reflect.h2"
     }
 }
 
-#line 3837 "reflect.h2"
+#line 3852 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::shift_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -7659,7 +7681,7 @@ auto sample_traverser(cpp2::impl::in<meta::shift_expression> binexpr, cpp2::impl
 {
 auto first{true};
 
-#line 3853 "reflect.h2"
+#line 3868 "reflect.h2"
         for ( 
              auto const& term : cpp2::move(terms) ) 
         {
@@ -7671,11 +7693,11 @@ auto first{true};
             sample_traverser(CPP2_UFCS(get_term)(term), indent + 2);
         }
 }
-#line 3863 "reflect.h2"
+#line 3878 "reflect.h2"
     }
 }
 
-#line 3867 "reflect.h2"
+#line 3882 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::additive_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -7693,7 +7715,7 @@ auto sample_traverser(cpp2::impl::in<meta::additive_expression> binexpr, cpp2::i
 {
 auto first{true};
 
-#line 3883 "reflect.h2"
+#line 3898 "reflect.h2"
         for ( 
              auto const& term : cpp2::move(terms) ) 
         {
@@ -7705,11 +7727,11 @@ auto first{true};
             sample_traverser(CPP2_UFCS(get_term)(term), indent + 2);
         }
 }
-#line 3893 "reflect.h2"
+#line 3908 "reflect.h2"
     }
 }
 
-#line 3897 "reflect.h2"
+#line 3912 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::multiplicative_expression> binexpr, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
@@ -7727,7 +7749,7 @@ auto sample_traverser(cpp2::impl::in<meta::multiplicative_expression> binexpr, c
 {
 auto first{true};
 
-#line 3913 "reflect.h2"
+#line 3928 "reflect.h2"
         for ( 
              auto const& term : cpp2::move(terms) ) 
         {
@@ -7739,11 +7761,11 @@ auto first{true};
             sample_traverser(CPP2_UFCS(get_term)(term), indent + 2);
         }
 }
-#line 3923 "reflect.h2"
+#line 3938 "reflect.h2"
     }
 }
 
-#line 3927 "reflect.h2"
+#line 3942 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::is_as_expression> isas, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto terms {CPP2_UFCS(get_terms)(isas)}; 
@@ -7769,7 +7791,7 @@ auto sample_traverser(cpp2::impl::in<meta::is_as_expression> isas, cpp2::impl::i
     }
 }
 
-#line 3953 "reflect.h2"
+#line 3968 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::expression_list> exprs, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     if (CPP2_UFCS(is_empty)(exprs)) {
@@ -7784,7 +7806,7 @@ auto sample_traverser(cpp2::impl::in<meta::expression_list> exprs, cpp2::impl::i
     }
 }
 
-#line 3968 "reflect.h2"
+#line 3983 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::prefix_expression> prefix, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto ops {CPP2_UFCS(get_ops)(prefix)}; 
@@ -7808,7 +7830,7 @@ auto sample_traverser(cpp2::impl::in<meta::prefix_expression> prefix, cpp2::impl
     }
 }
 
-#line 3992 "reflect.h2"
+#line 4007 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::postfix_expression> postfix, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     auto terms {CPP2_UFCS(get_terms)(postfix)}; 
@@ -7841,7 +7863,7 @@ auto sample_traverser(cpp2::impl::in<meta::postfix_expression> postfix, cpp2::im
     }
 }
 
-#line 4025 "reflect.h2"
+#line 4040 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::unqualified_id> uid, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     if (CPP2_UFCS(is_identifier)(uid)) {
@@ -7852,13 +7874,13 @@ auto sample_traverser(cpp2::impl::in<meta::unqualified_id> uid, cpp2::impl::in<c
     }
 }
 
-#line 4036 "reflect.h2"
+#line 4051 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::qualified_id> qid, cpp2::impl::in<cpp2::i32> indent) -> void
 {
 {
 auto first{true};
 
-#line 4039 "reflect.h2"
+#line 4054 "reflect.h2"
     for ( 
          auto const& term : CPP2_UFCS(get_terms)(qid) ) 
     {
@@ -7870,10 +7892,10 @@ auto first{true};
         sample_traverser(CPP2_UFCS(get_unqualified)(term), indent + 2);
     }
 }
-#line 4049 "reflect.h2"
+#line 4064 "reflect.h2"
 }
 
-#line 4052 "reflect.h2"
+#line 4067 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::type_id> tid, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     if (CPP2_UFCS(is_postfix_expression)(tid)) {
@@ -7890,7 +7912,7 @@ auto sample_traverser(cpp2::impl::in<meta::type_id> tid, cpp2::impl::in<cpp2::i3
     }}}
 }
 
-#line 4069 "reflect.h2"
+#line 4084 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::primary_expression> primary, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     if (CPP2_UFCS(is_identifier)(primary)) {
@@ -7910,7 +7932,7 @@ auto sample_traverser(cpp2::impl::in<meta::primary_expression> primary, cpp2::im
     }}}}
 }
 
-#line 4089 "reflect.h2"
+#line 4104 "reflect.h2"
 auto sample_traverser(cpp2::impl::in<meta::id_expression> idexpr, cpp2::impl::in<cpp2::i32> indent) -> void
 {
     if (CPP2_UFCS(is_identifier)(idexpr)) {
@@ -7927,13 +7949,13 @@ auto sample_traverser(cpp2::impl::in<meta::id_expression> idexpr, cpp2::impl::in
     }}}
 }
 
-#line 4106 "reflect.h2"
+#line 4121 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  autodiff
 //
 
-#line 4123 "reflect.h2"
+#line 4138 "reflect.h2"
     autodiff_special_func::autodiff_special_func(cpp2::impl::in<std::string> name_, cpp2::impl::in<int> n_args_, cpp2::impl::in<bool> is_member_, cpp2::impl::in<std::string> code_primal_, cpp2::impl::in<std::string> code_fwd_, 
                           cpp2::impl::in<std::string> code_rws_, cpp2::impl::in<std::string> code_primal_higher_order_, cpp2::impl::in<std::string> code_fwd_higher_order_, 
                           cpp2::impl::in<std::string> code_rws_higher_order_)
@@ -7947,7 +7969,7 @@ auto sample_traverser(cpp2::impl::in<meta::id_expression> idexpr, cpp2::impl::in
         , code_fwd_higher_order{ code_fwd_higher_order_ }
         , code_rws_higher_order{ code_rws_higher_order_ }{
 
-#line 4137 "reflect.h2"
+#line 4152 "reflect.h2"
         if (CPP2_UFCS(empty)(code_primal_higher_order)) {
             code_primal_higher_order = code_primal;
         }
@@ -7959,7 +7981,7 @@ auto sample_traverser(cpp2::impl::in<meta::id_expression> idexpr, cpp2::impl::in
         }
     }
 
-#line 4148 "reflect.h2"
+#line 4163 "reflect.h2"
     autodiff_special_func::autodiff_special_func(autodiff_special_func const& that)
                                    : name{ that.name }
                                    , n_args{ that.n_args }
@@ -7970,7 +7992,7 @@ auto sample_traverser(cpp2::impl::in<meta::id_expression> idexpr, cpp2::impl::in
                                    , code_primal_higher_order{ that.code_primal_higher_order }
                                    , code_fwd_higher_order{ that.code_fwd_higher_order }
                                    , code_rws_higher_order{ that.code_rws_higher_order }{}
-#line 4148 "reflect.h2"
+#line 4163 "reflect.h2"
     auto autodiff_special_func::operator=(autodiff_special_func const& that) -> autodiff_special_func& {
                                    name = that.name;
                                    n_args = that.n_args;
@@ -7982,7 +8004,7 @@ auto sample_traverser(cpp2::impl::in<meta::id_expression> idexpr, cpp2::impl::in
                                    code_fwd_higher_order = that.code_fwd_higher_order;
                                    code_rws_higher_order = that.code_rws_higher_order;
                                    return *this; }
-#line 4148 "reflect.h2"
+#line 4163 "reflect.h2"
     autodiff_special_func::autodiff_special_func(autodiff_special_func&& that) noexcept
                                    : name{ std::move(that).name }
                                    , n_args{ std::move(that).n_args }
@@ -7993,7 +8015,7 @@ auto sample_traverser(cpp2::impl::in<meta::id_expression> idexpr, cpp2::impl::in
                                    , code_primal_higher_order{ std::move(that).code_primal_higher_order }
                                    , code_fwd_higher_order{ std::move(that).code_fwd_higher_order }
                                    , code_rws_higher_order{ std::move(that).code_rws_higher_order }{}
-#line 4148 "reflect.h2"
+#line 4163 "reflect.h2"
     auto autodiff_special_func::operator=(autodiff_special_func&& that) noexcept -> autodiff_special_func& {
                                    name = std::move(that).name;
                                    n_args = std::move(that).n_args;
@@ -8006,47 +8028,47 @@ auto sample_traverser(cpp2::impl::in<meta::id_expression> idexpr, cpp2::impl::in
                                    code_rws_higher_order = std::move(that).code_rws_higher_order;
                                    return *this; }// Default copy.
 
-#line 4150 "reflect.h2"
+#line 4165 "reflect.h2"
     [[nodiscard]] auto autodiff_special_func::is_match(cpp2::impl::in<autodiff_special_func> o) const& -> bool{
         return name == o.name && n_args == o.n_args && is_member == o.is_member; 
     }
 
-#line 4157 "reflect.h2"
+#line 4172 "reflect.h2"
                                         // TODO: Maybe use variant here.
 
-#line 4161 "reflect.h2"
+#line 4176 "reflect.h2"
     autodiff_declared_variable::autodiff_declared_variable(){}
 
-#line 4163 "reflect.h2"
+#line 4178 "reflect.h2"
     autodiff_declared_variable::autodiff_declared_variable(cpp2::impl::in<std::string> name_, cpp2::impl::in<std::string> decl_, cpp2::impl::in<bool> is_active_, cpp2::impl::in<bool> is_member_)
         : name{ name_ }
         , decl{ decl_ }
         , is_active{ is_active_ }
         , is_member{ is_member_ }{
 
-#line 4168 "reflect.h2"
+#line 4183 "reflect.h2"
     }
 
-#line 4170 "reflect.h2"
+#line 4185 "reflect.h2"
     autodiff_declared_variable::autodiff_declared_variable(autodiff_declared_variable const& that)
                                   : name{ that.name }
                                   , decl{ that.decl }
                                   , is_active{ that.is_active }
                                   , is_member{ that.is_member }{}
-#line 4170 "reflect.h2"
+#line 4185 "reflect.h2"
     auto autodiff_declared_variable::operator=(autodiff_declared_variable const& that) -> autodiff_declared_variable& {
                                   name = that.name;
                                   decl = that.decl;
                                   is_active = that.is_active;
                                   is_member = that.is_member;
                                   return *this; }
-#line 4170 "reflect.h2"
+#line 4185 "reflect.h2"
     autodiff_declared_variable::autodiff_declared_variable(autodiff_declared_variable&& that) noexcept
                                   : name{ std::move(that).name }
                                   , decl{ std::move(that).decl }
                                   , is_active{ std::move(that).is_active }
                                   , is_member{ std::move(that).is_member }{}
-#line 4170 "reflect.h2"
+#line 4185 "reflect.h2"
     auto autodiff_declared_variable::operator=(autodiff_declared_variable&& that) noexcept -> autodiff_declared_variable& {
                                   name = std::move(that).name;
                                   decl = std::move(that).decl;
@@ -8054,21 +8076,21 @@ auto sample_traverser(cpp2::impl::in<meta::id_expression> idexpr, cpp2::impl::in
                                   is_member = std::move(that).is_member;
                                   return *this; }
 
-#line 4174 "reflect.h2"
+#line 4189 "reflect.h2"
                                       // namespace + type name
 
-#line 4182 "reflect.h2"
+#line 4197 "reflect.h2"
     autodiff_declaration_stack_item::autodiff_declaration_stack_item(cpp2::impl::in<std::string> full_name_, cpp2::impl::in<meta::type_or_namespace_declaration> decl_)
         : full_name{ full_name_ }
         , decl{ decl_ }{
 
-#line 4185 "reflect.h2"
+#line 4200 "reflect.h2"
     }
 
-#line 4187 "reflect.h2"
+#line 4202 "reflect.h2"
     [[nodiscard]] auto autodiff_declaration_stack_item::lookup_declaration(cpp2::impl::in<std::string> decl_name) const& -> lookup_declaration_ret{
         std::vector<meta::declaration> r {};
-#line 4188 "reflect.h2"
+#line 4203 "reflect.h2"
         for ( auto const& cur : CPP2_UFCS(get_members)(decl) ) {
             if (CPP2_UFCS(has_name)(cur) && decl_name == CPP2_UFCS(name)(cur)) {
                 CPP2_UFCS(push_back)(r, cur);
@@ -8078,7 +8100,7 @@ auto sample_traverser(cpp2::impl::in<meta::id_expression> idexpr, cpp2::impl::in
         }return r; 
     }
 
-#line 4197 "reflect.h2"
+#line 4212 "reflect.h2"
     [[nodiscard]] auto autodiff_declaration_stack_item::lookup_variable_declaration(cpp2::impl::in<std::string> decl_name) const& -> lookup_variable_declaration_ret{
         bool found {false};
         autodiff_declared_variable r {};
@@ -8087,7 +8109,7 @@ auto cur_context{CPP2_UFCS(rbegin)(declared_variables_stack)};
         //  Note: Not using "for std::ranges::views::reverse(...)" because
         //  that does not work correctly in Clang 12 + older libstdc++
 
-#line 4201 "reflect.h2"
+#line 4216 "reflect.h2"
         for( ; cur_context != CPP2_UFCS(rend)(declared_variables_stack); 
               ++cur_context ) 
         {
@@ -8100,10 +8122,10 @@ auto cur_context{CPP2_UFCS(rbegin)(declared_variables_stack)};
             }
         }
 }
-#line 4202 "reflect.h2"
+#line 4217 "reflect.h2"
         return  { std::move(found), std::move(r) }; 
 
-#line 4212 "reflect.h2"
+#line 4227 "reflect.h2"
     }
 
     autodiff_declaration_stack_item::autodiff_declaration_stack_item(autodiff_declaration_stack_item const& that)
@@ -8119,7 +8141,7 @@ autodiff_declaration_stack_item::autodiff_declaration_stack_item(autodiff_declar
                                      , diff_done{ std::move(that).diff_done }
                                      , declared_variables_stack{ std::move(that).declared_variables_stack }{}
 
-#line 4220 "reflect.h2"
+#line 4235 "reflect.h2"
     // Code in special function is replaced. Placeholders are:
     //   _o_  : name of object for member functions.
     //   _o_  : name of derivative object for member functions.
@@ -8130,29 +8152,29 @@ autodiff_declaration_stack_item::autodiff_declaration_stack_item(autodiff_declar
 
                                         /* is_member = */
 
-#line 4237 "reflect.h2"
+#line 4252 "reflect.h2"
                                         /* is_member = */
 
-#line 4245 "reflect.h2"
+#line 4260 "reflect.h2"
                                         /* is_member = */
 
-#line 4253 "reflect.h2"
+#line 4268 "reflect.h2"
                                          /* is_member = */
 
-#line 4261 "reflect.h2"
+#line 4276 "reflect.h2"
                                               /* is_member = */
 
-#line 4272 "reflect.h2"
+#line 4287 "reflect.h2"
     // Members depending on order
 
-#line 4279 "reflect.h2"
+#line 4294 "reflect.h2"
     autodiff_context::autodiff_context(){}
-#line 4280 "reflect.h2"
+#line 4295 "reflect.h2"
     autodiff_context::autodiff_context(cpp2::impl::in<int> order_, cpp2::impl::in<bool> reverse_)
         : order{ order_ }
         , reverse{ reverse_ }{
 
-#line 4284 "reflect.h2"
+#line 4299 "reflect.h2"
         if (1 != order) {
             if (reverse) {
                 fwd_ad_type = "cpp2::taylor<double, " + cpp2::to_string(order - 1) + ">";
@@ -8165,17 +8187,17 @@ autodiff_declaration_stack_item::autodiff_declaration_stack_item(autodiff_declar
 
     }
 
-#line 4296 "reflect.h2"
+#line 4311 "reflect.h2"
     auto autodiff_context::add_variable_declaration(cpp2::impl::in<std::string> name, cpp2::impl::in<std::string> type, cpp2::impl::in<bool> is_active, cpp2::impl::in<bool> is_member) & -> void{
         CPP2_UFCS(push_back)(CPP2_UFCS(back)(CPP2_UFCS(back)(declaration_stack).declared_variables_stack), autodiff_declared_variable(name, type, is_active, is_member));
     }
 
-#line 4300 "reflect.h2"
+#line 4315 "reflect.h2"
     [[nodiscard]] auto autodiff_context::is_variable_active(cpp2::impl::in<std::string> name) & -> bool{
         return lookup_variable_declaration(name).is_active; 
     }
 
-#line 4304 "reflect.h2"
+#line 4319 "reflect.h2"
     auto autodiff_context::create_namespace_stack(cpp2::impl::in<meta::type_or_namespace_declaration> t) & -> void{
         if (CPP2_UFCS(parent_is_nonglobal_namespace)(t)) {
             create_namespace_stack(CPP2_UFCS(as_nonglobal_namespace)(CPP2_UFCS(get_parent)(t)));
@@ -8193,20 +8215,20 @@ autodiff_declaration_stack_item::autodiff_declaration_stack_item(autodiff_declar
         static_cast<void>(CPP2_UFCS(push_back)(declaration_stack, autodiff_declaration_stack_item(cpp2::move(full_name), t)));
     }
 
-#line 4321 "reflect.h2"
+#line 4336 "reflect.h2"
     [[nodiscard]] auto autodiff_context::is_forward() const& -> decltype(auto) { return !(reverse) || (reverse && order != 1);  }
-#line 4322 "reflect.h2"
+#line 4337 "reflect.h2"
     [[nodiscard]] auto autodiff_context::is_reverse() const& -> decltype(auto) { return reverse;  }
-#line 4323 "reflect.h2"
+#line 4338 "reflect.h2"
     [[nodiscard]] auto autodiff_context::is_taylor() const& -> decltype(auto) { return order != 1;  }
 
-#line 4325 "reflect.h2"
+#line 4340 "reflect.h2"
     [[nodiscard]] auto autodiff_context::gen_temporary() & -> std::string{
         temporary_count += 1;
         return "temp_" + cpp2::to_string(temporary_count) + ""; 
     }
 
-#line 4330 "reflect.h2"
+#line 4345 "reflect.h2"
     [[nodiscard]] auto autodiff_context::is_type_active(cpp2::impl::in<std::string> type) & -> bool{
         auto decls {lookup_type_declaration(type)}; 
         auto r {false}; 
@@ -8228,7 +8250,7 @@ autodiff_declaration_stack_item::autodiff_declaration_stack_item(autodiff_declar
         return r; 
     }
 
-#line 4351 "reflect.h2"
+#line 4366 "reflect.h2"
     [[nodiscard]] auto autodiff_context::get_fwd_ad_type(cpp2::impl::in<std::string> type) & -> std::string{
         auto type_d {type}; 
 
@@ -8247,7 +8269,7 @@ autodiff_declaration_stack_item::autodiff_declaration_stack_item(autodiff_declar
         return string_util::replace_all(cpp2::move(type_d), "double", fwd_ad_type); 
     }
 
-#line 4369 "reflect.h2"
+#line 4384 "reflect.h2"
     [[nodiscard]] auto autodiff_context::get_rws_ad_type(cpp2::impl::in<std::string> type) & -> std::string{
         auto type_d {type}; 
 
@@ -8266,7 +8288,7 @@ autodiff_declaration_stack_item::autodiff_declaration_stack_item(autodiff_declar
         return string_util::replace_all(cpp2::move(type_d), "double", rws_ad_type); 
     }
 
-#line 4387 "reflect.h2"
+#line 4402 "reflect.h2"
     [[nodiscard]] auto autodiff_context::get_reverse_passing_style(cpp2::impl::in<passing_style> p) const& -> passing_style{
         // TODO: inspect does not work here: error: error: no matching function for call to ‘is<cpp2::passing_style::in>(const cpp2::passing_style&)’
         // return inspect p -> passing_style  {
@@ -8289,13 +8311,13 @@ autodiff_declaration_stack_item::autodiff_declaration_stack_item(autodiff_declar
         if (p == passing_style::forward)     { return  passing_style::inout; }
         if (p == passing_style::forward_ref) { return  passing_style::inout; }
 
-#line 4410 "reflect.h2"
+#line 4425 "reflect.h2"
         CPP2_UFCS(error)(CPP2_UFCS(back)(declaration_stack).decl, "AD: Do not know how to handle passing style:" + cpp2::to_string(p) + "");
 
         return  passing_style::inout; 
     }
 
-#line 4415 "reflect.h2"
+#line 4430 "reflect.h2"
     [[nodiscard]] auto autodiff_context::lookup_declaration(cpp2::impl::in<std::string> decl_name) & -> lookup_declaration_ret{
         std::vector<meta::declaration> r {};
 {
@@ -8303,7 +8325,7 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
         //  Note: Not using "for std::ranges::views::reverse(...)" because
         //  that does not work correctly in Clang 12 + older libstdc++
 
-#line 4419 "reflect.h2"
+#line 4434 "reflect.h2"
         for( ; cur != CPP2_UFCS(rend)(declaration_stack); 
               ++cur ) 
         {
@@ -8325,11 +8347,11 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
         }
 }
 
-#line 4439 "reflect.h2"
+#line 4454 "reflect.h2"
         return r; 
     }
 
-#line 4442 "reflect.h2"
+#line 4457 "reflect.h2"
     [[nodiscard]] auto autodiff_context::lookup_variable_declaration(cpp2::impl::in<std::string> name) & -> autodiff_declared_variable{
         if (name == "_") {
             return autodiff_declared_variable(name, "_", false, false); 
@@ -8340,7 +8362,7 @@ auto cur_context{CPP2_UFCS(rbegin)(declaration_stack)};
         //  Note: Not using "for std::ranges::views::reverse(...)" because
         //  that does not work correctly in Clang 12 + older libstdc++
 
-#line 4450 "reflect.h2"
+#line 4465 "reflect.h2"
         for( ; cur_context != CPP2_UFCS(rend)(declaration_stack); 
               ++cur_context ) 
         {
@@ -8351,16 +8373,16 @@ auto cur_context{CPP2_UFCS(rbegin)(declaration_stack)};
         }
 }
 
-#line 4459 "reflect.h2"
+#line 4474 "reflect.h2"
         CPP2_UFCS(error)(CPP2_UFCS(back)(declaration_stack).decl, "AD: Could not find declaration of variable with name `" + cpp2::to_string(name) + "`.");
 
         return autodiff_declared_variable(); 
     }
 
-#line 4464 "reflect.h2"
+#line 4479 "reflect.h2"
     [[nodiscard]] auto autodiff_context::lookup_function_declaration(cpp2::impl::in<std::string> decl_name) & -> lookup_function_declaration_ret{
         std::vector<meta::function_declaration> r {};
-#line 4465 "reflect.h2"
+#line 4480 "reflect.h2"
         auto r_all {lookup_declaration(decl_name)}; 
 
         for ( auto const& cur : cpp2::move(r_all) ) {
@@ -8370,10 +8392,10 @@ auto cur_context{CPP2_UFCS(rbegin)(declaration_stack)};
         }return r; 
     }
 
-#line 4474 "reflect.h2"
+#line 4489 "reflect.h2"
     [[nodiscard]] auto autodiff_context::lookup_member_function_declaration(cpp2::impl::in<meta::type_declaration> obj_type, cpp2::impl::in<std::string> decl_name) & -> lookup_member_function_declaration_ret{
         std::vector<meta::function_declaration> r {};
-#line 4475 "reflect.h2"
+#line 4490 "reflect.h2"
         for ( auto const& cur : CPP2_UFCS(get_members)(obj_type) ) {
             if (CPP2_UFCS(is_function)(cur) && CPP2_UFCS(has_name)(cur) && decl_name == CPP2_UFCS(name)(cur)) {
                 CPP2_UFCS(push_back)(r, CPP2_UFCS(as_function)(cur));
@@ -8383,10 +8405,10 @@ auto cur_context{CPP2_UFCS(rbegin)(declaration_stack)};
         }return r; 
     }
 
-#line 4484 "reflect.h2"
+#line 4499 "reflect.h2"
     [[nodiscard]] auto autodiff_context::lookup_type_declaration(cpp2::impl::in<std::string> decl_name) & -> lookup_type_declaration_ret{
         std::vector<meta::type_declaration> r {};
-#line 4485 "reflect.h2"
+#line 4500 "reflect.h2"
         auto r_all {lookup_declaration(decl_name)}; 
 
         for ( auto const& cur : cpp2::move(r_all) ) {
@@ -8396,13 +8418,13 @@ auto cur_context{CPP2_UFCS(rbegin)(declaration_stack)};
         }return r; 
     }
 
-#line 4494 "reflect.h2"
+#line 4509 "reflect.h2"
     [[nodiscard]] auto autodiff_context::lookup_special_function_handling(cpp2::impl::in<std::string> func_name, cpp2::impl::in<int> n_args, cpp2::impl::in<bool> is_member) const& -> lookup_special_function_handling_ret{
             cpp2::impl::deferred_init<bool> m;
             cpp2::impl::deferred_init<std::string> code_primal;
             cpp2::impl::deferred_init<std::string> code_fwd;
             cpp2::impl::deferred_init<std::string> code_rws;
-#line 4495 "reflect.h2"
+#line 4510 "reflect.h2"
         autodiff_special_func lookup {func_name, n_args, is_member}; 
 
         m.construct(false);
@@ -8427,7 +8449,7 @@ auto cur_context{CPP2_UFCS(rbegin)(declaration_stack)};
         }return  { std::move(m.value()), std::move(code_primal.value()), std::move(code_fwd.value()), std::move(code_rws.value()) }; 
     }
 
-#line 4519 "reflect.h2"
+#line 4534 "reflect.h2"
     auto autodiff_context::add_as_differentiated(cpp2::impl::in<meta::declaration> t) & -> void{
         auto top {&CPP2_UFCS(back)(declaration_stack)}; 
 
@@ -8436,7 +8458,7 @@ auto cur_context{CPP2_UFCS(rbegin)(declaration_stack)};
         CPP2_UFCS(push_back)((*cpp2::impl::assert_not_null(cpp2::move(top))).diff_done, t);
     }
 
-#line 4527 "reflect.h2"
+#line 4542 "reflect.h2"
     auto autodiff_context::add_for_differentiation(cpp2::impl::in<meta::declaration> t) & -> void{
         auto t_parent {CPP2_UFCS(get_parent)(t)}; 
 
@@ -8447,7 +8469,7 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
         //  Note: Not using "for std::ranges::views::reverse(...)" because
         //  that does not work correctly in Clang 12 + older libstdc++
 
-#line 4535 "reflect.h2"
+#line 4550 "reflect.h2"
         for( ; cur != CPP2_UFCS(rend)(declaration_stack); 
               ++cur ) 
         {
@@ -8462,13 +8484,13 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
         }
 }
 
-#line 4548 "reflect.h2"
+#line 4563 "reflect.h2"
         if (!(cpp2::move(found))) {
             CPP2_UFCS(error)(t, "AD: Could not find parent type/namespace for: " + cpp2::to_string(t) + "");
         }
     }
 
-#line 4553 "reflect.h2"
+#line 4568 "reflect.h2"
     [[nodiscard]] auto autodiff_context::is_in_list(cpp2::impl::in<meta::declaration> v, cpp2::impl::in<std::vector<meta::declaration>> list) -> bool{
         for ( auto const& cur : list ) {
             if (CPP2_UFCS(is_same)(cur, v)) {
@@ -8479,18 +8501,18 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
         return false; 
     }
 
-#line 4563 "reflect.h2"
+#line 4578 "reflect.h2"
     auto autodiff_context::enter_function() & -> void{
         temporary_count = 0;
         CPP2_UFCS(push_back)(CPP2_UFCS(back)(declaration_stack).declared_variables_stack, std::vector<autodiff_declared_variable>());
     }
 
-#line 4568 "reflect.h2"
+#line 4583 "reflect.h2"
     auto autodiff_context::leave_function() & -> void{
         CPP2_UFCS(pop_back)(CPP2_UFCS(back)(declaration_stack).declared_variables_stack);
     }
 
-#line 4572 "reflect.h2"
+#line 4587 "reflect.h2"
     auto autodiff_context::push_stack(cpp2::impl::in<meta::type_or_namespace_declaration> decl) & -> void{
         std::string full_name {""}; 
 
@@ -8504,7 +8526,7 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
         CPP2_UFCS(push_back)(declaration_stack, autodiff_declaration_stack_item(cpp2::move(full_name), decl));
     }
 
-#line 4585 "reflect.h2"
+#line 4600 "reflect.h2"
     auto autodiff_context::pop_stack() & -> void{
         if (cpp2::cpp2_default.is_active() && !(!(CPP2_UFCS(empty)(declaration_stack))) ) { cpp2::cpp2_default.report_violation(""); }
 
@@ -8520,7 +8542,7 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
         CPP2_UFCS(pop_back)(declaration_stack);
     }
 
-#line 4600 "reflect.h2"
+#line 4615 "reflect.h2"
     auto autodiff_context::finish() & -> void{
         while( !(CPP2_UFCS(empty)(declaration_stack)) ) {
             pop_stack();
@@ -8528,18 +8550,18 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
     }
 
     //TODO: Remove when autodiff_diff_code is updated
-#line 4607 "reflect.h2"
+#line 4622 "reflect.h2"
     [[nodiscard]] auto autodiff_context::get_self() & -> autodiff_context*{
         return &(*this); 
     }
 
-#line 4620 "reflect.h2"
+#line 4635 "reflect.h2"
     autodiff_diff_code::autodiff_diff_code(cpp2::impl::in<autodiff_context*> ctx_)
         : ctx{ ctx_ }{
 
-#line 4622 "reflect.h2"
+#line 4637 "reflect.h2"
     }
-#line 4620 "reflect.h2"
+#line 4635 "reflect.h2"
     auto autodiff_diff_code::operator=(cpp2::impl::in<autodiff_context*> ctx_) -> autodiff_diff_code& {
         ctx = ctx_;
         fwd = "";
@@ -8547,28 +8569,28 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
         rws_backprop = "";
         return *this;
 
-#line 4622 "reflect.h2"
+#line 4637 "reflect.h2"
     }
-#line 4623 "reflect.h2"
+#line 4638 "reflect.h2"
     autodiff_diff_code::autodiff_diff_code(autodiff_diff_code const& that)
                                   : ctx{ that.ctx }
                                   , fwd{ that.fwd }
                                   , rws_primal{ that.rws_primal }
                                   , rws_backprop{ that.rws_backprop }{}
-#line 4623 "reflect.h2"
+#line 4638 "reflect.h2"
     auto autodiff_diff_code::operator=(autodiff_diff_code const& that) -> autodiff_diff_code& {
                                   ctx = that.ctx;
                                   fwd = that.fwd;
                                   rws_primal = that.rws_primal;
                                   rws_backprop = that.rws_backprop;
                                   return *this; }
-#line 4623 "reflect.h2"
+#line 4638 "reflect.h2"
     autodiff_diff_code::autodiff_diff_code(autodiff_diff_code&& that) noexcept
                                   : ctx{ std::move(that).ctx }
                                   , fwd{ std::move(that).fwd }
                                   , rws_primal{ std::move(that).rws_primal }
                                   , rws_backprop{ std::move(that).rws_backprop }{}
-#line 4623 "reflect.h2"
+#line 4638 "reflect.h2"
     auto autodiff_diff_code::operator=(autodiff_diff_code&& that) noexcept -> autodiff_diff_code& {
                                   ctx = std::move(that).ctx;
                                   fwd = std::move(that).fwd;
@@ -8576,14 +8598,14 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
                                   rws_backprop = std::move(that).rws_backprop;
                                   return *this; }
 
-#line 4625 "reflect.h2"
+#line 4640 "reflect.h2"
     auto autodiff_diff_code::add_forward(cpp2::impl::in<std::string> v) & -> void{if (CPP2_UFCS(is_forward)((*cpp2::impl::assert_not_null(ctx)))) {fwd += v;}}
-#line 4626 "reflect.h2"
+#line 4641 "reflect.h2"
     auto autodiff_diff_code::add_reverse_primal(cpp2::impl::in<std::string> v) & -> void{if (CPP2_UFCS(is_reverse)((*cpp2::impl::assert_not_null(ctx)))) {rws_primal += v;}}
-#line 4627 "reflect.h2"
+#line 4642 "reflect.h2"
     auto autodiff_diff_code::add_reverse_backprop(cpp2::impl::in<std::string> v) & -> void{if (CPP2_UFCS(is_reverse)((*cpp2::impl::assert_not_null(ctx)))) {rws_backprop = v + rws_backprop; }}
 
-#line 4629 "reflect.h2"
+#line 4644 "reflect.h2"
     auto autodiff_diff_code::reset() & -> void{
         fwd          = "";
         rws_primal   = "";
@@ -8591,7 +8613,7 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
     }
 
     // Temporary: TODO: remove when everything has been adapted to primal, fwd, rws pushes.
-#line 4636 "reflect.h2"
+#line 4651 "reflect.h2"
     auto autodiff_diff_code::operator=(cpp2::impl::in<std::string> v) -> autodiff_diff_code& {
         ctx = CPP2_UFCS_NONLOCAL(get_self)((*cpp2::impl::assert_not_null(ctx)));
         fwd = v;
@@ -8599,42 +8621,42 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
         rws_backprop = "";
         return *this;
 
-#line 4639 "reflect.h2"
+#line 4654 "reflect.h2"
     }
 
     // Temporary: TODO: remove when everything has been adapted to primal, fwd, rws pushes.
-#line 4642 "reflect.h2"
+#line 4657 "reflect.h2"
     auto autodiff_diff_code::operator+=(cpp2::impl::in<std::string> v) & -> void{
         fwd += v;
     }
 
     // Temporary: TODO: remove when everything has been adapted to primal, fwd, rws pushes.
-#line 4647 "reflect.h2"
+#line 4662 "reflect.h2"
     auto autodiff_diff_code::operator+=(cpp2::impl::in<autodiff_diff_code> v) & -> void{
         fwd += v.fwd;
     }
 
     // Temporary: TODO: remove when everything has been adapted to primal, fwd, rws pushes.
-#line 4652 "reflect.h2"
+#line 4667 "reflect.h2"
     [[nodiscard]] auto autodiff_diff_code::empty() const& -> bool{
         return CPP2_UFCS(empty)(fwd); 
     }
 
-#line 4657 "reflect.h2"
+#line 4672 "reflect.h2"
 // // Temporary: TODO: remove when everything has been adapted to primal, fwd, rws pushes.
 // to_string: (v: autodiff_diff_code) -> std::string = {
 //     return v.fwd;
 // }
 
-#line 4668 "reflect.h2"
+#line 4683 "reflect.h2"
     autodiff_activity_check::autodiff_activity_check(cpp2::impl::in<autodiff_context*> ctx_)
         : simple_traverser{  }
         , ctx{ ctx_ }{
 
-#line 4670 "reflect.h2"
+#line 4685 "reflect.h2"
     }
 
-#line 4672 "reflect.h2"
+#line 4687 "reflect.h2"
     auto autodiff_activity_check::traverse(cpp2::impl::in<meta::type_declaration> t) -> void{
         for ( 
              auto const& m : CPP2_UFCS(get_members)(t) ) 
@@ -8647,7 +8669,7 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
         }
     }
 
-#line 4684 "reflect.h2"
+#line 4699 "reflect.h2"
     auto autodiff_activity_check::traverse(cpp2::impl::in<meta::object_declaration> o) -> void{
 
         auto type {o.type()}; 
@@ -8666,7 +8688,7 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
         }
     }
 
-#line 4702 "reflect.h2"
+#line 4717 "reflect.h2"
     auto autodiff_activity_check::traverse(cpp2::impl::in<meta::primary_expression> primary) -> void
     {
         if (CPP2_UFCS(is_identifier)(primary)) {
@@ -8691,7 +8713,7 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
         }}}}
     }
 
-#line 4726 "reflect.h2"
+#line 4741 "reflect.h2"
     auto autodiff_activity_check::traverse(cpp2::impl::in<meta::postfix_expression> postfix) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(postfix)}; 
@@ -8700,7 +8722,7 @@ auto cur{CPP2_UFCS(rbegin)(declaration_stack)};
 {
 auto i{0};
 
-#line 4733 "reflect.h2"
+#line 4748 "reflect.h2"
         for (                     auto const& term : terms )  { do {
             if (CPP2_UFCS(get_op)(term) == ".") {
                 continue;
@@ -8716,7 +8738,7 @@ auto i{0};
 }
 
         // TODO: Really check for members
-#line 4747 "reflect.h2"
+#line 4762 "reflect.h2"
         if (!(is_func) || CPP2_UFCS(ssize)(terms) != 1) {
             active |= CPP2_UFCS(is_variable_active)((*cpp2::impl::assert_not_null(ctx)), CPP2_UFCS(to_string)(CPP2_UFCS(get_primary_expression)(postfix)));
         }
@@ -8729,39 +8751,39 @@ auto i{0};
         }
     }
 
-#line 4765 "reflect.h2"
+#line 4780 "reflect.h2"
     autodiff_handler_base::autodiff_handler_base(cpp2::impl::in<autodiff_context*> ctx_)
         : ctx{ ctx_ }
         , diff{ ctx }{
 
-#line 4768 "reflect.h2"
+#line 4783 "reflect.h2"
     }
-#line 4765 "reflect.h2"
+#line 4780 "reflect.h2"
     auto autodiff_handler_base::operator=(cpp2::impl::in<autodiff_context*> ctx_) -> autodiff_handler_base& {
         ctx = ctx_;
         diff = ctx;
         return *this;
 
-#line 4768 "reflect.h2"
+#line 4783 "reflect.h2"
     }
 
     // Temporary: TODO: remove when everything has been adapted to primal, fwd, rws pushes.
-#line 4771 "reflect.h2"
+#line 4786 "reflect.h2"
     auto autodiff_handler_base::append(autodiff_handler_base const& o) & -> void{
         diff.fwd          += o.diff.fwd;
         diff.rws_primal   += o.diff.rws_primal;
         diff.rws_backprop  = o.diff.rws_backprop + diff.rws_backprop;
     }
 
-#line 4788 "reflect.h2"
+#line 4803 "reflect.h2"
     autodiff_expression_handler::autodiff_expression_handler(cpp2::impl::in<autodiff_context*> ctx_)
         : simple_traverser{  }
         , autodiff_handler_base{ ctx_ }{
 
-#line 4790 "reflect.h2"
+#line 4805 "reflect.h2"
     }
 
-#line 4792 "reflect.h2"
+#line 4807 "reflect.h2"
     [[nodiscard]] auto autodiff_expression_handler::add_suffix_if_not_wildcard(cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> suffix) const& -> std::string{
         if ("_" == lhs) {
             return lhs; 
@@ -8771,7 +8793,7 @@ auto i{0};
         }
     }
 
-#line 4801 "reflect.h2"
+#line 4816 "reflect.h2"
     [[nodiscard]] auto autodiff_expression_handler::prepare_backprop(cpp2::impl::in<std::string> rhs_b, cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> lhs_d, cpp2::impl::in<std::string> lhs_b) const& -> std::string{
         auto r {rhs_b}; 
         r  = string_util::replace_all(r, "_r_", lhs);
@@ -8780,10 +8802,10 @@ auto i{0};
 
         return r; 
     }
-#line 4809 "reflect.h2"
+#line 4824 "reflect.h2"
     [[nodiscard]] auto autodiff_expression_handler::prepare_backprop(cpp2::impl::in<std::string> rhs_b, cpp2::impl::in<std::string> lhs) const& -> std::string { return prepare_backprop(rhs_b, lhs, lhs + (*cpp2::impl::assert_not_null(ctx)).fwd_suffix, lhs + (*cpp2::impl::assert_not_null(ctx)).rws_suffix);  }
 
-#line 4811 "reflect.h2"
+#line 4826 "reflect.h2"
     auto autodiff_expression_handler::gen_assignment(cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> lhs_d, cpp2::impl::in<std::string> lhs_b, cpp2::impl::in<std::string> rhs, cpp2::impl::in<std::string> rhs_d, cpp2::impl::in<std::string> rhs_b) & -> void{
         CPP2_UFCS(add_forward)(diff, "" + cpp2::to_string(lhs_d) + " = " + cpp2::to_string(rhs_d) + ";\n");
         CPP2_UFCS(add_forward)(diff, "" + cpp2::to_string(lhs) + "   = " + cpp2::to_string(rhs) + ";\n");
@@ -8795,14 +8817,14 @@ auto i{0};
         CPP2_UFCS(add_reverse_backprop)(diff, "" + cpp2::to_string(lhs_b) + " = 0.0;\n");
         CPP2_UFCS(add_reverse_backprop)(diff, prepare_backprop(rhs_b, lhs, lhs_d, lhs_b));
     }
-#line 4822 "reflect.h2"
+#line 4837 "reflect.h2"
     [[nodiscard]] auto autodiff_expression_handler::gen_assignment(cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> lhs_d, cpp2::impl::in<std::string> lhs_b) & -> decltype(auto) { 
         return gen_assignment(lhs, lhs_d, lhs_b, primal_expr, fwd_expr, rws_expr);  }
-#line 4824 "reflect.h2"
+#line 4839 "reflect.h2"
     [[nodiscard]] auto autodiff_expression_handler::gen_assignment(cpp2::impl::in<std::string> lhs) & -> decltype(auto) { 
         return gen_assignment(lhs, add_suffix_if_not_wildcard(lhs, (*cpp2::impl::assert_not_null(ctx)).fwd_suffix), add_suffix_if_not_wildcard(lhs, (*cpp2::impl::assert_not_null(ctx)).rws_suffix), primal_expr, fwd_expr, rws_expr);  }
 
-#line 4828 "reflect.h2"
+#line 4843 "reflect.h2"
     auto autodiff_expression_handler::gen_declaration(cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> lhs_d, cpp2::impl::in<std::string> lhs_b, cpp2::impl::in<std::string> rhs, cpp2::impl::in<std::string> rhs_d, cpp2::impl::in<std::string> rhs_b, cpp2::impl::in<std::string> type, cpp2::impl::in<std::string> type_d, cpp2::impl::in<std::string> type_b) & -> void{
         CPP2_UFCS(add_forward)(diff, "" + cpp2::to_string(lhs_d) + ": " + cpp2::to_string(type_d) + " = " + cpp2::to_string(rhs_d) + ";\n");
         CPP2_UFCS(add_forward)(diff, "" + cpp2::to_string(lhs) + "  : " + cpp2::to_string(type) + " = " + cpp2::to_string(rhs) + ";\n");
@@ -8815,13 +8837,13 @@ auto i{0};
         CPP2_UFCS(add_reverse_backprop)(diff, "" + cpp2::to_string(lhs_b) + " = 0.0;\n");
         CPP2_UFCS(add_reverse_backprop)(diff, prepare_backprop(rhs_b, lhs, lhs_d, lhs_b));
     }
-#line 4840 "reflect.h2"
+#line 4855 "reflect.h2"
     [[nodiscard]] auto autodiff_expression_handler::gen_declaration(cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> lhs_d, cpp2::impl::in<std::string> lhs_b, cpp2::impl::in<std::string> rhs, cpp2::impl::in<std::string> rhs_d, cpp2::impl::in<std::string> rhs_b, cpp2::impl::in<std::string> type) & -> decltype(auto) { 
         return gen_declaration(lhs, lhs_d, lhs_b, rhs, rhs_d, rhs_b, type, CPP2_UFCS(get_fwd_ad_type)((*cpp2::impl::assert_not_null(ctx)), type), CPP2_UFCS(get_rws_ad_type)((*cpp2::impl::assert_not_null(ctx)), type));  }
-#line 4842 "reflect.h2"
+#line 4857 "reflect.h2"
     [[nodiscard]] auto autodiff_expression_handler::gen_declaration(cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> lhs_d, cpp2::impl::in<std::string> lhs_b, cpp2::impl::in<std::string> type) & -> decltype(auto) { 
         return gen_declaration(lhs, lhs_d, lhs_b, primal_expr, fwd_expr, rws_expr, type);  }
-#line 4844 "reflect.h2"
+#line 4859 "reflect.h2"
     [[nodiscard]] auto autodiff_expression_handler::gen_declaration(cpp2::impl::in<std::string> lhs, cpp2::impl::in<std::string> type) & -> decltype(auto) { 
         return gen_declaration(lhs, lhs + (*cpp2::impl::assert_not_null(ctx)).fwd_suffix, lhs + (*cpp2::impl::assert_not_null(ctx)).rws_suffix, type);  }
 
@@ -8832,7 +8854,7 @@ auto i{0};
                                                                        , active{ active_ }{}
 autodiff_expression_handler::primal_fwd_rws_name::primal_fwd_rws_name(){}
 
-#line 4856 "reflect.h2"
+#line 4871 "reflect.h2"
     [[nodiscard]] auto autodiff_expression_handler::handle_expression_list(cpp2::impl::in<meta::expression_list> list) & -> std::vector<primal_fwd_rws_name>{
         std::vector<primal_fwd_rws_name> args {}; 
         for ( auto const& expr : CPP2_UFCS(get_expressions)(list) ) {
@@ -8842,7 +8864,7 @@ autodiff_expression_handler::primal_fwd_rws_name::primal_fwd_rws_name(){}
         return args; 
     }
 
-#line 4865 "reflect.h2"
+#line 4880 "reflect.h2"
     [[nodiscard]] auto autodiff_expression_handler::handle_expression_term(auto const& term) & -> primal_fwd_rws_name{
         if (CPP2_UFCS(is_identifier)(term)) {
             auto primal {CPP2_UFCS(to_string)(term)}; 
@@ -8904,7 +8926,7 @@ autodiff_expression_handler::primal_fwd_rws_name::primal_fwd_rws_name(){}
         }}
     }
 
-#line 4926 "reflect.h2"
+#line 4941 "reflect.h2"
     auto autodiff_expression_handler::handle_function_call(cpp2::impl::in<meta::postfix_expression> postfix, cpp2::impl::in<bool> has_return) & -> void{
         auto terms {CPP2_UFCS(get_terms)(postfix)}; 
 
@@ -8912,7 +8934,7 @@ autodiff_expression_handler::primal_fwd_rws_name::primal_fwd_rws_name(){}
 {
 auto i{0};
 
-#line 4932 "reflect.h2"
+#line 4947 "reflect.h2"
         for (                     auto const& term : terms )  { do {
             if (CPP2_UFCS(get_op)(term) == ".") {
                 continue;
@@ -8926,7 +8948,7 @@ auto i{0};
 }
 
         // Check for function call, everything else is not handled.
-#line 4944 "reflect.h2"
+#line 4959 "reflect.h2"
         if (!((cpp2::move(is_func)))) {
             CPP2_UFCS(error)(postfix, "AD: Postfix expressions are only handled for function calls, or member function calls. Do not know how to handle: " + cpp2::to_string(CPP2_UFCS(to_string)(postfix)) + "");
             return ; 
@@ -8951,7 +8973,7 @@ auto i{0};
 {
 auto i{0};
 
-#line 4967 "reflect.h2"
+#line 4982 "reflect.h2"
         for (                     auto const& term : terms )  { do {
             if (CPP2_UFCS(get_op)(term) == ".") {
                 if (cpp2::cpp2_default.is_active() && !(CPP2_UFCS(is_id_expression)(term)) ) { cpp2::cpp2_default.report_violation(""); }
@@ -8976,7 +8998,7 @@ auto i{0};
         } while (false); i += 1; }
 }
 
-#line 4990 "reflect.h2"
+#line 5005 "reflect.h2"
         if (handle_special_function(object, object_d, object_b, function_name, args)) {
             return ; 
         }
@@ -9093,7 +9115,7 @@ auto i{0};
         // TODO: Add function to list of functions/objects for differentiation for the no return case.
     }
 
-#line 5106 "reflect.h2"
+#line 5121 "reflect.h2"
     [[nodiscard]] auto autodiff_expression_handler::handle_special_function(cpp2::impl::in<std::string> object, cpp2::impl::in<std::string> object_d, cpp2::impl::in<std::string> object_b, cpp2::impl::in<std::string> function_name, cpp2::impl::in<std::vector<primal_fwd_rws_name>> args) & -> bool{
 
         auto r {CPP2_UFCS(lookup_special_function_handling)((*cpp2::impl::assert_not_null(ctx)), function_name, cpp2::unchecked_narrow<int>(CPP2_UFCS(ssize)(args)), !(CPP2_UFCS(empty)(object)))}; 
@@ -9121,7 +9143,7 @@ auto i{0};
 {
 auto i{1};
 
-#line 5132 "reflect.h2"
+#line 5147 "reflect.h2"
         for ( auto const& arg : args ) {
             code_primal = string_util::replace_all(code_primal, "_a" + cpp2::to_string(i) + "_", arg.primal);
             code_primal = string_util::replace_all(code_primal, "_ad" + cpp2::to_string(i) + "_", arg.fwd);
@@ -9135,7 +9157,7 @@ auto i{1};
         }
 }
 
-#line 5144 "reflect.h2"
+#line 5159 "reflect.h2"
         primal_expr = cpp2::move(code_primal);
         fwd_expr    = cpp2::move(code_fwd);
         rws_expr    = cpp2::move(code_rws);
@@ -9143,62 +9165,62 @@ auto i{1};
         return true; 
     }
 
-#line 5151 "reflect.h2"
+#line 5166 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::expression> expr) -> void{
         base::traverse(expr);
     }
 
-#line 5155 "reflect.h2"
+#line 5170 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::assignment_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Assign expressions are not yet handled.");
     }
 
-#line 5159 "reflect.h2"
+#line 5174 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::logical_or_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Logical or expressions are not yet handled.");
     }
 
-#line 5163 "reflect.h2"
+#line 5178 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::logical_and_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Logical and expressions are not yet handled.");
     }
 
-#line 5167 "reflect.h2"
+#line 5182 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::bit_or_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Bit or expressions are not yet handled.");
     }
 
-#line 5171 "reflect.h2"
+#line 5186 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::bit_xor_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Bit xor expressions are not yet handled.");
     }
 
-#line 5175 "reflect.h2"
+#line 5190 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::bit_and_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Bit and expressions are not yet handled.");
     }
 
-#line 5179 "reflect.h2"
+#line 5194 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::equality_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Equality or expressions are not yet handled.");
     }
 
-#line 5183 "reflect.h2"
+#line 5198 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::relational_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Relational expressions are not yet handled.");
     }
 
-#line 5187 "reflect.h2"
+#line 5202 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::compare_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Compare or expressions are not yet handled.");
     }
 
-#line 5191 "reflect.h2"
+#line 5206 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::shift_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Shift or expressions are not yet handled.");
     }
 
-#line 5195 "reflect.h2"
+#line 5210 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::additive_expression> binexpr) -> void{
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
 
@@ -9241,7 +9263,7 @@ auto i{1};
         rws_expr    = cpp2::move(rws);
     }
 
-#line 5237 "reflect.h2"
+#line 5252 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::multiplicative_expression> binexpr) -> void{
         auto terms {CPP2_UFCS(get_terms)(binexpr)}; 
 
@@ -9312,7 +9334,7 @@ auto i{1};
                 CPP2_UFCS(error)(binexpr, "unkown multiplicative operator '" + cpp2::to_string(cpp2::move(op)) + "'");
             }}
 
-#line 5308 "reflect.h2"
+#line 5323 "reflect.h2"
             if (i + 1 == CPP2_UFCS(ssize)(terms)) {
                 primal_expr = cpp2::move(primal);
                 fwd_expr    = cpp2::move(fwd);
@@ -9329,12 +9351,12 @@ auto i{1};
         }
     }
 
-#line 5324 "reflect.h2"
+#line 5339 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::is_as_expression> isas) -> void{
         CPP2_UFCS(error)(isas, "AD: Is as expressions are not yet handled.");
     }
 
-#line 5328 "reflect.h2"
+#line 5343 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::prefix_expression> prefix) -> void
     {
         auto ops {CPP2_UFCS(get_ops)(prefix)}; 
@@ -9351,7 +9373,7 @@ auto i{1};
         fwd_expr    = CPP2_ASSERT_IN_BOUNDS_LITERAL(cpp2::move(ops), 0) + cpp2::move(ad).fwd_expr;
     }
 
-#line 5344 "reflect.h2"
+#line 5359 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::postfix_expression> postfix) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(postfix)}; 
@@ -9360,7 +9382,7 @@ auto i{1};
 {
 auto i{0};
 
-#line 5351 "reflect.h2"
+#line 5366 "reflect.h2"
         for (                     auto const& term : terms )  { do {
             if (CPP2_UFCS(get_op)(term) == ".") {
                 continue;
@@ -9375,7 +9397,7 @@ auto i{0};
         } while (false); i += 1; }
 }
 
-#line 5364 "reflect.h2"
+#line 5379 "reflect.h2"
         if (cpp2::move(is_func)) {
             handle_function_call(postfix, true);
         }
@@ -9396,7 +9418,7 @@ auto i{0};
         }
     }
 
-#line 5384 "reflect.h2"
+#line 5399 "reflect.h2"
     auto autodiff_expression_handler::traverse(cpp2::impl::in<meta::primary_expression> primary) -> void
     {
         if (CPP2_UFCS(is_identifier)(primary)) {
@@ -9433,16 +9455,16 @@ auto i{0};
         }}}}
     }
 
-#line 5434 "reflect.h2"
+#line 5449 "reflect.h2"
     autodiff_stmt_handler::autodiff_stmt_handler(cpp2::impl::in<autodiff_context*> ctx_, cpp2::impl::in<meta::function_declaration> mf_)
         : simple_traverser{  }
         , autodiff_handler_base{ ctx_ }
         , mf{ mf_ }{
 
-#line 5437 "reflect.h2"
+#line 5452 "reflect.h2"
     }
 
-#line 5439 "reflect.h2"
+#line 5454 "reflect.h2"
     [[nodiscard]] auto autodiff_stmt_handler::handle_stmt_parameters(cpp2::impl::in<std::vector<parameter_declaration>> params) & -> autodiff_diff_code{
         autodiff_diff_code r {ctx}; 
         if (CPP2_UFCS(empty)(params)) {
@@ -9472,7 +9494,7 @@ auto i{0};
                 }
             }
 
-#line 5469 "reflect.h2"
+#line 5484 "reflect.h2"
             CPP2_UFCS(add_forward)(r, "" + cpp2::to_string(fwd_pass_style) + " " + cpp2::to_string(name) + " : " + cpp2::to_string(type) + cpp2::to_string(init) + ", ");
             CPP2_UFCS(add_reverse_primal)(r, "" + cpp2::to_string(fwd_pass_style) + " " + cpp2::to_string(name) + " : " + cpp2::to_string(type) + cpp2::to_string(cpp2::move(init)) + ", ");
             if (ada.active) {
@@ -9485,17 +9507,17 @@ auto i{0};
         return r; 
     }
 
-#line 5481 "reflect.h2"
+#line 5496 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::declaration> decl) -> void{
         base::traverse(decl);
     }
 
-#line 5486 "reflect.h2"
+#line 5501 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::function_declaration> f) -> void{
         CPP2_UFCS(error)(f, "AD: Do not know how to handle function_declaration: " + cpp2::to_string(CPP2_UFCS(to_string)(f)) + "");
     }
 
-#line 5491 "reflect.h2"
+#line 5506 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::object_declaration> o) -> void{
         std::string lhs {CPP2_UFCS(name)(o)}; 
         auto type {o.type()}; 
@@ -9557,24 +9579,24 @@ auto i{0};
         CPP2_UFCS(add_variable_declaration)((*cpp2::impl::assert_not_null(ctx)), cpp2::move(lhs), cpp2::move(type), cpp2::move(active));
     }
 
-#line 5553 "reflect.h2"
+#line 5568 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::type_declaration> t) -> void{
         CPP2_UFCS(error)(t, "AD: Do not know how to handle type_declaration: " + cpp2::to_string(CPP2_UFCS(to_string)(t)) + "");
     }
 
-#line 5558 "reflect.h2"
+#line 5573 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::parameter_declaration> t) -> void{
         CPP2_UFCS(error)(t, "AD: Do not know how to handle parameter_declaration: " + cpp2::to_string(CPP2_UFCS(to_string)(t)) + "");
     }
 
-#line 5563 "reflect.h2"
+#line 5578 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::statement> stmt) -> void{
         // TODO: Remove this hack when statements like compound_statement can access their root statement.
         last_params = CPP2_UFCS(get_parameters)(stmt);
         base::traverse(stmt);
     }
 
-#line 5570 "reflect.h2"
+#line 5585 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::compound_statement> stmt) -> void{
         autodiff_stmt_handler ad {ctx, mf}; 
         autodiff_stmt_handler ad_push_pop {ctx, mf}; 
@@ -9609,7 +9631,7 @@ auto i{0};
         CPP2_UFCS(add_reverse_backprop)(diff, "{\n");
     }
 
-#line 5605 "reflect.h2"
+#line 5620 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::return_statement> stmt) -> void{
         if (CPP2_UFCS(has_expression)(stmt)) {
             // Return with expression.
@@ -9626,7 +9648,7 @@ auto i{0};
         }
     }
 
-#line 5621 "reflect.h2"
+#line 5636 "reflect.h2"
     [[nodiscard]] auto autodiff_stmt_handler::reverse_next(cpp2::impl::in<std::string> expr) const& -> std::string{
         if (CPP2_UFCS(contains)(expr, "+=")) {
             return string_util::replace_all(expr, "+=", "-="); 
@@ -9641,7 +9663,7 @@ auto i{0};
 
     }
 
-#line 5636 "reflect.h2"
+#line 5651 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::iteration_statement> stmt) -> void{
         auto diff_params {handle_stmt_parameters(last_params)}; 
 
@@ -9739,7 +9761,7 @@ auto i{0};
         }}
     }
 
-#line 5734 "reflect.h2"
+#line 5749 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::selection_statement> stmt) -> void{
         // TODO: Currently assuming that nothing bad happens in the condition
         diff += "if " + cpp2::to_string(CPP2_UFCS(to_string)(CPP2_UFCS(get_expression)(stmt))) + "";
@@ -9751,12 +9773,12 @@ auto i{0};
         }
     }
 
-#line 5745 "reflect.h2"
+#line 5760 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::expression> expr) -> void{
         base::traverse(expr);
     }
 
-#line 5749 "reflect.h2"
+#line 5764 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::assignment_expression> binexpr) -> void{
         autodiff_activity_check ada {ctx}; 
         CPP2_UFCS(pre_traverse)(ada, CPP2_UFCS(get_lhs_postfix_expression)(binexpr));
@@ -9808,73 +9830,73 @@ auto i{0};
         }
     }
 
-#line 5800 "reflect.h2"
+#line 5815 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::logical_or_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Logical or expressions are not yet handled as standalone statements.");
     }
 
-#line 5804 "reflect.h2"
+#line 5819 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::logical_and_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Logical and expressions are not yet handled as standalone statements.");
     }
 
-#line 5808 "reflect.h2"
+#line 5823 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::bit_or_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Bit or expressions are not yet handled as standalone statements.");
     }
 
-#line 5812 "reflect.h2"
+#line 5827 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::bit_xor_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Bit xor expressions are not yet handled as standalone statements.");
     }
 
-#line 5816 "reflect.h2"
+#line 5831 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::bit_and_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Bit and expressions are not yet handled as standalone statements.");
     }
 
-#line 5820 "reflect.h2"
+#line 5835 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::equality_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Equality or expressions are not yet handled as standalone statements.");
     }
 
-#line 5824 "reflect.h2"
+#line 5839 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::relational_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Relational expressions are not yet handled as standalone statements.");
     }
 
-#line 5828 "reflect.h2"
+#line 5843 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::compare_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Compare or expressions are not yet handled as standalone statements.");
     }
 
-#line 5832 "reflect.h2"
+#line 5847 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::shift_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Shift or expressions are not yet handled as standalone statements.");
     }
 
-#line 5836 "reflect.h2"
+#line 5851 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::additive_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Additive expressions are not yet handled as standalone statements.");
     }
 
-#line 5840 "reflect.h2"
+#line 5855 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::multiplicative_expression> binexpr) -> void{
         CPP2_UFCS(error)(binexpr, "AD: Multiplicative expressions are not yet handled as standalone statements.");
     }
 
-#line 5844 "reflect.h2"
+#line 5859 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::is_as_expression> isas) -> void{
         CPP2_UFCS(error)(isas, "AD: Is as expressions are not yet handled as standalone statements.");
     }
 
-#line 5848 "reflect.h2"
+#line 5863 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::prefix_expression> prefix) -> void
     {
         CPP2_UFCS(error)(prefix, "AD: Prefix expressions are not yet handled as standalone statements.");
     }
 
-#line 5853 "reflect.h2"
+#line 5868 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::postfix_expression> postfix) -> void
     {
         auto terms {CPP2_UFCS(get_terms)(postfix)}; 
@@ -9883,7 +9905,7 @@ auto i{0};
 {
 auto i{0};
 
-#line 5860 "reflect.h2"
+#line 5875 "reflect.h2"
         for (                     auto const& term : terms )  { do {
             if (CPP2_UFCS(get_op)(term) == ".") {
                 continue;
@@ -9898,7 +9920,7 @@ auto i{0};
 }
 
         // Check for function call, everything else is not handled.
-#line 5873 "reflect.h2"
+#line 5888 "reflect.h2"
         if (!((cpp2::move(is_func)))) {
             CPP2_UFCS(error)(postfix, "AD: Postfix expressions are only handled for function calls, or member function calls. Do not know how to handle: " + cpp2::to_string(CPP2_UFCS(to_string)(postfix)) + "");
             return ; 
@@ -9911,27 +9933,27 @@ auto i{0};
         append(cpp2::move(ad));
     }
 
-#line 5885 "reflect.h2"
+#line 5900 "reflect.h2"
     auto autodiff_stmt_handler::traverse(cpp2::impl::in<meta::primary_expression> primary) -> void
     {
         CPP2_UFCS(error)(primary, "AD: Primary expressions are not yet handled as standalone statements.");
     }
 
-#line 5902 "reflect.h2"
+#line 5917 "reflect.h2"
     autodiff_declaration_handler::autodiff_declaration_handler(cpp2::impl::in<autodiff_context*> ctx_, cpp2::impl::in<meta::type_or_namespace_declaration> decl_)
         : simple_traverser{  }
         , autodiff_handler_base{ ctx_ }
         , decl{ decl_ }{
 
-#line 5905 "reflect.h2"
+#line 5920 "reflect.h2"
     }
 
-#line 5907 "reflect.h2"
+#line 5922 "reflect.h2"
     auto autodiff_declaration_handler::traverse(cpp2::impl::in<meta::declaration> decl_) -> void{
         base::traverse(decl_);
     }
 
-#line 5912 "reflect.h2"
+#line 5927 "reflect.h2"
     auto autodiff_declaration_handler::traverse(cpp2::impl::in<meta::function_declaration> f) -> void{
         CPP2_UFCS(enter_function)((*cpp2::impl::assert_not_null(ctx)));
 
@@ -10061,10 +10083,10 @@ auto i{0};
             return ; 
         }
 
-#line 6042 "reflect.h2"
+#line 6057 "reflect.h2"
         autodiff_stmt_handler ad_impl {&*cpp2::impl::assert_not_null(ctx), f}; 
 
-#line 6045 "reflect.h2"
+#line 6060 "reflect.h2"
         for ( auto const& stmt : CPP2_UFCS(get_statements)(CPP2_UFCS(get_compound_body)(f)) ) 
         {
             ad_impl.pre_traverse(stmt);
@@ -10089,7 +10111,7 @@ auto i{0};
         CPP2_UFCS(add_as_differentiated)((*cpp2::impl::assert_not_null(ctx)), f);
     }
 
-#line 6070 "reflect.h2"
+#line 6085 "reflect.h2"
     auto autodiff_declaration_handler::traverse(cpp2::impl::in<meta::object_declaration> o) -> void{
         std::string ad_name {"" + cpp2::to_string(CPP2_UFCS(name)(o)) + cpp2::to_string((*cpp2::impl::assert_not_null(ctx)).fwd_suffix) + ""}; 
         std::string fwd_ad_type {CPP2_UFCS(get_fwd_ad_type)((*cpp2::impl::assert_not_null(ctx)), CPP2_UFCS(type)(o))}; 
@@ -10117,7 +10139,7 @@ auto i{0};
         CPP2_UFCS(add_variable_declaration)((*cpp2::impl::assert_not_null(ctx)), "" + cpp2::to_string(CPP2_UFCS(name)(o)) + "", "" + cpp2::to_string(CPP2_UFCS(type)(o)) + "", true, true);// TODO_a: Add acitivty check
     }
 
-#line 6098 "reflect.h2"
+#line 6113 "reflect.h2"
     auto autodiff_declaration_handler::traverse(cpp2::impl::in<meta::type_declaration> t) -> void{
         CPP2_UFCS(push_stack)((*cpp2::impl::assert_not_null(ctx)), t);
         autodiff_declaration_handler ad {ctx, t}; 
@@ -10141,17 +10163,17 @@ auto i{0};
         }
     }
 
-#line 6122 "reflect.h2"
+#line 6137 "reflect.h2"
     auto autodiff_declaration_handler::traverse(cpp2::impl::in<meta::parameter_declaration> t) -> void{
         CPP2_UFCS(error)(t, "AD: Do not know how to handle parameter_declaration: " + cpp2::to_string(CPP2_UFCS(to_string)(t)) + "");
     }
 
-#line 6127 "reflect.h2"
+#line 6142 "reflect.h2"
     auto autodiff_declaration_handler::traverse(cpp2::impl::in<meta::statement> stmt) -> void{
         CPP2_UFCS(error)(stmt, "AD: Do not know how to handle statement in declaration context: " + cpp2::to_string(CPP2_UFCS(to_string)(stmt)) + "");
     }
 
-#line 6133 "reflect.h2"
+#line 6148 "reflect.h2"
 auto autodiff(meta::type_declaration& t) -> void
 {
 
@@ -10196,7 +10218,7 @@ auto autodiff(meta::type_declaration& t) -> void
     }
 
     if (reverse) {
-        std::cout << "AD: Warning - reverse mode differentiation is very experimental\n";
+        *cpp2::impl::assert_not_null(compile_time_out) << "AD: Warning - reverse mode differentiation is very experimental\n";
     }
 
     autodiff_context ad_ctx {order, reverse}; 
@@ -10334,7 +10356,7 @@ return expression_flags::none;
 [[nodiscard]] auto expression_flags::from_code(cpp2::impl::in<std::string_view> s) -> expression_flags{
 std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::move(str), "expression_flags::", "")); }
 
-#line 6225 "reflect.h2"
+#line 6240 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  regex - creates regular expressions from members
@@ -10350,11 +10372,11 @@ std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::mov
 //  ```
 //
 
-#line 6241 "reflect.h2"
+#line 6256 "reflect.h2"
 //  Possible modifiers for a regular expression.
 //
 
-#line 6245 "reflect.h2"
+#line 6260 "reflect.h2"
                                   // mod: i
                                   // mod: m
                                   // mod: s
@@ -10362,116 +10384,116 @@ std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::mov
                                   // mod: x
                                   // mod: xx
 
-#line 6254 "reflect.h2"
+#line 6269 "reflect.h2"
 //  Tokens for regular expressions.
 //
 
 // Basic class for a regex token.
 //
 
-#line 6263 "reflect.h2"
+#line 6278 "reflect.h2"
     regex_token::regex_token(cpp2::impl::in<std::string> str)
         : string_rep{ str }{
 
-#line 6265 "reflect.h2"
+#line 6280 "reflect.h2"
     }
 
-#line 6267 "reflect.h2"
+#line 6282 "reflect.h2"
     regex_token::regex_token()
         : string_rep{ "" }{
 
-#line 6269 "reflect.h2"
+#line 6284 "reflect.h2"
     }
 
     //parse: (inout ctx: parse_context) -> token_ptr;
                                                                        // Generate the matching code.
                                                                        // Create a reverse token for look behind expressions.
 
-#line 6275 "reflect.h2"
+#line 6290 "reflect.h2"
     auto regex_token::add_groups([[maybe_unused]] std::set<int>& unnamed_param_2) const -> void{}// Adds all group indices to the set.
-#line 6276 "reflect.h2"
+#line 6291 "reflect.h2"
     [[nodiscard]] auto regex_token::to_string() const& -> std::string{return string_rep; }// Create a string representation.
-#line 6277 "reflect.h2"
+#line 6292 "reflect.h2"
     auto regex_token::set_string(cpp2::impl::in<std::string> s) & -> void{string_rep = s; }
 
     regex_token::~regex_token() noexcept{}// Set the string representation.
 
-#line 6292 "reflect.h2"
+#line 6307 "reflect.h2"
     regex_token_check::regex_token_check(cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> check_)
         : regex_token{ str }
         , check{ check_ }{
 
-#line 6295 "reflect.h2"
+#line 6310 "reflect.h2"
     }
 
-#line 6297 "reflect.h2"
+#line 6312 "reflect.h2"
     auto regex_token_check::generate_code(generation_context& ctx) const -> void{
         ctx.add_check(check + "(" + ctx.match_parameters() + ")");
     }
 
-#line 6301 "reflect.h2"
+#line 6316 "reflect.h2"
     [[nodiscard]] auto regex_token_check::reverse() const -> token_ptr { return CPP2_UFCS_TEMPLATE(cpp2_new<regex_token_check>)(cpp2::shared, CPP2_UFCS(to_string)((*this)), (*this).check);  }
 
     regex_token_check::~regex_token_check() noexcept{}
 
-#line 6313 "reflect.h2"
+#line 6328 "reflect.h2"
     regex_token_code::regex_token_code(cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> code_)
         : regex_token{ str }
         , code{ code_ }{
 
-#line 6316 "reflect.h2"
+#line 6331 "reflect.h2"
     }
 
-#line 6318 "reflect.h2"
+#line 6333 "reflect.h2"
     auto regex_token_code::generate_code(generation_context& ctx) const -> void{
         ctx.add(code);
     }
 
-#line 6322 "reflect.h2"
+#line 6337 "reflect.h2"
     [[nodiscard]] auto regex_token_code::reverse() const -> token_ptr { return CPP2_UFCS_TEMPLATE(cpp2_new<regex_token_code>)(cpp2::shared, CPP2_UFCS(to_string)((*this)), (*this).code);  }
 
     regex_token_code::~regex_token_code() noexcept{}
 
-#line 6332 "reflect.h2"
+#line 6347 "reflect.h2"
     regex_token_empty::regex_token_empty(cpp2::impl::in<std::string> str)
         : regex_token{ str }{
 
-#line 6334 "reflect.h2"
+#line 6349 "reflect.h2"
     }
 
-#line 6336 "reflect.h2"
+#line 6351 "reflect.h2"
     auto regex_token_empty::generate_code([[maybe_unused]] generation_context& unnamed_param_2) const -> void{
         // Nothing.
     }
 
-#line 6340 "reflect.h2"
+#line 6355 "reflect.h2"
     [[nodiscard]] auto regex_token_empty::reverse() const -> token_ptr { return CPP2_UFCS_TEMPLATE(cpp2_new<regex_token_empty>)(cpp2::shared, CPP2_UFCS(to_string)((*this)));  }
 
     regex_token_empty::~regex_token_empty() noexcept{}
 
-#line 6352 "reflect.h2"
+#line 6367 "reflect.h2"
     regex_token_list::regex_token_list(cpp2::impl::in<token_vec> t)
         : regex_token{ gen_string(t) }
         , tokens{ t }{
 
-#line 6355 "reflect.h2"
+#line 6370 "reflect.h2"
     }
 
-#line 6357 "reflect.h2"
+#line 6372 "reflect.h2"
     auto regex_token_list::generate_code(generation_context& ctx) const -> void{
         for ( auto const& token : tokens ) {
             (*cpp2::impl::assert_not_null(token)).generate_code(ctx);
         }
     }
 
-#line 6363 "reflect.h2"
+#line 6378 "reflect.h2"
     auto regex_token_list::add_groups(std::set<int>& groups) const -> void{
         for ( auto const& token : tokens ) {
             (*cpp2::impl::assert_not_null(token)).add_groups(groups);
         }
     }
 
-#line 6369 "reflect.h2"
+#line 6384 "reflect.h2"
     [[nodiscard]] auto regex_token_list::gen_string(cpp2::impl::in<token_vec> vec) -> std::string{
         std::string r {""}; 
         for ( auto const& token : vec ) {
@@ -10480,7 +10502,7 @@ std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::mov
         return r; 
     }
 
-#line 6377 "reflect.h2"
+#line 6392 "reflect.h2"
     [[nodiscard]] auto regex_token_list::reverse() const -> token_ptr{
         int s {cpp2::unchecked_narrow<int>(tokens.size())}; 
 
@@ -10496,7 +10518,7 @@ std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::mov
 
     regex_token_list::~regex_token_list() noexcept{}
 
-#line 6405 "reflect.h2"
+#line 6420 "reflect.h2"
     auto parse_context_group_state::next_alternative() & -> void{
         token_vec new_list {}; 
         std::swap(new_list, cur_match_list);
@@ -10504,14 +10526,14 @@ std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::mov
         static_cast<void>(alternate_match_lists.insert(alternate_match_lists.end(), CPP2_UFCS_TEMPLATE(cpp2_new<regex_token_list>)(cpp2::shared, cpp2::move(new_list))));
     }
 
-#line 6413 "reflect.h2"
+#line 6428 "reflect.h2"
     auto parse_context_group_state::swap(parse_context_group_state& t) & -> void{// NOLINT(performance-noexcept-swap)
         std::swap(cur_match_list, t.cur_match_list);
         std::swap(alternate_match_lists, t.alternate_match_lists);
         std::swap(modifiers, t.modifiers);
     }
 
-#line 6420 "reflect.h2"
+#line 6435 "reflect.h2"
     [[nodiscard]] auto parse_context_group_state::get_as_token() & -> token_ptr{
         if (alternate_match_lists.empty()) {
             post_process_list(cur_match_list);
@@ -10523,15 +10545,15 @@ std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::mov
         }
     }
 
-#line 6432 "reflect.h2"
+#line 6447 "reflect.h2"
     auto parse_context_group_state::add(cpp2::impl::in<token_ptr> token) & -> void{
         cur_match_list.push_back(token);
     }
 
-#line 6437 "reflect.h2"
+#line 6452 "reflect.h2"
     [[nodiscard]] auto parse_context_group_state::empty() const& -> bool { return cur_match_list.empty();  }
 
-#line 6441 "reflect.h2"
+#line 6456 "reflect.h2"
     auto parse_context_group_state::post_process_list(token_vec& list) -> void{
         // Merge all characters
         auto merge_pos {list.begin()}; 
@@ -10552,7 +10574,7 @@ std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::mov
                                                                                               , modifiers{ modifiers_ }{}
 parse_context_group_state::parse_context_group_state(){}
 
-#line 6467 "reflect.h2"
+#line 6482 "reflect.h2"
     [[nodiscard]] auto parse_context_branch_reset_state::next() & -> int{
         auto g {cur_group}; 
         cur_group += 1;
@@ -10561,20 +10583,20 @@ parse_context_group_state::parse_context_group_state(){}
         return g; 
     }
 
-#line 6476 "reflect.h2"
+#line 6491 "reflect.h2"
     auto parse_context_branch_reset_state::set_next(cpp2::impl::in<int> g) & -> void{
         cur_group = g;
         max_group = max(max_group, g);
     }
 
-#line 6482 "reflect.h2"
+#line 6497 "reflect.h2"
     auto parse_context_branch_reset_state::next_alternative() & -> void{
         if (is_active) {
             cur_group = from;
         }
     }
 
-#line 6489 "reflect.h2"
+#line 6504 "reflect.h2"
     auto parse_context_branch_reset_state::set_active_reset(cpp2::impl::in<int> restart) & -> void{
         is_active = true;
         cur_group = restart;
@@ -10589,16 +10611,16 @@ parse_context_group_state::parse_context_group_state(){}
                                                                                     , from{ from_ }{}
 parse_context_branch_reset_state::parse_context_branch_reset_state(){}
 
-#line 6519 "reflect.h2"
+#line 6534 "reflect.h2"
     parse_context::parse_context(cpp2::impl::in<std::string_view> r, auto const& e)
         : regex{ r }
         , root{ CPP2_UFCS_TEMPLATE_NONLOCAL(cpp2_new<regex_token_empty>)(cpp2::shared, "") }
         , error_out{ e }{
 
-#line 6523 "reflect.h2"
+#line 6538 "reflect.h2"
     }
 
-#line 6529 "reflect.h2"
+#line 6544 "reflect.h2"
     [[nodiscard]] auto parse_context::start_group() & -> parse_context_group_state
     {
         parse_context_group_state old_state {}; 
@@ -10608,7 +10630,7 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return old_state; 
     }
 
-#line 6539 "reflect.h2"
+#line 6554 "reflect.h2"
     [[nodiscard]] auto parse_context::end_group(cpp2::impl::in<parse_context_group_state> old_state) & -> token_ptr
     {
         auto inner {cur_group_state.get_as_token()}; 
@@ -10616,17 +10638,17 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return inner; 
     }
 
-#line 6546 "reflect.h2"
+#line 6561 "reflect.h2"
     [[nodiscard]] auto parse_context::get_modifiers() const& -> expression_flags{
         return cur_group_state.modifiers; 
     }
 
-#line 6550 "reflect.h2"
+#line 6565 "reflect.h2"
     auto parse_context::set_modifiers(cpp2::impl::in<expression_flags> mod) & -> void{
         cur_group_state.modifiers = mod;
     }
 
-#line 6557 "reflect.h2"
+#line 6572 "reflect.h2"
     [[nodiscard]] auto parse_context::branch_reset_new_state() & -> parse_context_branch_reset_state
     {
         parse_context_branch_reset_state old_state {}; 
@@ -10636,7 +10658,7 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return old_state; 
     }
 
-#line 6566 "reflect.h2"
+#line 6581 "reflect.h2"
     auto parse_context::branch_reset_restore_state(cpp2::impl::in<parse_context_branch_reset_state> old_state) & -> void
     {
         auto max_group {cur_branch_reset_state.max_group}; 
@@ -10644,24 +10666,24 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         cur_branch_reset_state.set_next(cpp2::move(max_group));
     }
 
-#line 6573 "reflect.h2"
+#line 6588 "reflect.h2"
     auto parse_context::next_alternative() & -> void
     {
         cur_group_state.next_alternative();
         cur_branch_reset_state.next_alternative();
     }
 
-#line 6581 "reflect.h2"
+#line 6596 "reflect.h2"
     auto parse_context::add_token(cpp2::impl::in<token_ptr> token) & -> void{
         cur_group_state.add(token);
     }
 
-#line 6585 "reflect.h2"
+#line 6600 "reflect.h2"
     [[nodiscard]] auto parse_context::has_token() const& -> bool{
         return !(cur_group_state.empty()); 
     }
 
-#line 6589 "reflect.h2"
+#line 6604 "reflect.h2"
     [[nodiscard]] auto parse_context::pop_token() & -> token_ptr
     {
         token_ptr r {nullptr}; 
@@ -10673,22 +10695,22 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return r; 
     }
 
-#line 6600 "reflect.h2"
+#line 6615 "reflect.h2"
     [[nodiscard]] auto parse_context::get_as_token() & -> token_ptr{
         return root; 
     }
 
-#line 6606 "reflect.h2"
+#line 6621 "reflect.h2"
     [[nodiscard]] auto parse_context::get_cur_group() const& -> int{
         return cur_branch_reset_state.cur_group; 
     }
 
-#line 6610 "reflect.h2"
+#line 6625 "reflect.h2"
     [[nodiscard]] auto parse_context::next_group() & -> int{
         return cur_branch_reset_state.next(); 
     }
 
-#line 6614 "reflect.h2"
+#line 6629 "reflect.h2"
     auto parse_context::set_named_group(cpp2::impl::in<std::string> name, cpp2::impl::in<int> id) & -> void
     {
         if (!(named_groups.contains(name))) {// Redefinition of group name is not an error. The left most one is retained.
@@ -10696,7 +10718,7 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         }
     }
 
-#line 6621 "reflect.h2"
+#line 6636 "reflect.h2"
     [[nodiscard]] auto parse_context::get_named_group(cpp2::impl::in<std::string> name) const& -> int
     {
         auto iter {named_groups.find(name)}; 
@@ -10708,10 +10730,10 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         }
     }
 
-#line 6634 "reflect.h2"
+#line 6649 "reflect.h2"
     [[nodiscard]] auto parse_context::current() const& -> char{return CPP2_ASSERT_IN_BOUNDS(regex, pos); }
 
-#line 6637 "reflect.h2"
+#line 6652 "reflect.h2"
     [[nodiscard]] auto parse_context::get_next_position(cpp2::impl::in<bool> in_class, cpp2::impl::in<bool> no_skip) const& -> size_t
     {
         auto perl_syntax {false}; 
@@ -10751,7 +10773,7 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return cur; 
     }
 
-#line 6677 "reflect.h2"
+#line 6692 "reflect.h2"
     [[nodiscard]] auto parse_context::next_impl(cpp2::impl::in<bool> in_class, cpp2::impl::in<bool> no_skip) & -> bool
     {
         pos = get_next_position(in_class, no_skip);
@@ -10763,14 +10785,14 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         }
     }
 
-#line 6688 "reflect.h2"
+#line 6703 "reflect.h2"
     [[nodiscard]] auto parse_context::next() & -> decltype(auto) { return next_impl(false, false); }
-#line 6689 "reflect.h2"
+#line 6704 "reflect.h2"
     [[nodiscard]] auto parse_context::next_in_class() & -> decltype(auto) { return next_impl(true, false);  }
-#line 6690 "reflect.h2"
+#line 6705 "reflect.h2"
     [[nodiscard]] auto parse_context::next_no_skip() & -> decltype(auto) { return next_impl(false, true); }
 
-#line 6692 "reflect.h2"
+#line 6707 "reflect.h2"
     [[nodiscard]] auto parse_context::next_n(cpp2::impl::in<int> n) & -> bool{
         auto r {true}; 
         auto cur {0}; 
@@ -10780,10 +10802,10 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return r; 
     }
 
-#line 6701 "reflect.h2"
+#line 6716 "reflect.h2"
     [[nodiscard]] auto parse_context::has_next() const& -> bool{return cpp2::impl::cmp_less(pos,regex.size()); }
 
-#line 6703 "reflect.h2"
+#line 6718 "reflect.h2"
     [[nodiscard]] auto parse_context::grab_until_impl(cpp2::impl::in<std::string> e, cpp2::impl::out<std::string> r, cpp2::impl::in<bool> any) & -> bool
     {
         auto end {pos}; // NOLINT(clang-analyzer-deadcode.DeadStores)
@@ -10805,14 +10827,14 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         }
     }
 
-#line 6724 "reflect.h2"
+#line 6739 "reflect.h2"
     [[nodiscard]] auto parse_context::grab_until(cpp2::impl::in<std::string> e, cpp2::impl::out<std::string> r) & -> decltype(auto) { return grab_until_impl(e, cpp2::impl::out(&r), false); }
-#line 6725 "reflect.h2"
+#line 6740 "reflect.h2"
     [[nodiscard]] auto parse_context::grab_until(cpp2::impl::in<char> e, cpp2::impl::out<std::string> r) & -> decltype(auto) { return grab_until_impl(std::string(1, e), cpp2::impl::out(&r), false); }
-#line 6726 "reflect.h2"
+#line 6741 "reflect.h2"
     [[nodiscard]] auto parse_context::grab_until_one_of(cpp2::impl::in<std::string> e, cpp2::impl::out<std::string> r) & -> decltype(auto) { return grab_until_impl(e, cpp2::impl::out(&r), true);  }
 
-#line 6728 "reflect.h2"
+#line 6743 "reflect.h2"
     [[nodiscard]] auto parse_context::grab_n(cpp2::impl::in<int> n, cpp2::impl::out<std::string> r) & -> bool
     {
         if (cpp2::impl::cmp_less_eq(pos + cpp2::impl::as_<size_t>(n),regex.size())) {
@@ -10826,7 +10848,7 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         }
     }
 
-#line 6741 "reflect.h2"
+#line 6756 "reflect.h2"
     [[nodiscard]] auto parse_context::grab_number() & -> std::string
     {
         auto start {pos}; 
@@ -10848,7 +10870,7 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return cpp2::move(r.value()); 
     }
 
-#line 6762 "reflect.h2"
+#line 6777 "reflect.h2"
     [[nodiscard]] auto parse_context::peek_impl(cpp2::impl::in<bool> in_class) const& -> char{
         auto next_pos {get_next_position(in_class, false)}; 
         if (cpp2::impl::cmp_less(next_pos,regex.size())) {
@@ -10859,12 +10881,12 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         }
     }
 
-#line 6772 "reflect.h2"
+#line 6787 "reflect.h2"
     [[nodiscard]] auto parse_context::peek() const& -> decltype(auto) { return peek_impl(false); }
-#line 6773 "reflect.h2"
+#line 6788 "reflect.h2"
     [[nodiscard]] auto parse_context::peek_in_class() const& -> decltype(auto) { return peek_impl(true);  }
 
-#line 6778 "reflect.h2"
+#line 6793 "reflect.h2"
     [[nodiscard]] auto parse_context::parser_group_modifiers(cpp2::impl::in<std::string> change_str, expression_flags& parser_modifiers) & -> bool
     {
         auto is_negative {false}; 
@@ -10919,7 +10941,7 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return true; 
     }
 
-#line 6832 "reflect.h2"
+#line 6847 "reflect.h2"
     [[nodiscard]] auto parse_context::parse_until(cpp2::impl::in<char> term) & -> bool{
         token_ptr cur_token {}; 
 
@@ -10959,7 +10981,7 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return true; 
     }
 
-#line 6871 "reflect.h2"
+#line 6886 "reflect.h2"
     [[nodiscard]] auto parse_context::parse(cpp2::impl::in<std::string> modifiers) & -> bool
     {
 
@@ -10975,21 +10997,21 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return r; 
     }
 
-#line 6888 "reflect.h2"
+#line 6903 "reflect.h2"
     [[nodiscard]] auto parse_context::get_pos() const& -> decltype(auto) { return pos; }
-#line 6889 "reflect.h2"
+#line 6904 "reflect.h2"
     [[nodiscard]] auto parse_context::get_range(cpp2::impl::in<size_t> start, cpp2::impl::in<size_t> end) const& -> decltype(auto) { return std::string(regex.substr(start, end - start + 1));  }
-#line 6890 "reflect.h2"
+#line 6905 "reflect.h2"
     [[nodiscard]] auto parse_context::valid() const& -> bool{return has_next() && !(has_error); }
 
-#line 6892 "reflect.h2"
+#line 6907 "reflect.h2"
     [[nodiscard]] auto parse_context::error(cpp2::impl::in<std::string> err) & -> token_ptr{
         has_error = true;
         error_out("Error during parsing of regex '" + cpp2::to_string(regex) + "' at position '" + cpp2::to_string(pos) + "': " + cpp2::to_string(err) + "");
         return nullptr; 
     }
 
-#line 6907 "reflect.h2"
+#line 6922 "reflect.h2"
     auto generation_function_context::add_tabs(cpp2::impl::in<int> c) & -> void{
         int i {0}; 
         for( ; cpp2::impl::cmp_less(i,c); i += 1 ) {
@@ -10997,7 +11019,7 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         }
     }
 
-#line 6914 "reflect.h2"
+#line 6929 "reflect.h2"
     auto generation_function_context::remove_tabs(cpp2::impl::in<int> c) & -> void{
         tabs = tabs.substr(0, (cpp2::impl::as_<size_t>(c)) * 2);
     }
@@ -11007,22 +11029,22 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
                                                        , tabs{ tabs_ }{}
 generation_function_context::generation_function_context(){}
 
-#line 6932 "reflect.h2"
+#line 6947 "reflect.h2"
     [[nodiscard]] auto generation_context::match_parameters() const& -> std::string{return "r.pos, ctx"; }
 
-#line 6937 "reflect.h2"
+#line 6952 "reflect.h2"
     auto generation_context::add(cpp2::impl::in<std::string> s) & -> void{
         auto cur {get_current()}; 
         (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + cpp2::to_string(s) + "\n";
     }
 
-#line 6943 "reflect.h2"
+#line 6958 "reflect.h2"
     auto generation_context::add_check(cpp2::impl::in<std::string> check) & -> void{
         auto cur {get_current()}; 
         (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "if !cpp2::regex::" + cpp2::to_string(check) + " { r.matched = false; break; }\n";
     }
 
-#line 6949 "reflect.h2"
+#line 6964 "reflect.h2"
     auto generation_context::add_statefull(cpp2::impl::in<std::string> next_func, cpp2::impl::in<std::string> check) & -> void
     {
         end_func_statefull(check);
@@ -11031,7 +11053,7 @@ generation_function_context::generation_function_context(){}
         start_func_named(cpp2::move(name));
     }
 
-#line 6957 "reflect.h2"
+#line 6972 "reflect.h2"
     auto generation_context::start_func_named(cpp2::impl::in<std::string> name) & -> void
     {
         auto cur {new_context()}; 
@@ -11043,7 +11065,7 @@ generation_function_context::generation_function_context(){}
         (*cpp2::impl::assert_not_null(cpp2::move(cur))).add_tabs(3);
     }
 
-#line 6968 "reflect.h2"
+#line 6983 "reflect.h2"
     [[nodiscard]] auto generation_context::start_func() & -> std::string
     {
         auto name {gen_func_name()}; 
@@ -11051,7 +11073,7 @@ generation_function_context::generation_function_context(){}
         return cpp2::move(name) + "()"; 
     }
 
-#line 6975 "reflect.h2"
+#line 6990 "reflect.h2"
     auto generation_context::end_func_statefull(cpp2::impl::in<std::string> s) & -> void
     {
         auto cur {get_current()}; 
@@ -11072,7 +11094,7 @@ generation_function_context::generation_function_context(){}
         finish_context();
     }
 
-#line 6996 "reflect.h2"
+#line 7011 "reflect.h2"
     [[nodiscard]] auto generation_context::generate_func(cpp2::impl::in<token_ptr> token) & -> std::string
     {
         auto name {start_func()}; 
@@ -11082,7 +11104,7 @@ generation_function_context::generation_function_context(){}
         return name; 
     }
 
-#line 7006 "reflect.h2"
+#line 7021 "reflect.h2"
     [[nodiscard]] auto generation_context::generate_reset(cpp2::impl::in<std::set<int>> groups) & -> std::string
     {
         if (groups.empty()) {
@@ -11105,33 +11127,33 @@ generation_function_context::generation_function_context(){}
         return cpp2::move(name) + "()"; 
     }
 
-#line 7030 "reflect.h2"
+#line 7045 "reflect.h2"
     [[nodiscard]] auto generation_context::gen_func_name() & -> std::string{
         auto cur_id {matcher_func}; 
         matcher_func += 1;
         return "func_" + cpp2::to_string(cpp2::move(cur_id)) + ""; 
     }
 
-#line 7036 "reflect.h2"
+#line 7051 "reflect.h2"
     [[nodiscard]] auto generation_context::next_func_name() & -> std::string{
         return gen_func_name() + "()"; 
     }
 
-#line 7040 "reflect.h2"
+#line 7055 "reflect.h2"
     [[nodiscard]] auto generation_context::gen_reset_func_name() & -> std::string{
         auto cur_id {reset_func}; 
         reset_func += 1;
         return "reset_" + cpp2::to_string(cpp2::move(cur_id)) + ""; 
     }
 
-#line 7046 "reflect.h2"
+#line 7061 "reflect.h2"
     [[nodiscard]] auto generation_context::gen_temp() & -> std::string{
         auto cur_id {temp_name}; 
         temp_name += 1;
         return "tmp_" + cpp2::to_string(cpp2::move(cur_id)) + ""; 
     }
 
-#line 7054 "reflect.h2"
+#line 7069 "reflect.h2"
     [[nodiscard]] auto generation_context::new_context() & -> generation_function_context*{
         gen_stack.push_back(generation_function_context());
         auto cur {get_current()}; 
@@ -11140,7 +11162,7 @@ generation_function_context::generation_function_context(){}
         return cur; 
     }
 
-#line 7062 "reflect.h2"
+#line 7077 "reflect.h2"
     auto generation_context::finish_context() & -> void{
         auto cur {get_current()}; 
         auto base {get_base()}; 
@@ -11149,22 +11171,22 @@ generation_function_context::generation_function_context(){}
         gen_stack.pop_back();
     }
 
-#line 7072 "reflect.h2"
+#line 7087 "reflect.h2"
     [[nodiscard]] auto generation_context::get_current() & -> generation_function_context*{
         return &gen_stack.back(); 
     }
 
-#line 7076 "reflect.h2"
+#line 7091 "reflect.h2"
     [[nodiscard]] auto generation_context::get_base() & -> generation_function_context*{
         return &CPP2_ASSERT_IN_BOUNDS_LITERAL(gen_stack, 0); 
     }
 
-#line 7080 "reflect.h2"
+#line 7095 "reflect.h2"
     [[nodiscard]] auto generation_context::get_entry_func() const& -> std::string{
         return entry_func; 
     }
 
-#line 7084 "reflect.h2"
+#line 7099 "reflect.h2"
     [[nodiscard]] auto generation_context::create_named_group_lookup(cpp2::impl::in<std::map<std::string,int>> named_groups) const& -> std::string
     {
         std::string res {"get_named_group_index: (name) -> int = {\n"}; 
@@ -11188,18 +11210,18 @@ generation_function_context::generation_function_context(){}
         return res; 
     }
 
-#line 7109 "reflect.h2"
+#line 7124 "reflect.h2"
     [[nodiscard]] auto generation_context::run(cpp2::impl::in<token_ptr> token) & -> std::string{
         entry_func = generate_func(token);
 
         return (*cpp2::impl::assert_not_null(get_base())).code; 
     }
 
-#line 7124 "reflect.h2"
+#line 7139 "reflect.h2"
     alternative_token::alternative_token()
                             : regex_token_empty{ "" }{}
 
-#line 7126 "reflect.h2"
+#line 7141 "reflect.h2"
     [[nodiscard]] auto alternative_token::parse(parse_context& ctx) -> token_ptr{
         if (ctx.current() != '|') {return nullptr; }
 
@@ -11210,15 +11232,15 @@ generation_function_context::generation_function_context(){}
 
     alternative_token::~alternative_token() noexcept{}
 
-#line 7141 "reflect.h2"
+#line 7156 "reflect.h2"
     alternative_token_gen::alternative_token_gen(cpp2::impl::in<token_vec> a)
         : regex_token{ gen_string(a) }
         , alternatives{ a }{
 
-#line 7144 "reflect.h2"
+#line 7159 "reflect.h2"
     }
 
-#line 7146 "reflect.h2"
+#line 7161 "reflect.h2"
     auto alternative_token_gen::generate_code(generation_context& ctx) const -> void
     {
         std::string functions {""}; 
@@ -11236,7 +11258,7 @@ generation_function_context::generation_function_context(){}
         ctx.add_statefull(next_name, "cpp2::regex::alternative_token_matcher<char>::match(" + cpp2::to_string(ctx.match_parameters()) + ", other, " + cpp2::to_string(next_name) + " " + cpp2::to_string(cpp2::move(functions)) + ")");
     }
 
-#line 7163 "reflect.h2"
+#line 7178 "reflect.h2"
     auto alternative_token_gen::add_groups(std::set<int>& groups) const -> void
     {
         for ( auto const& cur : alternatives ) {
@@ -11244,7 +11266,7 @@ generation_function_context::generation_function_context(){}
         }
     }
 
-#line 7170 "reflect.h2"
+#line 7185 "reflect.h2"
     [[nodiscard]] auto alternative_token_gen::gen_string(cpp2::impl::in<token_vec> a) -> std::string
     {
         std::string r {""}; 
@@ -11258,7 +11280,7 @@ generation_function_context::generation_function_context(){}
         return r; 
     }
 
-#line 7183 "reflect.h2"
+#line 7198 "reflect.h2"
     [[nodiscard]] auto alternative_token_gen::reverse() const -> token_ptr{
         int s {cpp2::unchecked_narrow<int>(alternatives.size())}; 
 
@@ -11274,14 +11296,14 @@ generation_function_context::generation_function_context(){}
 
     alternative_token_gen::~alternative_token_gen() noexcept{}
 
-#line 7204 "reflect.h2"
+#line 7219 "reflect.h2"
     any_token::any_token(cpp2::impl::in<bool> single_line)
         : regex_token_check{ ".", "any_token_matcher<char, " + cpp2::to_string(single_line) + ">" }{
 
-#line 7206 "reflect.h2"
+#line 7221 "reflect.h2"
     }
 
-#line 7208 "reflect.h2"
+#line 7223 "reflect.h2"
     [[nodiscard]] auto any_token::parse(parse_context& ctx) -> token_ptr{
         if ('.' != ctx.current()) {return nullptr; }
 
@@ -11290,11 +11312,11 @@ generation_function_context::generation_function_context(){}
 
     any_token::~any_token() noexcept{}
 
-#line 7223 "reflect.h2"
+#line 7238 "reflect.h2"
     atomic_group_token::atomic_group_token()
                              : regex_token{ "" }{}
 
-#line 7225 "reflect.h2"
+#line 7240 "reflect.h2"
     [[nodiscard]] auto atomic_group_token::reverse() const -> token_ptr{
         auto r {CPP2_UFCS_TEMPLATE(cpp2_new<atomic_group_token>)(cpp2::shared)}; 
         (*cpp2::impl::assert_not_null(r)).inner_token = CPP2_UFCS(reverse)((*cpp2::impl::assert_not_null(inner_token)));
@@ -11302,7 +11324,7 @@ generation_function_context::generation_function_context(){}
         return r; 
     }
 
-#line 7232 "reflect.h2"
+#line 7247 "reflect.h2"
     auto atomic_group_token::generate_code(generation_context& ctx) const -> void
     {
         auto inner_name {ctx.generate_func(inner_token)}; 
@@ -11311,37 +11333,37 @@ generation_function_context::generation_function_context(){}
         ctx.add_statefull(next_name, "cpp2::regex::atomic_group_matcher<char>(" + cpp2::to_string(ctx.match_parameters()) + ", " + cpp2::to_string(cpp2::move(inner_name)) + ", other, " + cpp2::to_string(next_name) + ")");
     }
 
-#line 7240 "reflect.h2"
+#line 7255 "reflect.h2"
     auto atomic_group_token::add_groups(std::set<int>& groups) const -> void{
         (*cpp2::impl::assert_not_null(inner_token)).add_groups(groups);
     }
 
     atomic_group_token::~atomic_group_token() noexcept{}
 
-#line 7254 "reflect.h2"
+#line 7269 "reflect.h2"
     char_token::char_token(cpp2::impl::in<char> t, cpp2::impl::in<bool> ignore_case_)
         : regex_token{ std::string(1, t) }
         , token{ t }
         , ignore_case{ ignore_case_ }{
 
-#line 7258 "reflect.h2"
+#line 7273 "reflect.h2"
     }
 
-#line 7260 "reflect.h2"
+#line 7275 "reflect.h2"
     char_token::char_token(cpp2::impl::in<std::string> t, cpp2::impl::in<bool> ignore_case_)
         : regex_token{ t }
         , token{ t }
         , ignore_case{ ignore_case_ }{
 
-#line 7264 "reflect.h2"
+#line 7279 "reflect.h2"
     }
 
-#line 7266 "reflect.h2"
+#line 7281 "reflect.h2"
     [[nodiscard]] auto char_token::parse(parse_context& ctx) -> token_ptr{
         return CPP2_UFCS_TEMPLATE(cpp2_new<char_token>)(cpp2::shared, ctx.current(), ctx.get_modifiers().has(expression_flags::case_insensitive)); 
     }
 
-#line 7270 "reflect.h2"
+#line 7285 "reflect.h2"
     auto char_token::generate_code(generation_context& ctx) const -> void
     {
         if (ignore_case) {
@@ -11350,14 +11372,14 @@ generation_function_context::generation_function_context(){}
 {
 size_t i{0};
 
-#line 7276 "reflect.h2"
+#line 7291 "reflect.h2"
             for( ; cpp2::impl::cmp_less(i,token.size()); i += 1 ) {
                 CPP2_ASSERT_IN_BOUNDS(lower, i) = string_util::safe_tolower(CPP2_ASSERT_IN_BOUNDS(token, i));
                 CPP2_ASSERT_IN_BOUNDS(upper, i) = string_util::safe_toupper(CPP2_ASSERT_IN_BOUNDS(token, i));
             }
 }
 
-#line 7281 "reflect.h2"
+#line 7296 "reflect.h2"
             if (upper != lower) {
                 gen_case_insensitive(cpp2::move(lower), cpp2::move(upper), ctx);
             }
@@ -11370,7 +11392,7 @@ size_t i{0};
         }
     }
 
-#line 7293 "reflect.h2"
+#line 7308 "reflect.h2"
     auto char_token::gen_case_insensitive(cpp2::impl::in<std::string> lower, cpp2::impl::in<std::string> upper, generation_context& ctx) const& -> void
     {
         std::string name {"str_" + cpp2::to_string(ctx.gen_temp()) + ""}; 
@@ -11392,7 +11414,7 @@ size_t i{0};
         ctx.add("else { break; }");
     }
 
-#line 7314 "reflect.h2"
+#line 7329 "reflect.h2"
     auto char_token::gen_case_sensitive(generation_context& ctx) const& -> void
     {
         std::string name {"str_" + cpp2::to_string(ctx.gen_temp()) + ""}; 
@@ -11411,7 +11433,7 @@ size_t i{0};
         ctx.add("else { break; }");
     }
 
-#line 7332 "reflect.h2"
+#line 7347 "reflect.h2"
     [[nodiscard]] auto char_token::add_escapes(std::string str) const& -> std::string
     {
         str = string_util::replace_all(str, "\\", "\\\\");
@@ -11427,14 +11449,14 @@ size_t i{0};
         return cpp2::move(str); 
     }
 
-#line 7347 "reflect.h2"
+#line 7362 "reflect.h2"
     [[nodiscard]] auto char_token::reverse() const -> token_ptr{
         std::string reverse_str {token}; 
         std::reverse(reverse_str.begin(), reverse_str.end());
         return CPP2_UFCS_TEMPLATE(cpp2_new<char_token>)(cpp2::shared, cpp2::move(reverse_str), ignore_case); 
     }
 
-#line 7353 "reflect.h2"
+#line 7368 "reflect.h2"
     auto char_token::append(char_token const& that) & -> void{
         (*this).token += that.token;
         (*this).string_rep += that.string_rep;
@@ -11442,19 +11464,19 @@ size_t i{0};
 
     char_token::~char_token() noexcept{}
 
-#line 7370 "reflect.h2"
+#line 7385 "reflect.h2"
     class_token::class_token(cpp2::impl::in<bool> negate_, cpp2::impl::in<bool> case_insensitive_, cpp2::impl::in<std::string> class_str_, cpp2::impl::in<std::string> str)
         : regex_token{ str }
         , negate{ negate_ }
         , case_insensitive{ case_insensitive_ }
         , class_str{ class_str_ }
-#line 7371 "reflect.h2"
+#line 7386 "reflect.h2"
     {
 
-#line 7376 "reflect.h2"
+#line 7391 "reflect.h2"
     }
 
-#line 7379 "reflect.h2"
+#line 7394 "reflect.h2"
     [[nodiscard]] auto class_token::parse(parse_context& ctx) -> token_ptr
     {
         if (ctx.current() != '[') {return nullptr; }
@@ -11580,7 +11602,7 @@ size_t i{0};
             ); 
     }
 
-#line 7504 "reflect.h2"
+#line 7519 "reflect.h2"
     [[nodiscard]] auto class_token::reverse() const -> token_ptr{
         return CPP2_UFCS_TEMPLATE(cpp2_new<class_token>)(cpp2::shared, 
             negate, 
@@ -11590,13 +11612,13 @@ size_t i{0};
             ); 
     }
 
-#line 7513 "reflect.h2"
+#line 7528 "reflect.h2"
     auto class_token::generate_code(generation_context& ctx) const -> void
     {
         ctx.add_check("class_token_matcher<char, " + cpp2::to_string(negate) + ", " + cpp2::to_string(case_insensitive) + ", " + cpp2::to_string(class_str) + ">::match(" + cpp2::to_string(ctx.match_parameters()) + ")");
     }
 
-#line 7518 "reflect.h2"
+#line 7533 "reflect.h2"
     [[nodiscard]] auto class_token::create_matcher(cpp2::impl::in<std::string> name, cpp2::impl::in<std::string> template_arguments) -> std::string
     {
         auto sep {", "}; 
@@ -11607,12 +11629,12 @@ size_t i{0};
 
     class_token::~class_token() noexcept{}
 
-#line 7530 "reflect.h2"
+#line 7545 "reflect.h2"
 [[nodiscard]] auto escape_token_parse(parse_context& ctx) -> token_ptr
 {
     if (ctx.current() != '\\') {return nullptr; }
 
-#line 7535 "reflect.h2"
+#line 7550 "reflect.h2"
     if (std::string::npos == std::string("afenrt^.[]()*{}?+|\\").find(ctx.peek())) {
         return nullptr; 
     }
@@ -11646,7 +11668,7 @@ size_t i{0};
 
 }
 
-#line 7571 "reflect.h2"
+#line 7586 "reflect.h2"
 [[nodiscard]] auto global_group_reset_token_parse(parse_context& ctx) -> token_ptr
 {
     if (!((ctx.current() == '\\' && ctx.peek() == 'K'))) {return nullptr; }
@@ -11655,19 +11677,19 @@ size_t i{0};
     return CPP2_UFCS_TEMPLATE(cpp2_new<regex_token_code>)(cpp2::shared, "\\K", "ctx..set_group_start(0, r.pos);"); 
 }
 
-#line 7594 "reflect.h2"
+#line 7609 "reflect.h2"
     group_ref_token::group_ref_token(cpp2::impl::in<int> id_, cpp2::impl::in<bool> case_insensitive_, cpp2::impl::in<bool> reverse_, cpp2::impl::in<std::string> str)
         : regex_token{ str }
         , id{ id_ }
         , case_insensitive{ case_insensitive_ }
         , reverse_eval{ reverse_ }
-#line 7595 "reflect.h2"
+#line 7610 "reflect.h2"
     {
 
-#line 7600 "reflect.h2"
+#line 7615 "reflect.h2"
     }
 
-#line 7602 "reflect.h2"
+#line 7617 "reflect.h2"
     [[nodiscard]] auto group_ref_token::parse(parse_context& ctx) -> token_ptr
     {
         if (ctx.current() != '\\') {return nullptr; }
@@ -11769,19 +11791,19 @@ size_t i{0};
         return CPP2_UFCS_TEMPLATE(cpp2_new<group_ref_token>)(cpp2::shared, cpp2::move(group_id), ctx.get_modifiers().has(expression_flags::case_insensitive), false, cpp2::move(str)); 
     }
 
-#line 7703 "reflect.h2"
+#line 7718 "reflect.h2"
     [[nodiscard]] auto group_ref_token::reverse() const -> token_ptr{
         return CPP2_UFCS_TEMPLATE(cpp2_new<group_ref_token>)(cpp2::shared, id, case_insensitive, !(reverse_eval), to_string()); 
     }
 
-#line 7707 "reflect.h2"
+#line 7722 "reflect.h2"
     auto group_ref_token::generate_code(generation_context& ctx) const -> void{
         ctx.add_check("group_ref_token_matcher<char, " + cpp2::to_string(id) + ", " + cpp2::to_string(case_insensitive) + ", " + cpp2::to_string(reverse_eval) + ">(" + cpp2::to_string(ctx.match_parameters()) + ")");
     }
 
     group_ref_token::~group_ref_token() noexcept{}
 
-#line 7731 "reflect.h2"
+#line 7746 "reflect.h2"
     [[nodiscard]] auto group_token::parse_lookahead_lookbehind(parse_context& ctx, cpp2::impl::in<std::string> syntax, cpp2::impl::in<bool> lookahead, cpp2::impl::in<bool> positive) -> token_ptr
     {
         static_cast<void>(ctx.next());// Skip last token defining the syntax
@@ -11800,7 +11822,7 @@ size_t i{0};
         return r; 
     }
 
-#line 7749 "reflect.h2"
+#line 7764 "reflect.h2"
     [[nodiscard]] auto group_token::parse_atomic_pattern(parse_context& ctx, cpp2::impl::in<std::string> syntax) -> token_ptr
     {
         static_cast<void>(ctx.next());// Skip last token defining the syntax
@@ -11815,7 +11837,7 @@ size_t i{0};
         return r; 
     }
 
-#line 7763 "reflect.h2"
+#line 7778 "reflect.h2"
     [[nodiscard]] auto group_token::parse(parse_context& ctx) -> token_ptr
     {
         if (ctx.current() != '(') {return nullptr; }
@@ -11975,7 +11997,7 @@ size_t i{0};
         }
     }
 
-#line 7922 "reflect.h2"
+#line 7937 "reflect.h2"
     [[nodiscard]] auto group_token::reverse() const -> token_ptr{
         auto r {CPP2_UFCS_TEMPLATE(cpp2_new<group_token>)(cpp2::shared)}; 
         (*cpp2::impl::assert_not_null(r)).number = number;
@@ -11984,7 +12006,7 @@ size_t i{0};
         return r; 
     }
 
-#line 7930 "reflect.h2"
+#line 7945 "reflect.h2"
     [[nodiscard]] auto group_token::gen_string(cpp2::impl::in<std::string> name, cpp2::impl::in<bool> name_brackets, cpp2::impl::in<bool> has_modifier, cpp2::impl::in<std::string> modifiers, cpp2::impl::in<token_ptr> inner_) -> std::string
     {
         std::string start {"("}; 
@@ -12003,7 +12025,7 @@ size_t i{0};
         return cpp2::move(start) + (*cpp2::impl::assert_not_null(inner_)).to_string() + ")"; 
     }
 
-#line 7948 "reflect.h2"
+#line 7963 "reflect.h2"
     auto group_token::generate_code(generation_context& ctx) const -> void
     {
         if (-1 != number) {
@@ -12035,7 +12057,7 @@ size_t i{0};
         }
     }
 
-#line 7979 "reflect.h2"
+#line 7994 "reflect.h2"
     auto group_token::add_groups(std::set<int>& groups) const -> void
     {
         (*cpp2::impl::assert_not_null(inner)).add_groups(groups);
@@ -12046,7 +12068,7 @@ size_t i{0};
 
     group_token::~group_token() noexcept{}
 
-#line 7991 "reflect.h2"
+#line 8006 "reflect.h2"
 [[nodiscard]] auto hexadecimal_token_parse(parse_context& ctx) -> token_ptr
 {
     if (!((ctx.current() == '\\' && ctx.peek() == 'x'))) {return nullptr; }
@@ -12085,7 +12107,7 @@ size_t i{0};
     return r; 
 }
 
-#line 8032 "reflect.h2"
+#line 8047 "reflect.h2"
 [[nodiscard]] auto line_end_token_parse(parse_context& ctx) -> token_ptr
 {
     if (ctx.current() == '$' || (ctx.current() == '\\' && ctx.peek() == '$')) {
@@ -12103,7 +12125,7 @@ size_t i{0};
     }}
 }
 
-#line 8052 "reflect.h2"
+#line 8067 "reflect.h2"
 [[nodiscard]] auto line_start_token_parse(parse_context& ctx) -> token_ptr
 {
     if (ctx.current() != '^' && !((ctx.current() == '\\' && ctx.peek() == 'A'))) {return nullptr; }
@@ -12117,16 +12139,16 @@ size_t i{0};
     }
 }
 
-#line 8078 "reflect.h2"
+#line 8093 "reflect.h2"
     lookahead_lookbehind_token::lookahead_lookbehind_token(cpp2::impl::in<bool> lookahead_, cpp2::impl::in<bool> positive_)
         : regex_token{ "" }
         , lookahead{ lookahead_ }
         , positive{ positive_ }{
 
-#line 8081 "reflect.h2"
+#line 8096 "reflect.h2"
     }
 
-#line 8083 "reflect.h2"
+#line 8098 "reflect.h2"
     auto lookahead_lookbehind_token::generate_code(generation_context& ctx) const -> void{
         auto inner_name {ctx.generate_func(inner)}; 
 
@@ -12138,7 +12160,7 @@ size_t i{0};
         }
     }
 
-#line 8094 "reflect.h2"
+#line 8109 "reflect.h2"
     [[nodiscard]] auto lookahead_lookbehind_token::reverse() const -> token_ptr{
         auto r {CPP2_UFCS_TEMPLATE(cpp2_new<lookahead_lookbehind_token>)(cpp2::shared, lookahead, positive)}; 
         (*cpp2::impl::assert_not_null(r)).inner = inner;// We do not reverse here. Nested lookahead and lookbehind stay as they are.
@@ -12146,14 +12168,14 @@ size_t i{0};
         return r; 
     }
 
-#line 8101 "reflect.h2"
+#line 8116 "reflect.h2"
     auto lookahead_lookbehind_token::add_groups(std::set<int>& groups) const -> void{
         (*cpp2::impl::assert_not_null(inner)).add_groups(groups);
     }
 
     lookahead_lookbehind_token::~lookahead_lookbehind_token() noexcept{}
 
-#line 8109 "reflect.h2"
+#line 8124 "reflect.h2"
 [[nodiscard]] auto named_class_token_parse(parse_context& ctx) -> token_ptr
 {
     if (ctx.current() != '\\') {return nullptr; }
@@ -12179,7 +12201,7 @@ size_t i{0};
     return CPP2_UFCS_TEMPLATE(cpp2_new<regex_token_check>)(cpp2::shared, "\\" + cpp2::to_string(ctx.current()) + "", "" + cpp2::to_string(cpp2::move(name)) + "<char, " + cpp2::to_string(ctx.get_modifiers().has(expression_flags::case_insensitive)) + ">::match"); 
 }
 
-#line 8137 "reflect.h2"
+#line 8152 "reflect.h2"
 [[nodiscard]] auto octal_token_parse(parse_context& ctx) -> token_ptr
 {
     if (!((ctx.current() == '\\' && ctx.peek() == 'o'))) {return nullptr; }
@@ -12205,11 +12227,11 @@ size_t i{0};
     return r; 
 }
 
-#line 8174 "reflect.h2"
+#line 8189 "reflect.h2"
     range_token::range_token()
                              : regex_token{ "" }{}
 
-#line 8176 "reflect.h2"
+#line 8191 "reflect.h2"
     [[nodiscard]] auto range_token::parse(parse_context& ctx) -> token_ptr
     {
         auto r {CPP2_UFCS_TEMPLATE(cpp2_new<range_token>)(cpp2::shared)}; 
@@ -12283,7 +12305,7 @@ size_t i{0};
         return nullptr; 
     }
 
-#line 8249 "reflect.h2"
+#line 8264 "reflect.h2"
     auto range_token::parse_modifier(parse_context& ctx) & -> void
     {
         if (ctx.peek() == '?') {
@@ -12296,7 +12318,7 @@ size_t i{0};
         }}
     }
 
-#line 8261 "reflect.h2"
+#line 8276 "reflect.h2"
     [[nodiscard]] auto range_token::gen_mod_string() const& -> std::string
     {
         if (kind == range_flags::not_greedy) {
@@ -12310,7 +12332,7 @@ size_t i{0};
         }}
     }
 
-#line 8274 "reflect.h2"
+#line 8289 "reflect.h2"
     [[nodiscard]] auto range_token::gen_range_string() const& -> std::string
     {
         std::string r {""}; 
@@ -12330,7 +12352,7 @@ size_t i{0};
         return r; 
     }
 
-#line 8293 "reflect.h2"
+#line 8308 "reflect.h2"
     [[nodiscard]] auto range_token::reverse() const -> token_ptr{
         auto r {CPP2_UFCS_TEMPLATE(cpp2_new<range_token>)(cpp2::shared)}; 
         (*cpp2::impl::assert_not_null(r)).min_count = min_count;
@@ -12341,7 +12363,7 @@ size_t i{0};
         return r; 
     }
 
-#line 8303 "reflect.h2"
+#line 8318 "reflect.h2"
     auto range_token::generate_code(generation_context& ctx) const -> void
     {
         auto inner_name {ctx.generate_func(inner_token)}; 
@@ -12353,14 +12375,14 @@ size_t i{0};
         ctx.add_statefull(next_name, "cpp2::regex::range_token_matcher<char, " + cpp2::to_string(min_count) + ", " + cpp2::to_string(max_count) + ", " + cpp2::to_string(kind) + ">::match(" + cpp2::to_string(ctx.match_parameters()) + ", " + cpp2::to_string(cpp2::move(inner_name)) + ", " + cpp2::to_string(cpp2::move(reset_name)) + ", other, " + cpp2::to_string(next_name) + ")");
     }
 
-#line 8314 "reflect.h2"
+#line 8329 "reflect.h2"
     auto range_token::add_groups(std::set<int>& groups) const -> void{
         (*cpp2::impl::assert_not_null(inner_token)).add_groups(groups);
     }
 
     range_token::~range_token() noexcept{}
 
-#line 8326 "reflect.h2"
+#line 8341 "reflect.h2"
     [[nodiscard]] auto special_range_token::parse(parse_context& ctx) -> token_ptr
     {
         auto r {CPP2_UFCS_TEMPLATE(cpp2_new<special_range_token>)(cpp2::shared)}; 
@@ -12384,7 +12406,7 @@ size_t i{0};
 
         if (!(ctx.has_token())) {return ctx.error("'" + cpp2::to_string(ctx.current()) + "' without previous element."); }
 
-#line 8350 "reflect.h2"
+#line 8365 "reflect.h2"
         (*cpp2::impl::assert_not_null(r)).parse_modifier(ctx);
 
         (*cpp2::impl::assert_not_null(r)).inner_token = ctx.pop_token();
@@ -12394,7 +12416,7 @@ size_t i{0};
 
     special_range_token::~special_range_token() noexcept{}
 
-#line 8362 "reflect.h2"
+#line 8377 "reflect.h2"
 [[nodiscard]] auto start_match_parse(parse_context& ctx) -> token_ptr
 {
     if (ctx.current() != '\\') {return nullptr; }
@@ -12410,7 +12432,7 @@ size_t i{0};
     }
 }
 
-#line 8382 "reflect.h2"
+#line 8397 "reflect.h2"
 [[nodiscard]] auto word_boundary_token_parse(parse_context& ctx) -> token_ptr
 {
     if (ctx.current() != '\\') {return nullptr; }
@@ -12428,15 +12450,15 @@ size_t i{0};
     }}
 }
 
-#line 8418 "reflect.h2"
+#line 8433 "reflect.h2"
     template <typename Error_out> regex_generator<Error_out>::regex_generator(cpp2::impl::in<std::string_view> r, Error_out const& e)
         : regex{ r }
         , error_out{ e }{
 
-#line 8421 "reflect.h2"
+#line 8436 "reflect.h2"
     }
 
-#line 8423 "reflect.h2"
+#line 8438 "reflect.h2"
     template <typename Error_out> [[nodiscard]] auto regex_generator<Error_out>::parse() & -> std::string
     {
         // Extract modifiers and adapt regex.
@@ -12472,7 +12494,7 @@ size_t i{0};
         return source; 
     }
 
-#line 8458 "reflect.h2"
+#line 8473 "reflect.h2"
     template <typename Error_out> auto regex_generator<Error_out>::extract_modifiers() & -> void
     {
         if (regex.find_first_of("'/") == 0) {
@@ -12488,7 +12510,7 @@ size_t i{0};
         }
     }
 
-#line 8474 "reflect.h2"
+#line 8489 "reflect.h2"
 template<typename Err> [[nodiscard]] auto generate_regex(cpp2::impl::in<std::string_view> regex, Err const& err) -> std::string
 {
     regex_generator<Err> parser {regex, err}; 
@@ -12497,7 +12519,7 @@ template<typename Err> [[nodiscard]] auto generate_regex(cpp2::impl::in<std::str
     return r; 
 }
 
-#line 8484 "reflect.h2"
+#line 8499 "reflect.h2"
 auto regex_gen(meta::type_declaration& t) -> void
 {
     auto has_default {false}; 
@@ -12552,7 +12574,7 @@ auto regex_gen(meta::type_declaration& t) -> void
     CPP2_UFCS(add_runtime_support_include)(t, "cpp2regex.h");
 }
 
-#line 8543 "reflect.h2"
+#line 8558 "reflect.h2"
 [[nodiscard]] auto apply_metafunctions(
     declaration_node& n, 
     type_declaration& rtype, 
@@ -12593,6 +12615,8 @@ auto regex_gen(meta::type_declaration& t) -> void
 
         CPP2_UFCS(set_metafunction_name)(rtype, name, cpp2::move(args));
 
+        auto trace {trace_scope("metafunction", name)}; 
+
         //  Dispatch
         //
         if (name == "interface") {
@@ -12680,7 +12704,7 @@ auto regex_gen(meta::type_declaration& t) -> void
     return true; 
 }
 
-#line 8671 "reflect.h2"
+#line 8688 "reflect.h2"
 }
 
 }
@@ -299,18 +299,14 @@ struct symbol {
 //  of the form "x = expr;" for an uninitialized local variable x,
 //  which we will rewrite to construct the local variable.
 //
-std::vector<token const*> definite_initializations;
+//  Per-compilation state: see reset_compilation_state()
+//
+thread_local std::unordered_set<token const*> definite_initializations;
 
 auto is_definite_initialization(token const* t)
     -> bool
 {
-    return
-        std::find(
-            definite_initializations.begin(),
-            definite_initializations.end(),
-            t
-            )
-        != definite_initializations.end();
+    return definite_initializations.contains(t);
 }
 
 
@@ -335,18 +331,16 @@ struct last_use {
 
     bool operator==(last_use const& that) { return t == that.t; }
 };
-std::vector<last_use> definite_last_uses;
+thread_local std::unordered_map<token const*, last_use> definite_last_uses;    // per-compilation, see reset_compilation_state()
 
 auto is_definite_last_use(token const* t)
     -> last_use const*
 {
-    auto iter = std::find(
-            definite_last_uses.begin(),
-            definite_last_uses.end(),
-            t
-            );
-    if (iter != definite_last_uses.end()) {
-        return &*iter;
+    if (auto iter = definite_last_uses.find(t);
+        iter != definite_last_uses.end()
+        )
+    {
+        return &iter->second;
     }
     else {
         return {};
@@ -372,12 +366,48 @@ public:
     std::vector<declaration_sym          const*> current_declarations;
 
     struct declaration_of_t {
-        declaration_sym const* sym;
-        bool                   in_current_function;
+        token const*           t                   = {};    // null if there is no entry
+        declaration_sym const* sym                 = {};
+        bool                   in_current_function = false;
         bool                   prev_token_was_this = false;
         declaration_sym const* this_param_sym      = {};
     };
-    std::unordered_map< token const*, declaration_of_t > declaration_of;
+    //  Indexed by the token's global order, which start() gives each token
+    //  before recording an entry for it, so lookups don't need to hash
+    std::vector< declaration_of_t > declaration_of;
+
+private:
+    //  A function whose body is parsed on demand (see parser::defer_function_bodies)
+    //  is left out of the visit of the whole parse tree, except for declaring
+    //  it, and visited by itself once its body is parsed, into a symbol table
+    //  of its own that is dropped once the function has been lowered
+    //
+    //  So that names are looked up there as they would have been, each one
+    //  remembers the current_declarations it was deferred with -- as how many
+    //  of the previous one's are still there and then the ones added since,
+    //  because namespace-scope declarations stay there until the namespace ends
+    //
+    struct deferred_function {
+        int                                 kept;
+        std::vector<declaration_sym const*> added;
+        int                                 scope_depth;
+        token const*                        prev_token;
+        token const*                        prev2_token;
+    };
+    std::vector<deferred_function>                   deferred_functions;
+    std::unordered_map<declaration_node const*, int> deferred_function_index;
+    int                                              current_declarations_kept = 0;  // since the last one
+
+    //  The current_declarations of the first deferred_context_count deferred
+    //  functions, replayed up to the last of them
+    std::vector<declaration_sym const*> deferred_context;
+    int                                 deferred_context_count = 0;
+
+    //  The whole TU's symbols while a deferred function is visited
+    stable_vector<symbol> tu_symbols;
+    index_t               tu_global_token_counter = 0;
+
+public:
 
 public:
     //-----------------------------------------------------------------------
@@ -419,9 +449,17 @@ public:
         auto result = static_cast<declaration_sym const*>(nullptr);
 
         {
-            auto d = declaration_of.find(&t);
+            auto order = t.get_global_token_order();
+            auto d     = static_cast<declaration_of_t const*>(nullptr);
+            if (
+                order < std::ssize(declaration_of)
+                && declaration_of[order].t == &t
+                )
+            {
+                d = &declaration_of[order];
+            }
 
-            if (d != declaration_of.cend())
+            if (d)
             {
                 //  If we're asked to include implicit this,
                 //  and t itself is not 'this' and not qualified with 'this.`,
@@ -429,17 +467,17 @@ public:
                 if (
                     include_implicit_this
                     && t != "this"
-                    && !d->second.prev_token_was_this
-                    && d->second.this_param_sym
+                    && !d->prev_token_was_this
+                    && d->this_param_sym
                     )
                 {
-                    result = d->second.this_param_sym;
+                    result = d->this_param_sym;
                 }
                 //  Otherwise just use the main result
                 else
                 {
-                    //assert( d->second.sym && d->second.sym->declaration->has_name(t) );
-                    result = d->second.sym;
+                    //assert( d->sym && d->sym->declaration->has_name(t) );
+                    result = d->sym;
                 }
             }
 
@@ -450,18 +488,18 @@ public:
                 //  If we were told not to look beyond the current function
                 && !look_beyond_current_function
                 //  And we're not already using the 'this' parameter which is local
-                && result != d->second.this_param_sym
+                && result != d->this_param_sym
                 //  And this result isn't our own function-local object declaration
                 && !(
-                    d->second.sym->declaration->identifier->get_token() == &t
-                    && d->second.sym->declaration->is_object()
-                    && d->second.sym->declaration->parent_is_function()
+                    d->sym->declaration->identifier->get_token() == &t
+                    && d->sym->declaration->is_object()
+                    && d->sym->declaration->parent_is_function()
                     )
                 //  And this result is not in the current function
                 //  or we weren't in a function to begin with
                 && (
-                    !d->second.in_current_function
-                    || !d->second.sym->declaration->parent_is_function()
+                    !d->in_current_function
+                    || !d->sym->declaration->parent_is_function()
                     )
                 )
             {
@@ -517,18 +555,22 @@ public:
         -> void
     {
         o << "---------------------------------------------------------------------------\n";
-        o << "declaration_of: size " << declaration_of.size() << "\n";
+        o << "declaration_of: size "
+          << std::ranges::count_if(declaration_of, [](auto const& e) { return e.t != nullptr; }) << "\n";
         o << "   & tok            #tok    & sym            identifier      #tok  in_curr_fn prev_was_this & this_param_sym\n";
 
         for (auto& e : declaration_of) {
-            o   << "   " << static_cast<void const*>(e.first)
-                << " " << std::setw(4) << std::right << e.first->get_global_token_order()
-                << " -> " << static_cast<void const*>(e.second.sym)
-                << " " << std::setw(16) << (e.second.sym && e.second.sym->identifier ? e.second.sym->identifier->as_string_view() : "(null)")
-                << std::setw(4) << std::right << (e.second.sym && e.second.sym->identifier ? e.second.sym->identifier->get_global_token_order() : 0)
-                << "  " << std::setw(10) << std::left << e.second.in_current_function
-                << " " << std::setw(13) << e.second.prev_token_was_this
-                << " " << static_cast<void const*>(e.second.this_param_sym)
+            if (!e.t) {
+                continue;
+            }
+            o   << "   " << static_cast<void const*>(e.t)
+                << " " << std::setw(4) << std::right << e.t->get_global_token_order()
+                << " -> " << static_cast<void const*>(e.sym)
+                << " " << std::setw(16) << (e.sym && e.sym->identifier ? e.sym->identifier->as_string_view() : "(null)")
+                << std::setw(4) << std::right << (e.sym && e.sym->identifier ? e.sym->identifier->get_global_token_order() : 0)
+                << "  " << std::setw(10) << std::left << e.in_current_function
+                << " " << std::setw(13) << e.prev_token_was_this
+                << " " << static_cast<void const*>(e.this_param_sym)
                 << "\n";
         }
 
@@ -667,6 +709,8 @@ public:
     auto apply_local_rules()
         -> bool
     {
+        auto trace = trace_scope("sema::apply_local_rules");
+
         auto ret = true;
 
         //-----------------------------------------------------------------------
@@ -719,6 +763,8 @@ public:
             return {};
         };
 
+        auto const index = symbol_index{symbols};
+
         //-----------------------------------------------------------------------
         //  Function logic: For each entry in the table...
         //
@@ -747,7 +793,8 @@ public:
                     decl->identifier,
                     sympos,
                     decl->parameter ? std::optional{decl->parameter->pass} : std::optional<passing_style>{},
-                    decl->parameter
+                    decl->parameter,
+                    index
                 );
             }
         }
@@ -755,7 +802,229 @@ public:
         return ret;
     }
 
+
+    //-----------------------------------------------------------------------
+    //  Visit a deferred function once its body is parsed, and apply the
+    //  local rules to it, as visiting the whole parse tree would have
+    //
+    //  Its symbols are current until end_deferred_function
+    //
+    auto visit_deferred_function(declaration_node const& n)
+        -> bool
+    {
+        auto iter = deferred_function_index.find(&n);
+        assert(iter != deferred_function_index.end());
+        auto const which = iter->second;
+
+        //  Functions are usually lowered in the order they were deferred
+        //  in, so just replay the ones since the last one
+        if (deferred_context_count > which) {
+            deferred_context.clear();
+            deferred_context_count = 0;
+        }
+        for (; deferred_context_count <= which; ++deferred_context_count) {
+            auto const& f = deferred_functions[deferred_context_count];
+            deferred_context.resize(f.kept);
+            deferred_context.insert( deferred_context.end(), f.added.begin(), f.added.end() );
+        }
+
+        auto const& f = deferred_functions[which];
+        std::swap(symbols, tu_symbols);
+        std::swap(current_declarations, deferred_context);
+        tu_global_token_counter = global_token_counter;
+        scope_depth             = f.scope_depth;
+        prev_token              = f.prev_token;
+        prev2_token             = f.prev2_token;
+
+        auto uses_per_scope        = std::exchange(indices_of_uses_per_scope,        {{}});
+        auto activations_per_scope = std::exchange(indices_of_activations_per_scope, {{}});
+
+        assert(n.deferred_body);
+        n.deferred_body->decl->visit(*this, 0);
+
+        indices_of_uses_per_scope        = std::move(uses_per_scope);
+        indices_of_activations_per_scope = std::move(activations_per_scope);
+
+        assert(
+            current_declarations.back()
+            && current_declarations.back()->declaration == &n
+        );
+        current_declarations.pop_back();
+        std::swap(current_declarations, deferred_context);
+
+        return apply_local_rules();
+    }
+
+    //  Drop the symbols of the deferred function visited last
+    //
+    auto end_deferred_function()
+        -> void
+    {
+        std::swap(symbols, tu_symbols);
+        tu_symbols = {};
+        if (std::ssize(declaration_of) > tu_global_token_counter + 1) {
+            declaration_of.resize(tu_global_token_counter + 1);
+        }
+        global_token_counter = tu_global_token_counter;
+    }
+
 private:
+    //  The positions in the symbol/scope table where each scope ends, and of
+    //  the symbols that can change the course of a scan for a local's last
+    //  uses, so that the scan can jump between those instead of visiting
+    //  every symbol in the local's scope (once for each local)
+    //
+    struct symbol_index
+    {
+        using positions = std::vector<int>;
+
+        positions scope_end;        // for each symbol, the next one at a shallower depth
+        positions scope_changes;    // 'for'/'while'/'do' and function expression starts
+        positions compounds;        // all compound statement symbols
+        positions branches;         // those that are not plain scopes
+        positions true_branches;    // those that are true branches
+        std::unordered_map<index_t, positions> uses;            // by name's atom
+        std::unordered_map<index_t, positions> declarations;    // by name's atom, incl. using-declarations
+
+        symbol_index(stable_vector<symbol> const& symbols)
+        {
+            auto const size = unchecked_narrow<int>(std::ssize(symbols));
+            scope_end.assign(size, size);
+
+            auto open = positions{};
+            for (auto i = 0; i < size; ++i)
+            {
+                while (
+                    !open.empty()
+                    && symbols[open.back()].depth > symbols[i].depth
+                    )
+                {
+                    scope_end[open.back()] = i;
+                    open.pop_back();
+                }
+                open.push_back(i);
+
+                switch (symbols[i].sym.index()) {
+
+                break;case symbol::active::declaration: {
+                    auto const& sym = std::get<symbol::active::declaration>(symbols[i].sym);
+                    if (
+                        sym.start
+                        && sym.declaration->is_function_expression()
+                        )
+                    {
+                        scope_changes.push_back(i);
+                    }
+                    if (
+                        sym.start
+                        && sym.identifier
+                        )
+                    {
+                        declarations[sym.identifier->get_atom()].push_back(i);
+                    }
+                }
+
+                break;case symbol::active::identifier: {
+                    auto const& sym = std::get<symbol::active::identifier>(symbols[i].sym);
+                    if (!sym.identifier) {
+                        break;
+                    }
+                    if (
+                        *sym.identifier == "for"
+                        || *sym.identifier == "while"
+                        || *sym.identifier == "do"
+                        )
+                    {
+                        scope_changes.push_back(i);
+                    }
+                    if (sym.is_use()) {
+                        uses[sym.identifier->get_atom()].push_back(i);
+                    }
+                    else if (sym.is_using_declaration()) {
+                        declarations[sym.identifier->get_atom()].push_back(i);
+                    }
+                }
+
+                break;case symbol::active::compound: {
+                    auto const& sym = std::get<symbol::active::compound>(symbols[i].sym);
+                    compounds.push_back(i);
+                    if (sym.kind_ != compound_sym::is_scope) {
+                        branches.push_back(i);
+                    }
+                    if (sym.kind_ == compound_sym::is_true) {
+                        true_branches.push_back(i);
+                    }
+                }
+
+                break;default:
+                    ;
+                }
+            }
+        }
+
+        static auto find(
+            std::unordered_map<index_t, positions> const& by_name,
+            token const&                                  name
+        )
+            -> positions const*
+        {
+            auto iter = by_name.find(name.get_atom());
+            return iter != by_name.end() ? &iter->second : nullptr;
+        }
+
+        //  The first of ps at or after from and before limit, else limit
+        //  (or from itself if it is already at or past limit)
+        //
+        static auto next(positions const* ps, int from, int limit)
+            -> int
+        {
+            if (from >= limit) {
+                return from;
+            }
+            if (!ps) {
+                return limit;
+            }
+            auto iter = std::lower_bound(ps->begin(), ps->end(), from);
+            return iter != ps->end() ? std::min(*iter, limit) : limit;
+        }
+
+        //  The last of ps at or before from, else -1
+        //
+        static auto prev(positions const* ps, int from)
+            -> int
+        {
+            if (!ps) {
+                return -1;
+            }
+            auto iter = std::upper_bound(ps->begin(), ps->end(), from);
+            return iter != ps->begin() ? *std::prev(iter) : -1;
+        }
+
+        //  The last of ps at or before from and after after whose depth
+        //  is less than depth, else -1
+        //
+        static auto prev_shallower(
+            positions const&             ps,
+            int                          from,
+            int                          after,
+            int                          depth,
+            stable_vector<symbol> const& symbols
+        )
+            -> int
+        {
+            for (
+                auto iter = std::upper_bound(ps.begin(), ps.end(), from);
+                iter != ps.begin() && *--iter > after;
+                )
+            {
+                if (symbols[*iter].depth < depth) {
+                    return *iter;
+                }
+            }
+            return -1;
+        }
+    };
+
     //  Find the definite last uses for local variable *id starting at the
     //  given position and depth in the symbol/scope table
     //
@@ -763,7 +1032,8 @@ private:
         token const*                 id,
         int                          pos,
         std::optional<passing_style> pass,
-        bool                         is_parameter
+        bool                         is_parameter,
+        symbol_index const&          index
     ) const
         -> void
     {
@@ -899,12 +1169,27 @@ private:
             return false;
         };
 
+        //  The forward scans need to visit only the symbols that start a loop or
+        //  function expression or that could hide id, and the backward scan only
+        //  the uses of id (and when in a branch, the true branches)
+        auto const* uses_of_id         = symbol_index::find(index.uses, *id);
+        auto const* declarations_of_id = symbol_index::find(index.declarations, *id);
+
+        auto next_to_visit = [&](int from, int limit) -> int {
+            return std::min(
+                symbol_index::next(&index.scope_changes, from, limit),
+                symbol_index::next(declarations_of_id, from, limit)
+            );
+        };
+
         //  Scan forward to the end of this scope
         auto found_end_of_our_initialization = false;
         for (auto start_depth = symbols[pos].depth;
             i < std::ssize(symbols)
             && symbols[i].depth >= start_depth;
-            ++i
+            i = !is_parameter && !found_end_of_our_initialization
+                ? i + 1
+                : next_to_visit(i + 1, index.scope_end[pos])
             )
         {
             //  While we're here, if this is a non-parameter local, check for
@@ -978,7 +1263,7 @@ private:
                 pos_ranges.emplace_back(true, i);
 
                 //  Scan forward to the end of this loop
-                ++i;
+                i = next_to_visit(i + 1, unchecked_narrow<int>(std::ssize(symbols)));
                 while (
                     i < std::ssize(symbols)
                     && (
@@ -995,7 +1280,7 @@ private:
                     {
                         continue;
                     }
-                    ++i;
+                    i = next_to_visit(i + 1, unchecked_narrow<int>(std::ssize(symbols)));
                 }
                 assert(sym && sym->identifier == loop_id && sym->is_deactivation());
                 pos_ranges.back().last = i;
@@ -1007,6 +1292,20 @@ private:
         --i;
         //bool found = false;
         auto branch_depth = 0;
+
+        auto prev_to_visit = [&](int from) -> int {
+            //  For 'this', any name can be a use via implicit 'this.'
+            if (*id == "this") {
+                return from;
+            }
+            auto ret = symbol_index::prev(uses_of_id, from);
+            if (branch_depth != 0) {
+                ret = std::max(ret, symbol_index::prev(&index.true_branches, from));
+            }
+            return std::max(ret, pos);
+        };
+
+        i = prev_to_visit(i);
         while (i > pos)
         {
             //  Drop skipped ranges
@@ -1032,16 +1331,8 @@ private:
                 && branch_depth + 1 == symbols[i].depth
                 )
             {
-                while (
-                    i > pos
-                    && (
-                        !(comp = std::get_if<symbol::active::compound>(&symbols[i].sym))
-                        || branch_depth <= symbols[i].depth
-                        )
-                    )
-                {
-                    --i;
-                }
+                i    = std::max(symbol_index::prev_shallower(index.compounds, i, pos, branch_depth, symbols), pos);
+                comp = std::get_if<symbol::active::compound>(&symbols[i].sym);
 
                 //  If found in a branch,
                 //  keep popping to its sibling (false branch)
@@ -1068,7 +1359,7 @@ private:
 
             if (!is_a_use(sym))
             {
-                --i;
+                i = prev_to_visit(i - 1);
                 continue;
             }
 
@@ -1082,7 +1373,8 @@ private:
             }
             else
             {
-                definite_last_uses.emplace_back(
+                definite_last_uses.try_emplace(
+                    sym->identifier,
                     sym->identifier,
                     pass == passing_style::forward,
                     sym->safe_to_move
@@ -1096,20 +1388,9 @@ private:
             }
             //found = true;
 
-            compound_sym const* comp = nullptr;
-
             //  Pop out of any containing scope of the last use
-            for (auto found_depth = symbols[i--].depth;
-                i > pos
-                && (
-                    !(comp = std::get_if<symbol::active::compound>(&symbols[i].sym))
-                    || comp->kind_ == compound_sym::is_scope
-                    || found_depth <= symbols[i].depth
-                    );
-                --i
-                )
-            {
-            }
+            i = std::max(symbol_index::prev_shallower(index.branches, i - 1, pos, symbols[i].depth, symbols), pos);
+            auto comp = i > pos ? std::get_if<symbol::active::compound>(&symbols[i].sym) : nullptr;
             assert(!comp || symbols[i].start);
 
             //  If found in a branch, record its depth
@@ -1198,7 +1479,7 @@ private:
                     );
                     return false;
                 }
-                definite_initializations.push_back(t);
+                definite_initializations.insert(t);
                 return true;
             };
 
@@ -1457,7 +1738,11 @@ public:
     //  Per-node sema rules
     //
 
-    auto check(qualified_id_node const& n)
+    auto check(
+        qualified_id_node const& n,
+        bool                     emit_errors = true
+    )
+        -> bool
     {
         //  Check for some incorrect uses of .
         if (auto decl = get_declaration_of(n.get_first_token(), true);
@@ -1472,10 +1757,12 @@ public:
                 && n.ids[1].scope_op->type() == lexeme::Scope
                 )
             {
-                errors.emplace_back(
-                    n.position(),
-                    "use '" + decl->identifier->to_string() + ".' to refer to an object member"
-                );
+                if (emit_errors) {
+                    errors.emplace_back(
+                        n.position(),
+                        "use '" + decl->identifier->to_string() + ".' to refer to an object member"
+                    );
+                }
                 return false;
             }
         }
@@ -1484,7 +1771,11 @@ public:
     }
 
 
-    auto check(postfix_expression_node const& n)
+    auto check(
+        postfix_expression_node const& n,
+        bool                           emit_errors = true
+    )
+        -> bool
     {
         //  Check for some incorrect uses of :: or .
         if (auto decl = get_declaration_of(n.get_first_token_ignoring_this(), true);
@@ -1499,10 +1790,12 @@ public:
                 && (n.ops[0].op->type() == lexeme::Dot || n.ops[0].op->type() == lexeme::DotDot)
                 )
             {
-                errors.emplace_back(
-                    n.position(),
-                    "use '" + decl->identifier->to_string() + "::' to refer to a type member"
-                );
+                if (emit_errors) {
+                    errors.emplace_back(
+                        n.position(),
+                        "use '" + decl->identifier->to_string() + "::' to refer to a type member"
+                    );
+                }
                 return false;
             }
         }
@@ -1512,10 +1805,12 @@ public:
             && n.starts_with_function_call_with_n_parameters(1)
             )
         {
-            errors.emplace_back(
-                n.position(),
-                "std::move(one_argument) is not needed in Cpp2 - use 'move' parameters/arguments instead"
-            );
+            if (emit_errors) {
+                errors.emplace_back(
+                    n.position(),
+                    "std::move(one_argument) is not needed in Cpp2 - use 'move' parameters/arguments instead"
+                );
+            }
             return false;
         }
 
@@ -1523,7 +1818,10 @@ public:
     }
 
 
-    auto check(parameter_declaration_node const& n)
+    auto check(
+        parameter_declaration_node const& n,
+        bool                              emit_errors = true
+    )
         -> bool
     {
         assert(n.declaration);
@@ -1545,10 +1843,12 @@ public:
             && type_name == *n.declaration->parent_declaration->parent_declaration->name()
             )
         {
-            errors.emplace_back(
-                n.position(),
-                "if an 'operator=' second parameter is of the same type (here '" + type_name + "'), it must be named 'that'"
-            );
+            if (emit_errors) {
+                errors.emplace_back(
+                    n.position(),
+                    "if an 'operator=' second parameter is of the same type (here '" + type_name + "'), it must be named 'that'"
+                );
+            }
             return false;
         }
 
@@ -1800,7 +2100,7 @@ public:
             && !n.parent_is_namespace()
             )
         {
-            errors.emplace_back(
+            handle_error(
                 n.position(),
                 "an export declaration is only allowed at namespace scope"
             );
@@ -2089,7 +2389,10 @@ public:
     }
 
 
-    auto check(function_type_node const& n)
+    auto check(
+        function_type_node const& n,
+        bool                      emit_errors = true
+    )
         -> bool
     {
         assert(n.parameters);
@@ -2103,18 +2406,22 @@ public:
                 || (*n.parameters)[0]->direction() != passing_style::inout
                 )
             {
-                errors.emplace_back(
-                    n.position(),
-                    "a user-defined " + n.my_decl->name()->to_string() + " must have a single 'inout' parameter"
-                );
+                if (emit_errors) {
+                    errors.emplace_back(
+                        n.position(),
+                        "a user-defined " + n.my_decl->name()->to_string() + " must have a single 'inout' parameter"
+                    );
+                }
                 return false;
             }
 
             if (n.has_deduced_return_type()) {
-                errors.emplace_back(
-                    n.position(),
-                    "a user-defined " + n.my_decl->name()->to_string() + " must have a specific (not deduced) return type"
-                );
+                if (emit_errors) {
+                    errors.emplace_back(
+                        n.position(),
+                        "a user-defined " + n.my_decl->name()->to_string() + " must have a specific (not deduced) return type"
+                    );
+                }
                 return false;
             }
         }
@@ -2127,10 +2434,12 @@ public:
             && (*n.parameters)[0]->direction() == passing_style::out
             )
         {
-            errors.emplace_back(
-                n.position(),
-                "a function with an 'out this' parameter must be a constructor"
-            );
+            if (emit_errors) {
+                errors.emplace_back(
+                    n.position(),
+                    "a function with an 'out this' parameter must be a constructor"
+                );
+            }
             return false;
         }
 
@@ -2138,7 +2447,10 @@ public:
     }
 
 
-    auto check(statement_node const& n)
+    auto check(
+        statement_node const& n,
+        bool                  emit_errors = true
+    )
         -> bool
     {
         if (auto expr_stmt = n.get_if<expression_statement_node>();
@@ -2151,10 +2463,12 @@ public:
                 )
             )
         {
-            errors.emplace_back(
-                n.position(),
-                "unused literal or identifier"
-            );
+            if (emit_errors) {
+                errors.emplace_back(
+                    n.position(),
+                    "unused literal or identifier"
+                );
+            }
             return false;
         }
 
@@ -2208,27 +2522,69 @@ public:
     }
 
     //  Mark uses that are not safe to move
+    //
+    //  Two uses of the same name in an expression are not safe to move if
+    //  they are in different safe_to_move_contexts and neither is captured
     auto pop_uses_in_expression() -> void
     {
         auto identifier = [](symbol& s) { return &std::get<symbol::active::identifier>(s.sym); };
 
         auto range = get(uses_in_expression);
-        for (auto i : range)
+
+        //  Most expressions have only a few uses, so just compare each pair
+        if (std::ssize(range) <= 8)
         {
-            auto x = identifier(symbols[i]);
-            for (auto j : range)
+            for (auto i : range)
             {
-                auto y = identifier(symbols[j]);
+                auto x = identifier(symbols[i]);
+                for (auto j : range)
+                {
+                    auto y = identifier(symbols[j]);
+                    if (
+                        i != j
+                        && *x->identifier == *y->identifier
+                        && x->safe_to_move_context != y->safe_to_move_context
+                        && !x->is_captured
+                        && !y->is_captured
+                        )
+                    {
+                        x->safe_to_move = false;
+                        y->safe_to_move = false;
+                    }
+                }
+            }
+        }
+
+        //  Otherwise group them by name, so that long expressions (e.g.,
+        //  generated polynomials) don't take quadratic time: every uncaptured
+        //  use of a name is unsafe to move iff those uses are not all in
+        //  the same context
+        else
+        {
+            struct contexts {
+                int  first;
+                bool mixed = false;
+            };
+            auto by_name = std::unordered_map<std::string_view, contexts>{};
+
+            for (auto i : range) {
+                auto x = identifier(symbols[i]);
+                if (!x->is_captured) {
+                    auto it = by_name.try_emplace(*x->identifier, contexts{x->safe_to_move_context}).first;
+                    if (it->second.first != x->safe_to_move_context) {
+                        it->second.mixed = true;
+                    }
+                }
+            }
+
+            for (auto i : range) {
+                auto x = identifier(symbols[i]);
                 if (
-                    i != j
-                    && *x->identifier == *y->identifier
-                    && x->safe_to_move_context != y->safe_to_move_context
-                    && !x->is_captured
-                    && !y->is_captured
+                    !x->is_captured
+                    && by_name.find(*x->identifier)->second.mixed
                     )
                 {
                     x->safe_to_move = false;
-                    y->safe_to_move = false;
                 }
             }
         }
@@ -2306,6 +2662,7 @@ public:
             assert(current_declarations.back() == nullptr); // we're popping a lifetime scope
             current_declarations.pop_back();
         }
+        current_declarations_kept = std::min(current_declarations_kept, unchecked_narrow<int>(std::ssize(current_declarations)));
 
         indices_of_uses_per_scope.pop_back();
         indices_of_activations_per_scope.pop_back();
@@ -2520,6 +2877,7 @@ public:
                 current_declarations.back()
                 && current_declarations.back()->declaration == &n   // we're popping the corresponding declaration
             );
+            current_declarations_kept = std::min(current_declarations_kept, unchecked_narrow<int>(std::ssize(current_declarations)));
 
             if (!n.is_object()) {
                 --scope_depth;
@@ -2527,6 +2885,26 @@ public:
         }
     }
 
+    auto start(deferred_body_tag const& n, int) -> void
+    {
+        assert(n.n);
+
+        deferred_function_index.emplace( n.n, unchecked_narrow<int>(std::ssize(deferred_functions)) );
+        deferred_functions.push_back({
+            current_declarations_kept,
+            { current_declarations.begin() + current_declarations_kept, current_declarations.end() },
+            scope_depth,
+            prev_token,
+            prev2_token
+        });
+        current_declarations_kept = unchecked_narrow<int>(std::ssize(current_declarations));
+
+        //  Declare the function as visiting all of it would
+        start(*n.n, 0);
+        symbols.emplace_back( scope_depth, declaration_sym( false, n.n, nullptr, nullptr, nullptr, false, false ) );
+        --scope_depth;
+    }
+
     auto is_binary_operator(lexeme l) -> bool {
         switch (l) {
         break;case lexeme::PlusPlus:
@@ -2666,21 +3044,31 @@ public:
             }
         }
 
+        auto record_declaration_of = [&](declaration_of_t const& entry) {
+            auto order = t.get_global_token_order();
+            if (order >= std::ssize(declaration_of)) {
+                declaration_of.resize(order + 1);
+            }
+            declaration_of[order] = entry;
+        };
+
         if (i != current_declarations.rend()) {
-            declaration_of[&t] = {
+            record_declaration_of({
+                &t,
                 *i,
                 in_current_function && (*i)->declaration->parent_is_function(),
                 prev_token_was_this,
                 found_this
-            };
+            });
         }
         else if (found_this) {
-            declaration_of[&t] = {
+            record_declaration_of({
+                &t,
                 nullptr,
                 false,
                 prev_token_was_this,
                 found_this
-            };
+            });
         }
 
 
@@ -14,7 +14,12 @@
 #define CPP2_TO_CPP1_H
 
 #include "sema.h"
+#include <atomic>
 #include <filesystem>
+#include <functional>
+#include <latch>
+#include <mutex>
+#include <thread>
 
 namespace cpp2 {
 
@@ -37,6 +42,30 @@ auto pad(int padding)
     };
 }
 
+auto json_quoted(std::string_view s)
+    -> std::string
+{
+    auto ret = std::string{"\""};
+    for (auto c : s) {
+        switch (c) {
+        break;case '"' : ret += "\\\"";
+        break;case '\\': ret += "\\\\";
+        break;case '\n': ret += "\\n";
+        break;case '\t': ret += "\\t";
+        break;default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                ret += buf;
+            }
+            else {
+                ret += c;
+            }
+        }
+    }
+    return ret + "\"";
+}
+
 auto multi_return_type_name(declaration_node const& n)
     -> std::string
 {
@@ -94,6 +123,14 @@ static cmdline_processor::register_flag cmd_line_paths(
     [] { flag_line_paths = true; }
 );
 
+static auto flag_source_map = false;
+static cmdline_processor::register_flag cmd_source_map(
+    8,
+    "source-map",
+    "Emit compact Cpp1 without #line directives, and a source map to output.map",
+    []{ flag_source_map = true; }
+);
+
 static auto flag_import_cpp2_util = false;
 static cmdline_processor::register_flag cmd_import_cpp2_util(
     9,
@@ -192,29 +229,430 @@ static cmdline_processor::register_flag cmd_no_rtti(
     []{ flag_no_rtti = true; }
 );
 
-struct text_with_pos{
-    std::string     text;
-    source_position pos;
-    text_with_pos(std::string const& t, source_position p) : text{t}, pos{p} { }
+//-----------------------------------------------------------------------
+//  write_file_if_changed: Write contents to filename, unless the file
+//  already holds exactly those contents
+//
+//  Leaving an up-to-date file untouched keeps its timestamp, so build
+//  systems don't rebuild everything that depends on it
+//
+//  Returns:    false if the file could not be written
+//
+auto write_file_if_changed(
+    std::string const& filename,
+    std::string const& contents
+)
+    -> bool
+{
+    //  Text mode reads can only shrink the on-disk size (CRLF -> LF), so a
+    //  file smaller than contents can't match and needn't be read at all
+    auto ec   = std::error_code{};
+    auto size = std::filesystem::file_size(filename, ec);
+    if (!ec && size >= contents.size()) {
+        if (auto existing = std::ifstream{filename}) {
+            auto old = std::string(size, '\0');
+            existing.read(old.data(), std::ssize(old));
+            old.resize(unchecked_narrow<std::size_t>(existing.gcount()));
+            if (old == contents) {
+                return true;
+            }
+        }
+    }
+    auto file = std::ofstream{filename};
+    file.write(contents.data(), std::ssize(contents));
+    file.close();
+    return !file.fail();
+}
+
+
+//-----------------------------------------------------------------------
+//  text_chunks: A sequence of text fragments, each with its source position
+//
+//  The fragments' text is stored back to back in one buffer, so appending
+//  n fragments is linear and doesn't allocate once per fragment
+//
+class text_chunks
+{
+    struct chunk {
+        std::size_t     offset;
+        std::size_t     length;
+        source_position pos;
+    };
+    std::string        text   = {};
+    std::vector<chunk> chunks = {};
+
+public:
+    struct fragment {
+        std::string_view text;
+        source_position  pos;
+    };
+
+    auto empty() const -> bool        { return chunks.empty(); }
+    auto size()  const -> std::size_t { return chunks.size(); }
+
+    auto operator[](std::size_t i) const
+        -> fragment
+    {
+        assert(i < chunks.size());
+        return { std::string_view{text}.substr(chunks[i].offset, chunks[i].length), chunks[i].pos };
+    }
+
+    auto back() const
+        -> fragment
+    {
+        assert(!empty());
+        return (*this)[chunks.size()-1];
+    }
+
+    auto emplace_back(std::string_view s, source_position pos)
+        -> void
+    {
+        chunks.push_back({ text.size(), s.size(), pos });
+        text += s;
+    }
+
+    //  Append all of other's fragments, last one first
+    auto append_reversed(text_chunks const& other)
+        -> void
+    {
+        for (auto i = other.chunks.rbegin(); i != other.chunks.rend(); ++i) {
+            emplace_back(std::string_view{other.text}.substr(i->offset, i->length), i->pos);
+        }
+    }
+
+    auto pop_back()
+        -> void
+    {
+        assert(!empty());
+        text.resize(chunks.back().offset);
+        chunks.pop_back();
+    }
 };
 
-class positional_printer
+//-----------------------------------------------------------------------
+//  source_map: Where the text of a generated Cpp1 file came from
+//
+//  With -source-map, each Cpp1 output file 'x' gets no #line directives
+//  or column padding, and instead has its source map written to 'x.map':
+//
+//      {
+//      "version": 1,
+//      "file": "x.cpp",
+//      "source": "x.cpp2",
+//      "mappings": [
+//      [7,1,3,1],
+//      ...
+//      ]
+//      }
+//
+//  Each mapping is [generated line, generated column, source line, source
+//  column], in generated order. A generated position maps through the last
+//  mapping at or before it: on the same line, keeping the column offset;
+//  on a later line (e.g., generated code), to the start of its source line
+//
+class source_map
 {
 public:
-    positional_printer()                          = default;
-private:
-    positional_printer(positional_printer const&) = delete;
-    void operator=(positional_printer const&)     = delete;
+    struct mapping {
+        lineno_t generated_line;
+        colno_t  generated_col;
+        lineno_t source_line;
+        colno_t  source_col;
+    };
 
-    //  Core information
-    std::ofstream               out_file        = {}; // Cpp1 syntax output file
-    std::ostream*               out             = {}; // will point to out_file or cout
-    std::string                 cpp2_filename   = {};
-    std::string                 cpp1_filename   = {};
-    std::vector<comment> const* pcomments       = {}; // Cpp2 comments data
-    source const*               psource         = {};
-    parser const*               pparser         = {};
+    std::string          file     = {};
+    std::string          source   = {};
+    std::vector<mapping> mappings = {};
+
+    //  Add a mapping, unless the previous one already implies it or is
+    //  for the same source position (more text lowered from the same node)
+    auto add(mapping m)
+        -> void
+    {
+        if (!mappings.empty())
+        {
+            auto const& last = mappings.back();
+            if (
+                last.generated_line == m.generated_line
+                && last.source_line == m.source_line
+                && (
+                    last.source_col == m.source_col
+                    || last.source_col - last.generated_col == m.source_col - m.generated_col
+                    )
+                )
+            {
+                return;
+            }
+        }
+        mappings.push_back(m);
+    }
+
+    auto to_json() const
+        -> std::string
+    {
+        auto ret = "{\n\"version\": 1,\n\"file\": " + json_quoted(file)
+            + ",\n\"source\": " + json_quoted(source)
+            + ",\n\"mappings\": [";
+        auto sep = "\n";
+        for (auto const& m : mappings) {
+            ret += sep;
+            ret += "[" + std::to_string(m.generated_line) + "," + std::to_string(m.generated_col)
+                + "," + std::to_string(m.source_line) + "," + std::to_string(m.source_col) + "]";
+            sep = ",\n";
+        }
+        return ret + "\n]\n}\n";
+    }
+
+    //  Read the decimal number at text[pos], and move pos past its digits
+    //
+    //  Returns:    the number, or nothing if it is too big to be a line
+    //              or column number
+    //
+    static auto read_number(std::string_view text, std::size_t& pos)
+        -> std::optional<lineno_t>
+    {
+        static_assert(std::is_same_v<lineno_t, colno_t>);
+        auto n = std::optional<lineno_t>{0};
+        for (; pos < text.size() && is_digit(text[pos]); ++pos) {
+            auto digit = text[pos] - '0';
+            if (
+                n
+                && *n <= (std::numeric_limits<lineno_t>::max() - digit) / 10
+                )
+            {
+                *n = *n*10 + digit;
+            }
+            else {
+                n = {};
+            }
+        }
+        return n;
+    }
+
+    //  Read a map written by to_json
+    //
+    //  Returns:    the map, or nothing if text isn't one
+    //
+    static auto from_json(std::string_view text)
+        -> std::optional<source_map>
+    {
+        //  Read the string value of "key"
+        auto string_value = [&](std::string_view key) -> std::optional<std::string>
+        {
+            auto pos = text.find("\"" + std::string{key} + "\":");
+            if (pos == text.npos) {
+                return {};
+            }
+            pos = text.find('"', pos + key.size() + 3);
+            if (pos == text.npos) {
+                return {};
+            }
+            auto ret = std::string{};
+            for (++pos; pos < text.size() && text[pos] != '"'; ++pos) {
+                if (
+                    text[pos] == '\\'
+                    && pos+1 < text.size()
+                    )
+                {
+                    switch (text[++pos]) {
+                    break;case 'n': ret += '\n';
+                    break;case 't': ret += '\t';
+                    break;case 'u':
+                        if (pos+4 < text.size()) {
+                            ret += static_cast<char>(std::strtol(std::string{text.substr(pos+1, 4)}.c_str(), nullptr, 16));
+                            pos += 4;
+                        }
+                    break;default : ret += text[pos];
+                    }
+                }
+                else {
+                    ret += text[pos];
+                }
+            }
+            if (pos >= text.size()) {
+                return {};
+            }
+            return ret;
+        };
+
+        auto ret = source_map{};
+        auto file   = string_value("file");
+        auto source = string_value("source");
+        auto pos    = text.find("\"mappings\":");
+        if (
+            !file
+            || !source
+            || pos == text.npos
+            )
+        {
+            return {};
+        }
+        ret.file   = std::move(*file);
+        ret.source = std::move(*source);
+
+        //  The mappings are the numbers up to the end of the outer array
+        auto numbers = std::vector<int>{};
+        auto depth   = 0;
+        for (pos = text.find('[', pos); pos < text.size(); ++pos)
+        {
+            if (text[pos] == '[') {
+                ++depth;
+            }
+            else if (text[pos] == ']') {
+                if (--depth == 0) {
+                    break;
+                }
+            }
+            else if (is_digit(text[pos])) {
+                auto n = read_number(text, pos);
+                if (!n) {
+                    return {};
+                }
+                numbers.push_back(*n);
+                --pos;
+            }
+        }
+        if (
+            depth != 0
+            || numbers.size() % 4 != 0
+            )
+        {
+            return {};
+        }
+        for (auto i = std::size_t{0}; i < numbers.size(); i += 4) {
+            ret.mappings.push_back({ numbers[i], numbers[i+1], numbers[i+2], numbers[i+3] });
+        }
+        return ret;
+    }
+
+    //  Map a generated position back to its source position
+    //
+    //  Returns:    the source position, or nothing if pos is before all
+    //              the mapped lines or maps to a column past colno_t
+    //
+    auto lookup(source_position pos) const
+        -> std::optional<source_position>
+    {
+        auto m = std::upper_bound(
+            mappings.begin(),
+            mappings.end(),
+            pos,
+            [](source_position const& p, mapping const& m) {
+                return p < source_position{ m.generated_line, m.generated_col };
+            }
+        );
 
+        //  Before the line's first mapping, use that one
+        if (
+            m != mappings.end()
+            && m->generated_line == pos.lineno
+            && (m == mappings.begin() || std::prev(m)->generated_line != pos.lineno)
+            )
+        {
+            return source_position{ m->source_line, m->source_col };
+        }
+
+        if (m == mappings.begin()) {
+            return {};
+        }
+        --m;
+        if (m->generated_line == pos.lineno) {
+            auto col = std::max(1LL, 0LL + m->source_col + pos.colno - m->generated_col);
+            if (col > std::numeric_limits<colno_t>::max()) {
+                return {};
+            }
+            return source_position{ m->source_line, static_cast<colno_t>(col) };
+        }
+        return source_position{ m->source_line, 1 };
+    }
+};
+
+//-----------------------------------------------------------------------
+//  printer_recording: The printing requests made to a positional_printer,
+//  recorded instead of printed so that they can be replayed later
+//
+//  Lowering only ever asks the printer for its phase (and for captured
+//  text, which is still captured while recording), so replaying the
+//  requests in order prints exactly what printing them directly would
+//
+class printer_recording
+{
+public:
+    enum class request : u8 {
+        print_cpp2,
+        print_extra,
+        print_cpp1,
+        reset_line_to,
+        preempt_position_push,
+        preempt_position_pop,
+        add_pad_in_this_line,
+        disable_indent_heuristic_for_next_text,
+        ignore_alignment,
+        captured_print,     // text was captured; flag: by print_extra
+        splice              // replay spliced recording number 'value' here
+    };
+
+    //  The request and its arguments
+    struct entry {
+        request         req;
+        bool            flag   = false;
+        bool            flag2  = false;
+        int             value  = 0;
+        source_position pos    = {};
+        std::size_t     offset = 0;
+        std::size_t     length = 0;
+    };
+
+    std::string        text       = {};     // the requests' text, back to back
+    std::vector<entry> entries    = {};
+    bool               replayable = true;   // false if a request needed the printer's position
+
+    auto add(
+        request          req,
+        std::string_view s     = {},
+        source_position  pos   = {},
+        bool             flag  = false,
+        bool             flag2 = false,
+        int              value = 0
+    )
+        -> void
+    {
+        entries.push_back({ req, flag, flag2, value, pos, text.size(), s.size() });
+        text += s;
+    }
+
+    //  Consecutive captured prints have the same effect as one
+    auto add_captured_print(bool by_print_extra = false)
+        -> void
+    {
+        if (
+            entries.empty()
+            || entries.back().req != request::captured_print
+            )
+        {
+            add(request::captured_print);
+        }
+        entries.back().flag = entries.back().flag || by_print_extra;
+    }
+
+    auto text_of(entry const& e) const
+        -> std::string_view
+    {
+        return std::string_view{text}.substr(e.offset, e.length);
+    }
+};
+
+//-----------------------------------------------------------------------
+//  printer_position: Where a positional_printer is in its output, and the
+//  state it carries from each printed item to the next
+//
+//  Each phase's output is printed to its own section, which starts in the
+//  state the previous phase's section ends in. To print a section before the
+//  previous one is done, the printer starts it from a guess, and notes which
+//  of the carried state it used before setting it, to check the guess later.
+//
+struct printer_position
+{
     source_position curr_pos                    = {}; // current (line,col) in output
     lineno_t        generated_pos_line          = {}; // current line in generated output
     int             last_line_indentation       = {};
@@ -230,10 +668,29 @@ private:
         colno_t offset;
 
         req_act_info(colno_t r, colno_t o) : requested{r}, offset{o} { }
+        auto operator==(req_act_info const&) const -> bool = default;
     };
-    struct {
+    struct line_info {
         lineno_t line = {};
         std::vector<req_act_info> requests = {};
+
+        //  The offset of the request for colno, if there was one
+        auto offset_of(colno_t colno) const
+            -> colno_t
+        {
+            for(auto i = 0;
+                i < std::ssize(requests)
+                    && requests[i].requested <= colno;
+                ++i
+                )
+            {
+                if (requests[i].requested == colno)
+                {
+                    return requests[i].offset;
+                }
+            }
+            return 0;
+        }
     } prev_line_info = {};
 
     //  Position override information
@@ -244,6 +701,184 @@ private:
     lineno_t        ignore_align_lineno = 0;
     bool            enable_indent_heuristic = true;
 
+    //  The state above that's carried over from one section to the next
+    //  (the rest is the same at the start of every section)
+    enum carried : u16 {
+        carried_generated_line   = 1 << 0,  // generated_pos_line
+        carried_line_indentation = 1 << 1,  // last_line_indentation
+        carried_last_was_empty   = 1 << 2,
+        carried_empty_lines      = 1 << 3,  // empty_lines_suppressed
+        carried_line_directive   = 1 << 4,  // just_printed_line_directive
+        carried_printed_extra    = 1 << 5,
+        carried_last_char        = 1 << 6,  // last_printed_char
+        carried_prev_line        = 1 << 7,  // prev_line_info
+        carried_pad              = 1 << 8,  // pad_for_this_line
+        carried_indent_heuristic = 1 << 9,  // enable_indent_heuristic
+        carried_all              = (1 << 10) - 1
+    };
+    u16 carried_set  = 0;   // the carried state this section has set
+    u16 carried_used = 0;   // the carried state it used before setting it
+
+    auto uses(u16 state) -> void { carried_used |= state & ~carried_set; }
+    auto sets(u16 state) -> void { carried_set  |= state;                }
+
+    //  Whether a section that started here and used the 'used' carried
+    //  state would have printed the same if it started at 'that' instead
+    //
+    auto prints_like(
+        printer_position const& that,
+        u16                     used
+    ) const
+        -> bool
+    {
+        auto same = [&](u16 state, bool same_value) {
+            return same_value || !(used & state);
+        };
+        return
+            curr_pos == that.curr_pos
+            && next_comment == that.next_comment
+            && preempt_pos == that.preempt_pos
+            && ignore_align == that.ignore_align
+            && ignore_align_indent == that.ignore_align_indent
+            && same(carried_generated_line,   generated_pos_line == that.generated_pos_line)
+            && same(carried_line_indentation, last_line_indentation == that.last_line_indentation)
+            && same(carried_last_was_empty,   last_was_empty == that.last_was_empty)
+            && same(carried_line_directive,   just_printed_line_directive == that.just_printed_line_directive)
+            && same(carried_printed_extra,    printed_extra == that.printed_extra)
+            && same(carried_pad,              pad_for_this_line == that.pad_for_this_line)
+            && same(carried_indent_heuristic, enable_indent_heuristic == that.enable_indent_heuristic)
+            //  (prev_line_info is checked by what's looked up in it, see printer_section)
+            //  For these, only this is ever looked at
+            && same(carried_empty_lines,      (empty_lines_suppressed > 0) == (that.empty_lines_suppressed > 0))
+            && same(carried_last_char,        (last_printed_char == ';') == (that.last_printed_char == ';'))
+            ;
+    }
+
+    //  Whether continuing from here prints the same as from 'that', once
+    //  all the carried state is set
+    //
+    auto continues_like(printer_position const& that) const
+        -> bool
+    {
+        return
+            prints_like(that, carried_all)
+            && prev_line_info.requests == that.prev_line_info.requests  // (its line is never looked at)
+            && ignore_align_lineno == that.ignore_align_lineno
+            ;
+    }
+
+    //  Carry over the state this section neither used nor set from
+    //  where it really started
+    //
+    auto carry_over_from(printer_position const& start)
+        -> void
+    {
+        auto const kept = carried_set | carried_used;
+        auto carry = [&](u16 state, auto& field, auto const& start_field) {
+            if (!(kept & state)) {
+                field = start_field;
+            }
+        };
+        carry(carried_generated_line,   generated_pos_line,          start.generated_pos_line);
+        carry(carried_line_indentation, last_line_indentation,       start.last_line_indentation);
+        carry(carried_last_was_empty,   last_was_empty,              start.last_was_empty);
+        carry(carried_empty_lines,      empty_lines_suppressed,      start.empty_lines_suppressed);
+        carry(carried_line_directive,   just_printed_line_directive, start.just_printed_line_directive);
+        carry(carried_printed_extra,    printed_extra,               start.printed_extra);
+        carry(carried_last_char,        last_printed_char,           start.last_printed_char);
+        carry(carried_pad,              pad_for_this_line,           start.pad_for_this_line);
+        carry(carried_indent_heuristic, enable_indent_heuristic,     start.enable_indent_heuristic);
+    }
+};
+
+//-----------------------------------------------------------------------
+//  printer_section: The output printed for one phase, and where it's at
+//
+struct printer_section : printer_position
+{
+    std::string                      out_buffer        = {}; // Cpp1 syntax output
+    std::vector<source_map::mapping> mappings          = {}; // with -source-map, before close() drops redundant ones
+    std::size_t                      map_scanned       = 0;  // how much of out_buffer the generated position counts
+    source_position                  map_generated_pos = {}; // the generated position at map_scanned
+    printer_position                 started_at        = {}; // the guess it started printing from, if any
+
+    //  If the indent heuristic looked in the prev_line_info it started with
+    //  (at most once, as the lookup is for a new line), the colno it looked
+    //  for and the requests that had been added to it by then
+    std::optional<std::pair<colno_t, std::vector<printer_position::req_act_info>>>
+                                     prev_line_lookup  = {};
+
+    //  Until it has set all the carried state, the requests it was printed
+    //  from, to print that part again if it started from a wrong guess;
+    //  then where it had got to
+    bool                             settling          = false;
+    printer_recording                start_requests    = {};
+    printer_position                 settled_at        = {};
+    std::size_t                      settled_size      = 0;  // of out_buffer
+    std::size_t                      settled_mappings  = 0;
+
+    //  Whether it would have printed the same if it started at start
+    //  instead of started_at
+    //
+    auto started_like(printer_position const& start) const
+        -> bool
+    {
+        if (!started_at.prints_like(start, carried_used)) {
+            return false;
+        }
+        if (prev_line_lookup)
+        {
+            auto const& [colno, added] = *prev_line_lookup;
+            auto looked_in = [&](printer_position const& from) {
+                auto info = from.prev_line_info;
+                info.requests.insert(info.requests.end(), added.begin(), added.end());
+                return info;
+            };
+            return looked_in(started_at).offset_of(colno) == looked_in(start).offset_of(colno);
+        }
+        return true;
+    }
+
+    //  Continue from where it really started: carry over the state it
+    //  neither used nor set
+    //
+    auto started_from(printer_position const& start)
+        -> void
+    {
+        carry_over_from(start);
+        if (!(carried_set & carried_prev_line)) {
+            auto info = start.prev_line_info;
+            info.requests.insert(
+                info.requests.end(),
+                prev_line_info.requests.begin() + std::ssize(started_at.prev_line_info.requests),
+                prev_line_info.requests.end()
+            );
+            prev_line_info = std::move(info);
+        }
+    }
+};
+
+class positional_printer : printer_section
+{
+public:
+    positional_printer()                          = default;
+private:
+    positional_printer(positional_printer const&) = delete;
+    void operator=(positional_printer const&)     = delete;
+
+    //  Core information
+    std::string*                out             = {}; // points to out_buffer while open
+    std::string                 out_filename    = {}; // the file the output is for, if any
+    bool                        out_to_cout     = false;
+    std::string                 cpp2_filename   = {};
+    std::string                 quoted_cpp2_filename = {}; // for #line directives
+    std::string                 cpp1_filename   = {};
+    std::vector<std::pair<std::string, std::string>>
+                                written_files   = {}; // (filename, contents) of each closed output file
+    std::vector<comment> const* pcomments       = {}; // Cpp2 comments data
+    source const*               psource         = {};
+    parser const*               pparser         = {};
+
 public:
     //  Modal information
     enum phases : u8 {
@@ -253,24 +888,143 @@ public:
     };
     auto get_phase() const { return phase; }
 
-private:
-    phases phase = phase0_type_decls;
+private:
+    phases phase = phase0_type_decls;
+
+    //  The sections of the phases not being printed now (this printer's
+    //  own printer_section is the current phase's), and where each starts
+    std::array<printer_section, 3>  other_sections = {};
+    std::array<printer_position, 3> section_starts = {};
+    printer_section                 restart_point  = {};
+
+    //  Where reopen() switched to the second output file, if it did
+    struct split_point {
+        phases      phase    = {};
+        std::size_t out_size = 0;
+        std::size_t mappings = 0;
+        std::string filename = {};  // the first output file
+    };
+    std::optional<split_point> reopened_at = {};
+
+    auto current_section()
+        -> printer_section&
+    {
+        return *this;
+    }
+
+    auto section_of(int p)
+        -> printer_section&
+    {
+        return p == phase ? current_section() : other_sections[p];
+    }
+
+    //  Option to emit to a string or text_chunks instead of the out file;
+    //  the innermost capture gets the output
+    std::vector<std::variant<std::string*, text_chunks*>> emit_target_stack;
+
+    //  Option to record requests instead of printing them; see printer_recording
+    printer_recording* recording = {};
+
+    //  Record a request that starts on a new line, which can't be captured
+    //  faithfully without knowing the position, so isn't replayable then
+    auto record_positioned(
+        printer_recording::request req,
+        std::string_view           s,
+        lineno_t                   line,
+        bool                       force = false
+    )
+        -> void
+    {
+        assert(recording);
+        if (!emit_target_stack.empty()) {
+            recording->replayable = false;
+            return;
+        }
+        recording->add(req, s, {}, force, false, line);
+    }
+
+    //  While the current section is settling, note a request lowering made
+    //  (the same way it would be recorded), or that it has settled
+    //
+    auto note(
+        printer_recording::request req,
+        std::string_view           s     = {},
+        source_position            pos   = {},
+        bool                       flag  = false,
+        bool                       flag2 = false,
+        int                        value = 0
+    )
+        -> void
+    {
+        if (!settling) {
+            return;
+        }
+        if (carried_set == carried_all) {
+            settling         = false;
+            settled_at       = *this;
+            settled_size     = out_buffer.size();
+            settled_mappings = mappings.size();
+            return;
+        }
+
+        using enum printer_recording::request;
+        if (req == captured_print) {
+            start_requests.add_captured_print(flag);
+        }
+        else if (
+            (req == print_cpp1 || req == reset_line_to)
+            && !emit_target_stack.empty()
+            )
+        {
+            start_requests.replayable = false;
+        }
+        else {
+            start_requests.add(req, s, pos, flag, flag2, value);
+        }
+    }
+
+    //  With -source-map, record that the next text printed comes from pos
+    //
+    auto map_to(source_position pos)
+        -> void
+    {
+        if (
+            !flag_source_map
+            || pos.lineno < 1
+            )
+        {
+            return;
+        }
 
-    auto inc_phase() -> void {
-        switch (phase) {
-        break;case phase0_type_decls          : phase = phase1_type_defs_func_decls;
-        break;case phase1_type_defs_func_decls: phase = phase2_func_defs;
-        break;default                         : assert(false && "ICE: invalid lowering phase");
+        //  Catch up with the text printed since last time
+        assert (out);
+        for (
+            auto newline = out->find('\n', map_scanned);
+            newline != out->npos;
+            newline = out->find('\n', map_scanned)
+            )
+        {
+            ++map_generated_pos.lineno;
+            map_generated_pos.colno = 1;
+            map_scanned = newline + 1;
         }
-        curr_pos     = {};
-        next_comment = 0;   // start over with the comments
-    }
+        map_generated_pos.colno += unchecked_narrow<colno_t>(out->size() - map_scanned);
+        map_scanned = out->size();
 
-    std::vector<std::string*>                emit_string_targets;       // option to emit to string instead of out file
-    std::vector<std::vector<text_with_pos>*> emit_text_chunks_targets;  // similar for vector<text_pos>
+        mappings.push_back({ map_generated_pos.lineno, map_generated_pos.colno, pos.lineno, pos.colno });
+    }
 
-    enum class target_type : u8 { string, chunks };
-    std::vector<target_type>                 emit_target_stack;         // to interleave them sensibly
+    //  Padding to align to a column, which with -source-map is just
+    //  enough to keep tokens apart
+    //
+    auto align_pad(int padding)
+        -> std::string_view
+    {
+        if (flag_source_map) {
+            padding = std::min(padding, curr_pos.colno > 1 ? 1 : 0);
+        }
+        return pad(padding);
+    }
 
 
     //-----------------------------------------------------------------------
@@ -284,33 +1038,41 @@ private:
     )
         -> void
     {
-        //  Take ownership of (and reset) just_printed_line_directive value
-        auto line_directive_already_done = std::exchange(just_printed_line_directive, false);
-
         //  If the caller is capturing this output, emit to the
         //  current target instead and skip most positioning logic
         if (!emit_target_stack.empty())
         {
             //  If capturing to a string, emit to the specified string
-            if (emit_target_stack.back() == target_type::string) {
-                assert(!emit_string_targets.empty());
-                *emit_string_targets.back() += s;
+            if (auto str = std::get_if<std::string*>(&emit_target_stack.back())) {
+                **str += s;
             }
 
-            //  If capturing to a vector of chunks, emit to that
+            //  If capturing to chunks, emit to that
             else {
-                assert(!emit_text_chunks_targets.empty());
-                emit_text_chunks_targets.back()->insert( emit_text_chunks_targets.back()->begin(), text_with_pos(std::string(s), pos) );
+                std::get<text_chunks*>(emit_target_stack.back())->emplace_back(s, pos);
             }
 
+            if (recording) {
+                recording->add_captured_print();
+            }
+            else {
+                just_printed_line_directive = false;
+                sets(carried_line_directive);
+            }
             return;
         }
 
+        //  Take ownership of (and reset) just_printed_line_directive value
+        uses(carried_line_directive);
+        sets(carried_line_directive);
+        auto line_directive_already_done = std::exchange(just_printed_line_directive, false);
+
         //  Otherwise, we'll actually print the string to the output file
         //  and update our curr_pos position
 
         if (s.length() > 0) {
             last_printed_char = s.back();
+            sets(carried_last_char);
         }
 
         //  Reject consecutive empty lines: If this line is empty
@@ -321,53 +1083,53 @@ private:
         {
             //  And so was the last one, update logical position only
             //  and increment empty_lines_suppressed instead of printing
+            uses(carried_last_was_empty);
             if (last_was_empty) {
                 if (track_curr_pos) {
                     ++curr_pos.lineno;
                     curr_pos.colno = 1;
                 }
+                uses(carried_empty_lines);
+                sets(carried_empty_lines);
                 ++empty_lines_suppressed;
                 return;
             }
             //  If this is the first consecutive empty, remember and continue
             last_was_empty = true;
+            sets(carried_last_was_empty);
         }
         //  Otherwise, if this line is not empty
         else {
             //  Remember that this line was not empty
             last_was_empty = false;
+            sets(carried_last_was_empty);
 
             //  And if we did suppress any empties, emit a #line to resync
+            uses(carried_empty_lines);
             if (empty_lines_suppressed > 0) {
                 if (!line_directive_already_done) {
                     print_line_directive(curr_pos.lineno);
                 }
                 empty_lines_suppressed = 0;
             }
+            sets(carried_empty_lines);
         }
 
         //  Output the string
         assert (out);
-        *out << s;
+        out->append(s);
 
         //  Update curr_pos by finding how many line breaks s contained,
         //  and where the last one was which determines our current colno
         if (track_curr_pos)
         {
-            auto last_newline = s.npos;             // the last newline we found in the string
-            auto newline_pos  = std::size_t(0);     // the current newline we found in the string
-            while ((newline_pos = s.find('\n', newline_pos)) != s.npos)
-            {
-                //  For each line break we find, reset pad and inc current lineno
-                pad_for_this_line = 0;
-                ++curr_pos.lineno;
-                last_newline = newline_pos;
-                ++newline_pos;
-            }
-
-            //  Now also adjust the colno
+            auto last_newline = s.rfind('\n');
             if (last_newline != s.npos) {
-                //  If we found a newline, it's the distance from the last newline to EOL
+                //  For the line breaks we found, reset pad and inc current lineno,
+                //  and the colno is the distance from the last newline to EOL
+                pad_for_this_line = 0;
+                sets(carried_pad);
+                curr_pos.lineno += unchecked_narrow<lineno_t>(std::count(s.begin(), s.begin() + unchecked_narrow<std::ptrdiff_t>(last_newline), '\n') + 1);
                 curr_pos.colno = unchecked_narrow<colno_t>(s.length() - last_newline);
             }
             else {
@@ -381,6 +1143,13 @@ private:
     //-----------------------------------------------------------------------
     //  Internal helpers
 
+    auto indent_heuristic_enabled()
+        -> bool
+    {
+        uses(carried_indent_heuristic);
+        return enable_indent_heuristic;
+    }
+
     //  Start a new line if we're not in col 1 already
     //
     auto ensure_at_start_of_new_line()
@@ -406,14 +1175,20 @@ private:
 
         //  Otherwise, implement the request
         prev_line_info = { curr_pos.lineno, { } };
+        sets(carried_prev_line);
         ensure_at_start_of_new_line();
 
         //  Not using print() here because this is transparent to the curr_pos
-        if (!flag_clean_cpp1) {
+        if (
+            !flag_clean_cpp1
+            && !flag_source_map
+            )
+        {
             assert (out);
-            *out << "#line " << line << " " << std::quoted(cpp2_filename) << "\n";
+            out->append("#line ").append(std::to_string(line)).append(1, ' ').append(quoted_cpp2_filename).append(1, '\n');
         }
         just_printed_line_directive = true;
+        sets(carried_line_directive);
     }
 
     //  Catch up with comment/blank lines
@@ -424,7 +1199,8 @@ private:
         //  For a line comment, start it at the right indentation and print it
         //  with a newline end
         if (c.kind == comment::comment_kind::line_comment) {
-            print( pad( c.start.colno - curr_pos.colno + 1 ) );
+            print( align_pad( c.start.colno - curr_pos.colno + 1 ) );
+            map_to( c.start );
             print( c.text );
             assert( c.text.find('\n') == c.text.npos ); // we shouldn't have newlines
             print("\n");
@@ -433,7 +1209,8 @@ private:
         //  For a stream comment, pad out to its column (if we haven't passed it already)
         //  and emit it there
         else {
-            print( pad( c.start.colno - curr_pos.colno ) );
+            print( align_pad( c.start.colno - curr_pos.colno ) );
+            map_to( c.start );
             print( c.text );
         }
 
@@ -515,7 +1292,7 @@ private:
         //  Ignoring this logic is used when we're generating new code sections,
         //  such as return value structs, and emitting raw string literals
         if (ignore_align) {
-            print( pad( ignore_align_indent - curr_pos.colno ) );
+            print( align_pad( ignore_align_indent - curr_pos.colno ) );
             return;
         }
 
@@ -525,6 +1302,7 @@ private:
         flush_comments( pos );
 
         //  If we're not on the right line
+        uses(carried_printed_extra);
         if (
             printed_extra
             && !on_same_line
@@ -544,6 +1322,9 @@ private:
             }
             curr_pos.lineno = pos.lineno;
         }
+        if (!on_same_line) {
+            sets(carried_printed_extra);    // it's false now either way
+        }
 
         //  Finally, align to the target column, if we're on the right line
         //  and not one-past-the-end on the extra line at section end)
@@ -559,6 +1340,7 @@ private:
         {
             //  Record this line's indentation as the 'last' line for next time
             last_line_indentation = psource->get_lines()[curr_pos.lineno].indent();
+            sets(carried_line_indentation);
 
             //  If this line was originally densely spaced (had <2 whitespace
             //  between all tokens), then the programmer likely wasn't doing a lot
@@ -568,10 +1350,11 @@ private:
                 //  For the first token in a line, use the line's original indentation
                 if (curr_pos.colno <= 1)
                 {
-                    print( pad( psource->get_lines()[curr_pos.lineno].indent() ) );
+                    print( align_pad( psource->get_lines()[curr_pos.lineno].indent() ) );
                 }
                 //  For later tokens, don't try to add padding
                 else {
+                    uses(carried_last_char);
                     if (
                         last_printed_char == ';'
                         && on_same_line
@@ -584,8 +1367,9 @@ private:
             //  Otherwise, make a best effort to adjust position with some padding
             else
             {
+                uses(carried_pad);
                 pos.colno = std::max( 1, pos.colno + pad_for_this_line );
-                print( pad( pos.colno - curr_pos.colno ) );
+                print( align_pad( pos.colno - curr_pos.colno ) );
             }
         }
     }
@@ -641,29 +1425,31 @@ public:
             && !pcomments
             && "ICE: tried to call .open twice"
         );
+        quoted_cpp2_filename = (std::ostringstream{} << std::quoted(cpp2_filename)).str();
         cpp1_filename = cpp1_filename_;
-        if (cpp1_filename == "stdout") {
-            out = &std::cout;
-        }
-        else {
-            out_file.open(cpp1_filename);
-            out = &out_file;
+        out_to_cout   = cpp1_filename == "stdout";
+        if (!out_to_cout) {
+            out_filename = cpp1_filename;
         }
+        out = &out_buffer;
         pcomments = &comments;
         psource   = &source;
         pparser   = &parser;
     }
 
+    //  Switch to a second output file, which close() writes after the
+    //  first one with the output printed before this
+    //
     auto reopen()
         -> void
     {
         assert(
             is_open()
-            && "ICE: tried to call .reopen without first calling .open"
+            && !reopened_at
+            && "ICE: tried to call .reopen without first calling .open, or twice"
         );
         assert(cpp1_filename.ends_with(".h"));
-        out_file.close();
-        out_file.open(cpp1_filename + "pp");
+        reopened_at = { phase, out_buffer.size(), mappings.size(), std::exchange(out_filename, cpp1_filename + "pp") };
     }
 
     auto is_open()
@@ -680,7 +1466,146 @@ public:
 
 
     //-----------------------------------------------------------------------
-    //  Abandon: close and delete
+    //  Close: write the buffered output to its file, if it changed, with
+    //  the sections printed so far back to back
+    //
+    //  Returns:    false if the file could not be written, in which case
+    //              get_filename() is the one
+    //
+    auto close()
+        -> bool
+    {
+        auto contents = std::string{};
+        auto map_of   = source_map{};
+        auto at       = source_position{};  // where the next text goes in contents
+
+        //  Append text, and with -source-map its mappings, which are relative
+        //  to origin (where the text starts in its section)
+        auto append = [&](
+            std::string_view                       text,
+            std::span<source_map::mapping const>   text_mappings,
+            source_position                        origin
+        ) {
+            if (flag_source_map)
+            {
+                for (auto m : text_mappings) {
+                    if (m.generated_line == origin.lineno) {
+                        m.generated_col -= origin.colno - 1;
+                    }
+                    m.generated_line -= origin.lineno - 1;
+                    if (m.generated_line == 1) {
+                        m.generated_col += at.colno - 1;
+                    }
+                    m.generated_line += at.lineno - 1;
+                    map_of.add(m);
+                }
+                at = position_after(text, at);
+            }
+            contents += text;
+        };
+
+        auto write = [&](std::string& filename) {
+            if (out_to_cout) {
+                std::cout.write(contents.data(), std::ssize(contents));
+                return true;
+            }
+            if (filename.empty()) {
+                return true;
+            }
+            if (!write_file_if_changed(filename, contents)) {
+                return false;
+            }
+
+            //  With -source-map, the map goes next to the output file
+            if (flag_source_map)
+            {
+                map_of.file   = filename;
+                map_of.source = cpp2_filename;
+                auto map_filename = filename + ".map";
+                auto map_contents = map_of.to_json();
+                if (!write_file_if_changed(map_filename, map_contents)) {
+                    return false;
+                }
+                written_files.emplace_back(std::exchange(filename, {}), std::move(contents));
+                written_files.emplace_back(std::move(map_filename), std::move(map_contents));
+                return true;
+            }
+
+            written_files.emplace_back(std::exchange(filename, {}), std::move(contents));
+            return true;
+        };
+
+        for (auto p = 0; p <= phase; ++p)
+        {
+            auto& section       = section_of(p);
+            auto  text          = std::string_view{section.out_buffer};
+            auto  text_mappings = std::span<source_map::mapping const>{section.mappings};
+            auto  origin        = source_position{};
+
+            //  If this is where the second file starts, write the first one
+            if (
+                reopened_at
+                && reopened_at->phase == p
+                )
+            {
+                append(text.substr(0, reopened_at->out_size), text_mappings.first(reopened_at->mappings), origin);
+                if (!write(reopened_at->filename)) {
+                    out_filename = reopened_at->filename;
+                    return false;
+                }
+                contents = {};
+                map_of   = {};
+                at       = {};
+                origin   = position_after(text.substr(0, reopened_at->out_size), origin);
+                text.remove_prefix(reopened_at->out_size);
+                text_mappings = text_mappings.subspan(reopened_at->mappings);
+            }
+
+            append(text, text_mappings, origin);
+            section.out_buffer.clear();
+            section.mappings.clear();
+            section.map_scanned       = 0;
+            section.map_generated_pos = {};
+        }
+        reopened_at.reset();
+
+        return write(out_filename);
+    }
+
+    //  Where printing text at pos ends up
+    //
+    static auto position_after(
+        std::string_view text,
+        source_position  pos
+    )
+        -> source_position
+    {
+        auto last_newline = text.rfind('\n');
+        if (last_newline == text.npos) {
+            pos.colno += unchecked_narrow<colno_t>(text.size());
+            return pos;
+        }
+        return {
+            pos.lineno + unchecked_narrow<lineno_t>(std::count(text.begin(), text.end(), '\n')),
+            unchecked_narrow<colno_t>(text.size() - last_newline)
+        };
+    }
+
+    auto get_filename() const
+        -> std::string const&
+    {
+        return out_filename;
+    }
+
+    auto get_written_files() const
+        -> std::vector<std::pair<std::string, std::string>> const&
+    {
+        return written_files;
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  Abandon: discard output and delete
     //
     auto abandon()
         -> void
@@ -688,8 +1613,17 @@ public:
         if (!is_open()) {
             return;
         }
-        if (out_file.is_open()) {
-            out_file.close();
+        if (out_to_cout) {
+            //  Output to cout has always been partial on errors, so keep that
+            close();
+        }
+        else {
+            for (auto p = 0; p < std::ssize(other_sections); ++p) {
+                section_of(p).out_buffer.clear();
+                section_of(p).mappings.clear();
+            }
+            reopened_at.reset();
+            out_filename.clear();
             std::remove(cpp1_filename.c_str());
         }
     }
@@ -706,8 +1640,25 @@ public:
             is_open()
             && "ICE: printer must be open before printing"
         );
+        if (recording) {
+            if (emit_target_stack.empty()) {
+                recording->add(printer_recording::request::print_extra, s);
+            }
+            else {
+                print( s, source_position{}, false );
+                recording->add_captured_print(true);
+            }
+            return;
+        }
+        if (emit_target_stack.empty()) {
+            note(printer_recording::request::print_extra, s);
+        }
+        else {
+            note(printer_recording::request::captured_print, {}, {}, true);
+        }
         print( s, source_position{}, false );
         printed_extra = true;
+        sets(carried_printed_extra);
     }
 
 
@@ -722,6 +1673,11 @@ public:
             && line >= 0
             && "ICE: printer must be open before printing, and line number must not be negative (Cpp1 code is never generated)"
         );
+        if (recording) {
+            record_positioned(printer_recording::request::print_cpp1, s, line);
+            return;
+        }
+        note(printer_recording::request::print_cpp1, s, {}, false, false, line);
 
         //  Always start a Cpp1 line on its own new line
         ensure_at_start_of_new_line();
@@ -735,6 +1691,7 @@ public:
 
         //  Print the line
         assert (curr_pos.colno == 1);
+        map_to({ line, 1 });
         print( s );
         print( "\n" );
     }
@@ -747,6 +1704,12 @@ public:
     auto reset_line_to(lineno_t line, bool force = false)
         -> void
     {
+        if (recording) {
+            record_positioned(printer_recording::request::reset_line_to, {}, line, force);
+            return;
+        }
+        note(printer_recording::request::reset_line_to, {}, {}, force, false, line);
+
         //  Always start a Cpp2 section on its own new line
         ensure_at_start_of_new_line();
 
@@ -777,16 +1740,38 @@ public:
     )
         -> void
     {
+        if (
+            recording
+            && emit_target_stack.empty()
+            )
+        {
+            recording->add(printer_recording::request::print_cpp2, s, pos, leave_newlines_alone, is_known_empty);
+            return;
+        }
+        if (emit_target_stack.empty()) {
+            note(printer_recording::request::print_cpp2, s, pos, leave_newlines_alone, is_known_empty);
+        }
+        else {
+            note(printer_recording::request::captured_print);
+        }
+        //  (what this asks of itself is part of this request)
+        auto outermost = finally([&, was_settling = std::exchange(settling, false)]{
+            settling = was_settling;
+        });
+
         //  If we're printing for real (not to a string target)
         if (emit_target_stack.empty())
         {
             //  If we're in a generated text region (signified by negative
             //  line numbers), then shunt this call to print_extra instead
             if (pos.lineno < 1) {
+                uses(carried_generated_line);
                 if (generated_pos_line != pos.lineno) {
-                    *out << "\n" + std::string(last_line_indentation, ' ');
+                    uses(carried_line_indentation);
+                    out->append(1, '\n').append(unchecked_narrow<std::size_t>(flag_source_map ? 0 : last_line_indentation), ' ');
                     generated_pos_line = pos.lineno;
                 }
+                sets(carried_generated_line);
                 print_extra(s);
                 return;
             }
@@ -794,6 +1779,7 @@ public:
             //  Otherwise, we're no longer in generated code, so reset the
             //  generated code counter
             generated_pos_line = {};
+            sets(carried_generated_line);
         }
 
         assert(
@@ -859,41 +1845,38 @@ public:
             //      non-comment non-whitespace text on the new line
             else if (
                 last_pos.lineno == pos.lineno-1
-                && enable_indent_heuristic
+                && indent_heuristic_enabled()
                 )
             {
-                //  If the last line had a request for this colno, remember its actual offset
-                constexpr int sentinel = -100;
-                auto last_line_offset = sentinel;
-                for(auto i = 0;
-                    i < std::ssize(prev_line_info.requests)
-                        && prev_line_info.requests[i].requested <= pos.colno;
-                    ++i
-                    )
-                {
-                    if (prev_line_info.requests[i].requested == pos.colno)
-                    {
-                        last_line_offset = prev_line_info.requests[i].offset;
-                        break;
-                    }
+                //  If that's the line this section started with, remember
+                //  what was looked up in it, to check the start against
+                if (!(carried_set & carried_prev_line)) {
+                    uses(carried_prev_line);
+                    auto added = prev_line_info.requests;
+                    added.erase(added.begin(), added.begin() + std::ssize(started_at.prev_line_info.requests));
+                    prev_line_lookup = { pos.colno, std::move(added) };
                 }
 
-                //  If there was one, apply the actual column number offset
-                if (last_line_offset > sentinel) {
-                    adjusted_pos.colno += last_line_offset;
-                }
+                //  If the last line had a request for this colno, apply its actual offset
+                adjusted_pos.colno += prev_line_info.offset_of(pos.colno);
             }
             enable_indent_heuristic = true;
+            sets(carried_indent_heuristic);
 
             //  If we're changing lines, start accumulating this new line's request/actual adjustment info
             if (last_pos.lineno < adjusted_pos.lineno) {
                 prev_line_info = { curr_pos.lineno, { } };
+                sets(carried_prev_line);
             }
 
             align_to(adjusted_pos);
 
             //  Remember the requested and actual offset columns for this item
             prev_line_info.requests.push_back( req_act_info( pos.colno /*requested*/ , curr_pos.colno /*actual*/ - pos.colno ) );
+
+            if (!s.empty()) {
+                map_to(pos);
+            }
         }
 
         print(s, pos, true, is_known_empty );
@@ -911,12 +1894,22 @@ public:
     auto preempt_position_push(source_position pos)
         -> void
     {
+        if (recording) {
+            recording->add(printer_recording::request::preempt_position_push, {}, pos);
+            return;
+        }
+        note(printer_recording::request::preempt_position_push, {}, pos);
         preempt_pos.push_back( pos );
     }
 
     auto preempt_position_pop()
         -> void
     {
+        if (recording) {
+            recording->add(printer_recording::request::preempt_position_pop);
+            return;
+        }
+        note(printer_recording::request::preempt_position_pop);
         assert(!preempt_pos.empty());
         preempt_pos.pop_back();
     }
@@ -926,6 +1919,13 @@ public:
     auto add_pad_in_this_line(colno_t extra)
         -> void
     {
+        if (recording) {
+            recording->add(printer_recording::request::add_pad_in_this_line, {}, {}, false, false, extra);
+            return;
+        }
+        note(printer_recording::request::add_pad_in_this_line, {}, {}, false, false, extra);
+        uses(carried_pad);
+        sets(carried_pad);
         pad_for_this_line += extra;
     }
 
@@ -934,7 +1934,13 @@ public:
     auto disable_indent_heuristic_for_next_text()
         -> void
     {
+        if (recording) {
+            recording->add(printer_recording::request::disable_indent_heuristic_for_next_text);
+            return;
+        }
+        note(printer_recording::request::disable_indent_heuristic_for_next_text);
         enable_indent_heuristic = false;
+        sets(carried_indent_heuristic);
     }
 
     //  Ignore position information, usually when emitting generated code
@@ -946,6 +1952,12 @@ public:
     )
         -> void
     {
+        if (recording) {
+            recording->add(printer_recording::request::ignore_alignment, {}, {}, ignore, false, indent);
+            return;
+        }
+        note(printer_recording::request::ignore_alignment, {}, {}, ignore, false, indent);
+
         //  We'll only ever call this in local non-nested true/false pairs.
         //  If we ever want to generalize (support nesting, or make it non-brittle),
         //  wrap this in a push/pop stack.
@@ -966,45 +1978,341 @@ public:
     //  Modal state control functions
     //
 
-    auto next_phase()
+    //  Print to the section for phase p
+    //
+    auto select_phase(phases p)
+        -> void
+    {
+        if (p != phase) {
+            std::swap(current_section(), other_sections[phase]);
+            std::swap(current_section(), other_sections[p]);
+            phase = p;
+        }
+    }
+
+    //  Start printing the section for phase p, from a guess at where the
+    //  previous section ends, with print_start printing what goes between
+    //  them (which continue_phase prints for real, once that's known)
+    //
+    auto start_phase(
+        phases      p,
+        auto const& print_start
+    )
+        -> void
+    {
+        assert(p > phase0_type_decls);
+        select_phase(p);
+        static_cast<printer_position&>(*this) = section_starts[p];
+        print_start();
+
+        out_buffer.clear();
+        mappings.clear();
+        map_scanned       = 0;
+        map_generated_pos = {};
+        carried_set       = 0;
+        carried_used      = 0;
+        started_at        = *this;
+        prev_line_lookup  = {};
+        settling          = true;
+        start_requests    = {};
+    }
+
+    //  Continue from the end of the section for phase p-1, which must be
+    //  selected and finalized, to the section for phase p
+    //
+    //  If section p started from a wrong guess, what it printed until it
+    //  settled is printed again from the right place
+    //
+    //  Returns:    false if that couldn't be done, so it needs printing
+    //              again (start_phase then starts it from the right place)
+    //
+    auto continue_phase(
+        phases      p,
+        auto const& print_start
+    )
+        -> bool
+    {
+        assert(
+            p > phase0_type_decls
+            && phase == p-1
+        );
+        curr_pos     = {};
+        next_comment = 0;   // start over with the comments
+        section_starts[p] = *this;
+        print_start();
+
+        auto const start = printer_position{*this};
+        select_phase(p);
+        if (started_like(start)) {
+            started_from(start);
+            settling = false;
+            return true;
+        }
+        if (!start_requests.replayable) {
+            return false;
+        }
+
+        auto printed = std::move(current_section());
+        current_section() = {};
+        static_cast<printer_position&>(*this) = start;
+        replay(printed.start_requests);
+
+        //  If it never settled, that was all of it
+        if (printed.settling) {
+            return true;
+        }
+        if (!continues_like(printed.settled_at)) {
+            current_section() = std::move(printed);
+            return false;
+        }
+
+        //  Otherwise continue with the rest of it, moving its mappings by
+        //  as much as its start moved
+        auto const was = position_after(std::string_view{printed.out_buffer}.substr(0, printed.settled_size), {});
+        auto const now = position_after(out_buffer, {});
+        out_buffer.append(printed.out_buffer, printed.settled_size);
+        for (auto m : std::span{printed.mappings}.subspan(printed.settled_mappings)) {
+            if (m.generated_line == was.lineno) {
+                m.generated_col += now.colno - was.colno;
+            }
+            m.generated_line += now.lineno - was.lineno;
+            mappings.push_back(m);
+        }
+        static_cast<printer_position&>(*this) = printed;
+        map_scanned       = 0;
+        map_generated_pos = {};
+        return true;
+    }
+
+    //  Remember the output so far, to restart printing the sections
+    //  from here if a guess turns out wrong
+    //
+    auto mark_restart()
+        -> void
+    {
+        assert(
+            phase == phase0_type_decls
+            && !reopened_at
+        );
+        restart_point = current_section();
+    }
+
+    auto restart()
+        -> void
+    {
+        select_phase(phase0_type_decls);
+        current_section() = restart_point;
+        other_sections[phase1_type_defs_func_decls] = {};
+        other_sections[phase2_func_defs]            = {};
+        if (reopened_at) {
+            out_filename = reopened_at->filename;
+            reopened_at.reset();
+        }
+    }
+
+    //  Provide an option to store to a given string instead, which is
+    //  useful for capturing Cpp1-formatted output for generated code
+    //
+    auto emit_to_string( std::string* target = {} )
+        -> void
+    {
+        if (target) {
+            emit_target_stack.push_back( target );
+        }
+        else {
+            assert(std::holds_alternative<std::string*>(emit_target_stack.back()));
+            emit_target_stack.pop_back();
+        }
+    }
+
+    //  Provide an option to store to text_chunks, which is useful for
+    //  postfix expression which have to mix unwrapping operators with
+    //  emitting sub-elements such as expression lists
+    //
+    auto emit_to_text_chunks( text_chunks* target = {} )
+        -> void
+    {
+        if (target) {
+            emit_target_stack.push_back( target );
+        }
+        else {
+            assert(std::holds_alternative<text_chunks*>(emit_target_stack.back()));
+            emit_target_stack.pop_back();
+        }
+    }
+
+    //  Provide an option to record the requests instead, to replay them
+    //  later (pass null to stop recording)
+    //
+    auto record_to( printer_recording* target )
+        -> void
+    {
+        assert(emit_target_stack.empty());
+        recording = target;
+    }
+
+    //  Set up this printer to record requests for that printer, in its
+    //  current phase, to be replayed into that printer later
+    //
+    auto record_for(
+        positional_printer const& that,
+        printer_recording*        target
+    )
+        -> void
+    {
+        phase     = that.phase;
+        out       = &out_buffer;
+        pcomments = that.pcomments;
+        psource   = that.psource;
+        pparser   = that.pparser;
+        record_to(target);
+    }
+
+    //  Record that spliced recording number i goes here
+    //
+    auto record_splice(int i)
+        -> void
+    {
+        assert(recording);
+        if (!emit_target_stack.empty()) {
+            recording->replayable = false;
+            return;
+        }
+        recording->add(printer_recording::request::splice, {}, {}, false, false, i);
+    }
+
+    //  Print the recorded requests, with the spliced recordings' in their places
+    //
+    auto replay(
+        printer_recording const&              r,
+        std::vector<printer_recording> const& spliced = {}
+    )
         -> void
     {
-        inc_phase();
+        assert(
+            !recording
+            && emit_target_stack.empty()
+            && r.replayable
+        );
+        using req = printer_recording::request;
+        for (auto const& e : r.entries)
+        {
+            switch (e.req) {
+            break;case req::print_cpp2:
+                print_cpp2(r.text_of(e), e.pos, e.flag, e.flag2);
+            break;case req::print_extra:
+                print_extra(r.text_of(e));
+            break;case req::print_cpp1:
+                print_cpp1(r.text_of(e), e.value);
+            break;case req::reset_line_to:
+                reset_line_to(e.value, e.flag);
+            break;case req::preempt_position_push:
+                preempt_position_push(e.pos);
+            break;case req::preempt_position_pop:
+                preempt_position_pop();
+            break;case req::add_pad_in_this_line:
+                add_pad_in_this_line(e.value);
+            break;case req::disable_indent_heuristic_for_next_text:
+                disable_indent_heuristic_for_next_text();
+            break;case req::ignore_alignment:
+                ignore_alignment(e.flag, e.value);
+            break;case req::captured_print:
+                just_printed_line_directive = false;
+                sets(carried_line_directive);
+                if (e.flag) {
+                    printed_extra = true;
+                    sets(carried_printed_extra);
+                }
+            break;case req::splice:
+                assert(e.value < std::ssize(spliced));
+                replay(spliced[e.value]);
+            break;default:
+                assert(false && "ICE: invalid printer_recording request");
+            }
+        }
     }
 
-    //  Provide an option to store to a given string instead, which is
-    //  useful for capturing Cpp1-formatted output for generated code
+};
+
+
+//-----------------------------------------------------------------------
+//
+//  reset_compilation_state: clear the namespace-scope state that the
+//  lexer, parser, sema, and metafunctions keep for the current compilation
+//
+//  That state is thread_local so that separate files can be compiled on
+//  separate threads; a compilation must run start to finish on one thread
+//
+//-----------------------------------------------------------------------
+//
+auto reset_compilation_state()
+    -> void
+{
+    position_labels.clear();
+    position_label_requests = {};
+    generated_text        = {};
+    generated_lines       = {};
+    multiline_raw_strings = {};
+    generated_lexers      = {};
+
+    violates_lifetime_safety = false;
+    expression_node::current_expressions.clear();
+    expression_statement_node::current_expression_statements.clear();
+    indent_spaces = 2;
+    pretty_print_last_parent_type = {};
+
+    definite_initializations.clear();
+    definite_last_uses.clear();
+
+    timers.clear();
+}
+
+
+//-----------------------------------------------------------------------
+//
+//  section_parse_workers: threads that parse Cpp2 sections in parallel
+//
+//  The lexer, parser, and metafunctions keep thread_local state that
+//  tokens and parse tree nodes point into (see reset_compilation_state()),
+//  and each thread allocates nodes from its own node_arena. So a worker
+//  thread does its work and then stays alive, idle, until it is released
+//  when the compilation no longer needs the parse tree.
+//
+//-----------------------------------------------------------------------
+//
+class section_parse_workers
+{
+    std::latch               done;
+    std::latch               released{1};
+    std::vector<std::thread> threads;
+
+public:
+    //  Runs work(0) through work(count-1), each on its own thread,
+    //  and returns when they have all finished
     //
-    auto emit_to_string( std::string* target = {} )
-        -> void
+    section_parse_workers(
+        int                      count,
+        std::function<void(int)> work
+    )
+        : done{ count }
     {
-        if (target) {
-            emit_string_targets.push_back( target );
-            emit_target_stack.push_back(target_type::string);
-        }
-        else {
-            emit_string_targets.pop_back();
-            emit_target_stack.pop_back();
+        for (auto i = 0; i < count; ++i) {
+            threads.emplace_back([this, i, &work] {
+                work(i);
+                done.count_down();
+                released.wait();
+            });
         }
+        done.wait();
     }
 
-    //  Provide an option to store to a vector<text_with_pos>, which is
-    //  useful for postfix expression which have to mix unwrapping operators
-    //  with emitting sub-elements such as expression lists
-    //
-    auto emit_to_text_chunks( std::vector<text_with_pos>* target = {} )
-        -> void
+    ~section_parse_workers()
     {
-        if (target) {
-            emit_text_chunks_targets.push_back( target );
-            emit_target_stack.push_back(target_type::chunks);
-        }
-        else {
-            emit_text_chunks_targets.pop_back();
-            emit_target_stack.pop_back();
+        released.count_down();
+        for (auto& t : threads) {
+            t.join();
         }
     }
-
 };
 
 
@@ -1021,6 +2329,30 @@ struct function_prolog {
 
 class cppfront
 {
+    //  When parsing sections in parallel, each section's parse state
+    //  (see parse_sections_in_parallel) -- these are declared first so
+    //  they outlive the parse tree, which has tokens and nodes from them
+    //
+    struct section_parse {
+        std::vector<error_entry>   errors;
+        std::set<std::string>      includes;
+        std::vector<std::string>   extra_cpp1;
+        std::vector<std::string>   extra_build;
+        stable_vector<token>       generated_tokens;
+        cpp2::parser               parser;
+        std::ostringstream         compile_time_output;
+        std::vector<trace_span>    trace_spans;
+        bool                       succeeded                = false;
+        std::optional<std::string> exception                = {};
+        bool                       violates_lifetime_safety = false;
+
+        section_parse(std::string_view filename)
+            : parser{ errors, includes, extra_cpp1, extra_build, filename }
+        { }
+    };
+    std::unique_ptr<section_parse_workers>      parse_workers;
+    std::vector<std::unique_ptr<section_parse>> section_parses;
+
     std::string              sourcefile;
     std::vector<error_entry> errors;
     std::set<std::string>    includes;
@@ -1067,6 +2399,122 @@ class cppfront
     using source_order_name_lookup_res =
         std::optional<std::variant<declaration_node const*, active_using_declaration>>;
 
+    //  A stack of active names that also keeps, for each name, the stack
+    //  positions where it is declared, so that the innermost declaration
+    //  of a name can be found without scanning the whole stack
+    //
+    class name_lookup_stack
+    {
+        using value_type = source_order_name_lookup_res::value_type;
+
+        std::vector<value_type>                         names;
+        std::unordered_map<index_t, std::vector<int>>   positions;  // by name's atom
+        std::size_t                                     pops = 0;   // how many names were ever popped
+
+        static auto name_of(value_type const& v)
+            -> index_t
+        {
+            if (auto decl = get_if<declaration_node const*>(&v);
+                decl
+                && *decl
+                && (*decl)->has_name()
+                )
+            {
+                return (*decl)->name()->get_atom();
+            }
+            else if (auto using_ = get_if<active_using_declaration>(&v);
+                using_
+                && using_->identifier
+                )
+            {
+                return using_->identifier->get_atom();
+            }
+            return 0;
+        }
+
+    public:
+        name_lookup_stack(std::initializer_list<value_type> init)
+        {
+            for (auto const& v : init) {
+                push_back(v);
+            }
+        }
+
+        auto size() const
+            -> std::size_t
+        {
+            return names.size();
+        }
+
+        auto push_back(value_type const& v)
+            -> void
+        {
+            if (auto name = name_of(v)) {
+                positions[name].push_back( unchecked_narrow<int>(std::ssize(names)) );
+            }
+            names.push_back(v);
+        }
+
+        //  Pops back down to n names
+        auto resize(std::size_t n)
+            -> void
+        {
+            assert (n <= names.size());
+            while (names.size() > n) {
+                if (auto name = name_of(names.back())) {
+                    auto iter = positions.find(name);
+                    assert(iter != positions.end());
+                    iter->second.pop_back();
+                    if (iter->second.empty()) {
+                        positions.erase(iter);
+                    }
+                }
+                names.pop_back();
+                ++pops;
+            }
+        }
+
+        auto get_pops() const
+            -> std::size_t
+        {
+            return pops;
+        }
+
+        //  Pops or pushes to make this, which has the same names as the
+        //  start of that, have the same names as that's first n names
+        auto assign_prefix(
+            name_lookup_stack const& that,
+            std::size_t              n
+        )
+            -> void
+        {
+            assert(
+                size() <= that.size()
+                && n <= that.size()
+            );
+            resize(std::min(size(), n));
+            while (size() < n) {
+                push_back(that.names[size()]);
+            }
+        }
+
+        //  The innermost active declaration of identifier, ignoring the
+        //  bottom entry (which is the global namespace)
+        auto find(token const& identifier) const
+            -> source_order_name_lookup_res
+        {
+            if (auto iter = positions.find(identifier.get_atom());
+                iter != positions.end()
+                && !iter->second.empty()
+                && iter->second.back() > 0
+                )
+            {
+                return names[iter->second.back()];
+            }
+            return {};
+        }
+    };
+
     struct postfix_expression_info {
         bool is_pointer  = false;
 
@@ -1081,7 +2529,13 @@ class cppfront
 
     //  Stack of the currently active names for source order name lookup:
     //  Like 'current_declarations' + also parameters and using declarations
-    std::vector<source_order_name_lookup_res::value_type> current_names = { {} };
+    name_lookup_stack current_names = { {} };
+
+    //  What lowering looks up in each type's scope, computed once per type
+    //  instead of for each member (the parse tree doesn't change anymore)
+    using object_names = std::unordered_map<std::string_view, declaration_node const*>;
+    std::unordered_map<declaration_node const*, object_names>                               type_objects_before_base;
+    std::unordered_map<declaration_node const*, declaration_node::declared_value_set_funcs> type_value_set_functions;
 
     //  Maintain a stack of the functions we're currently processing, which can
     //  be up to MaxNestedFunctions in progress (if we run out, bump the Max).
@@ -1176,19 +2630,54 @@ class cppfront
     auto consumed_expression_list_parens()          -> void { if( std::ssize(need_expression_list_parens) > 1 )
                                                                   need_expression_list_parens.back() = false;      }
 
+    //  For lowering namespace-scope declarations in parallel (see lower_deferred_jobs),
+    //  each declaration's lowering context, and the requests it makes to the printer
+    struct lowering_job {
+        declaration_node const*              decl                     = {};
+        declaration_node const*              having_signature_emitted = {};
+        std::vector<declaration_node const*> current_declarations     = {};
+        std::size_t                          current_names_count      = {}; // a prefix of the compilation's current_names
+        printer_recording                    output                   = {};
+        bool                                 lowered                  = false;
+        bool                                 violates_bounds_safety   = false;
+        bool                                 violates_lifetime_safety = false;
+    };
+    int                        lower_jobs      = 1;     // the number of threads that may lower declarations
+    std::vector<lowering_job>* deferred_jobs   = {};    // if set, namespace-scope declarations are deferred to here
+    bool                       lowering_failed = false; // something couldn't be lowered by itself
+    cppfront*                  lowering_for    = {};    // for a lowering worker, the compilation it works for
+
+    bool bodies_on_demand = false;  // parse each function body just before lowering it
+
 public:
     //-----------------------------------------------------------------------
     //  Constructor
     //
-    //  filename    the source file to be processed
+    //  filename            the source file to be processed
+    //  jobs                the number of threads that may parse its Cpp2
+    //                      sections, and lower its declarations
+    //  bodies_on_demand    whether to parse each function body that can be
+    //                      parsed by itself just before lowering it, and
+    //                      free it after, instead of keeping all of them
+    //                      (declarations are then lowered serially)
     //
-    cppfront(std::string const& filename)
+    cppfront(
+        std::string const& filename,
+        int                jobs              = 1,
+        bool               bodies_on_demand_ = false
+    )
         : sourcefile{ filename }
         , source    { errors }
         , tokens    { errors }
         , parser    { errors, includes, extra_cpp1, extra_build, filename }
         , sema      { errors }
+        , lower_jobs{ bodies_on_demand_ ? 1 : jobs }
+        , bodies_on_demand{ bodies_on_demand_ }
     {
+        //  Start from a clean slate, in case this thread compiled another file before
+        //
+        reset_compilation_state();
+
         //  "Constraints enable creativity in the right directions"
         //  sort of applies here
         //
@@ -1225,21 +2714,32 @@ public:
 
             //  Parse
             //
+            if (bodies_on_demand) {
+                parser.defer_function_bodies();
+            }
             try
             {
-                for (auto const& [line, entry] : tokens.get_map()) {
-                    if (!parser.parse(entry, tokens.get_generated())) {
-                        errors.emplace_back(
-                            source_position(line, 0),
-                            "parse failed for section starting here",
-                            false,
-                            true    // a noisy fallback error message
-                        );
+                if (
+                    jobs > 1
+                    && std::ssize(tokens.get_sections()) > 1
+                    && errors.empty()
+                    )
+                {
+                    parse_sections_in_parallel(
+                        std::min(jobs, unchecked_narrow<int>(std::ssize(tokens.get_sections())))
+                    );
+                }
+                else {
+                    for (auto const& section : tokens.get_sections()) {
+                        parse_section(section);
                     }
                 }
 
                 //  Sema
-                parser.visit(sema);
+                {
+                    auto trace = trace_scope("sema::visit");
+                    parser.visit(sema);
+                }
                 if (!sema.apply_local_rules()) {
                     violates_initialization_safety = true;
                 }
@@ -1254,6 +2754,308 @@ public:
     }
 
 
+    //-----------------------------------------------------------------------
+    //  parse_section: Parse one Cpp2 section into the parse tree
+    //
+    auto parse_section(token_section const& section)
+        -> void
+    {
+        if (!parser.parse(section.tokens, tokens.get_generated())) {
+            errors.emplace_back(
+                source_position(section.lineno, 0),
+                "parse failed for section starting here",
+                false,
+                true    // a noisy fallback error message
+            );
+        }
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  parse_sections_in_parallel: Parse the Cpp2 sections on worker
+    //  threads, each into its own parser and error list, and then splice
+    //  the results into the parse tree in source order
+    //
+    //  jobs    the number of worker threads to use
+    //
+    //  The parser reports some errors only if there are no errors yet, so
+    //  once a section has reported errors, the sections after it are parsed
+    //  again here, in order, to report exactly what a serial parse would
+    //
+    //  Each section's compile-time output and -time-trace spans are kept
+    //  with its parse state and merged in source order the same way
+    //
+    auto parse_sections_in_parallel(int jobs)
+        -> void
+    {
+        auto trace = trace_scope("parser::parse", "parallel");
+
+        auto const& sections = tokens.get_sections();
+        for (auto i = 0; i < std::ssize(sections); ++i) {
+            section_parses.push_back( std::make_unique<section_parse>(sourcefile) );
+            if (bodies_on_demand) {
+                section_parses.back()->parser.defer_function_bodies();
+            }
+        }
+
+        auto next_section = std::atomic<std::ptrdiff_t>{0};
+        auto tracing      = trace_spans != nullptr;
+        parse_workers = std::make_unique<section_parse_workers>(jobs, [&](int)
+        {
+            for (
+                auto i = next_section++;
+                i < std::ssize(sections);
+                i = next_section++
+                )
+            {
+                auto& p = *section_parses[i];
+                compile_time_out = &p.compile_time_output;
+                trace_spans      = tracing ? &p.trace_spans : nullptr;
+                try {
+                    p.succeeded = p.parser.parse(sections[i].tokens, p.generated_tokens);
+                }
+                catch (std::runtime_error& e) {
+                    p.exception = e.what();
+                }
+                p.violates_lifetime_safety = std::exchange(violates_lifetime_safety, false);
+            }
+            trace_spans = nullptr;
+        });
+
+        for (auto i = 0; i < std::ssize(sections); ++i)
+        {
+            if (!errors.empty()) {
+                parse_section(sections[i]);
+                continue;
+            }
+
+            auto& p = *section_parses[i];
+            errors.insert( errors.end(), p.errors.begin(), p.errors.end() );
+            includes.insert( p.includes.begin(), p.includes.end() );
+            extra_cpp1.insert( extra_cpp1.end(), p.extra_cpp1.begin(), p.extra_cpp1.end() );
+            extra_build.insert( extra_build.end(), p.extra_build.begin(), p.extra_build.end() );
+            *compile_time_out << p.compile_time_output.view();
+            if (trace_spans) {
+                trace_spans->insert(
+                    trace_spans->end(),
+                    std::make_move_iterator(p.trace_spans.begin()),
+                    std::make_move_iterator(p.trace_spans.end())
+                );
+            }
+            if (p.violates_lifetime_safety) {
+                violates_lifetime_safety = true;
+            }
+            parser.append(p.parser);
+
+            if (p.exception) {
+                throw std::runtime_error(*p.exception);
+            }
+            if (!p.succeeded) {
+                errors.emplace_back(
+                    source_position(sections[i].lineno, 0),
+                    "parse failed for section starting here",
+                    false,
+                    true    // a noisy fallback error message
+                );
+            }
+        }
+    }
+
+
+private:
+    //-----------------------------------------------------------------------
+    //  Constructor for a lowering worker, which lowers some of compilation's
+    //  namespace-scope declarations on its own thread (see lower_deferred_jobs)
+    //
+    explicit cppfront(cppfront* compilation)
+        : sourcefile{ compilation->sourcefile }
+        , source    { errors }
+        , tokens    { errors }
+        , parser    { errors, includes, extra_cpp1, extra_build, sourcefile }
+        , sema      { errors }
+        , lowering_for{ compilation }
+    { }
+
+
+    //-----------------------------------------------------------------------
+    //  The sema for this compilation, which lowering workers share
+    //
+    auto compilation_sema() const
+        -> cpp2::sema const&
+    {
+        return lowering_for ? lowering_for->sema : sema;
+    }
+
+    //  Check n's sema rules -- a lowering worker doesn't report errors, but
+    //  fails the job so that the compilation lowers it serially and reports them
+    //
+    auto sema_check(
+        auto const& n,
+        bool        emit_errors = true
+    )
+        -> bool
+    {
+        if (!lowering_for) {
+            return sema.check(n, emit_errors);
+        }
+        if (!lowering_for->sema.check(n, false)) {
+            lowering_failed = true;
+            return false;
+        }
+        return true;
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  parse_deferred_body: Parse and check the body of function n, which
+    //  was deferred to be parsed just before it's lowered (see bodies_on_demand)
+    //
+    //  Returns:    false if it couldn't be parsed
+    //
+    auto parse_deferred_body(declaration_node const& n)
+        -> bool
+    {
+        try {
+            if (!parser.parse_deferred_body(n, tokens.get_generated())) {
+                return false;
+            }
+        }
+        catch (std::runtime_error& e) {
+            errors.emplace_back(
+                source_position(-1, -1),
+                e.what()
+            );
+            return false;
+        }
+
+        if (!sema.visit_deferred_function(n)) {
+            violates_initialization_safety = true;
+        }
+        return true;
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  is_at_namespace_scope_baseline: Whether we're lowering at namespace
+    //  scope and not within another declaration, where a declaration's
+    //  lowering depends only on the context in a lowering_job
+    //
+    auto is_at_namespace_scope_baseline()
+        -> bool
+    {
+        return
+            !suppress_move_from_last_use
+            && !in_parameter_list
+            && !generating_assignment_from
+            && !generating_move_from
+            && !generating_postfix_inc_dec_from
+            && std::ssize(current_args) == 1
+            && !current_args.back().ptoken
+            && current_args.back().pass == passing_style::in
+            && active_postfix_expressions.empty()
+            && current_functions.empty()
+            && function_returns.empty()
+            && function_requires_conditions.empty()
+            && iteration_statements.empty()
+            && std::ssize(in_non_rvalue_context) == 1
+            && !in_non_rvalue_context.back()
+            && std::ssize(in_single_unqualified_id_return) == 1
+            && !in_single_unqualified_id_return.back()
+            && std::ssize(need_expression_list_parens) == 1
+            && need_expression_list_parens.back()
+            ;
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  lower_job: As a lowering worker, lower one deferred declaration
+    //
+    //  Returns:    false if it couldn't be lowered by itself
+    //
+    auto lower_job(lowering_job& job)
+        -> bool
+    {
+        having_signature_emitted = job.having_signature_emitted;
+        current_declarations     = job.current_declarations;
+        current_names.assign_prefix(lowering_for->current_names, job.current_names_count);
+        auto const labels_count  = std::ssize(position_labels);
+
+        printer.record_for(lowering_for->printer, &job.output);
+        emit(*job.decl);
+        printer.record_to({});
+
+        //  It must not have needed the printer's position, reported errors,
+        //  or labeled a position that the compilation hasn't already labeled
+        //  (their numbers depend on the order positions are labeled in), and
+        //  must have left the names as the compilation did when deferring it
+        job.lowered =
+            !lowering_failed
+            && errors.empty()
+            && job.output.replayable
+            && std::ssize(position_labels) == labels_count
+            && is_at_namespace_scope_baseline()
+            && current_names.size() == job.current_names_count + 1;
+        job.violates_bounds_safety   = std::exchange(violates_bounds_safety, false);
+        job.violates_lifetime_safety = std::exchange(violates_lifetime_safety, false);
+        return job.lowered;
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  lower_deferred_jobs: Lower the namespace-scope declarations that were
+    //  deferred while lowering phase2_func_defs, on worker threads
+    //
+    //  While the declarations are lowered for phase2_func_defs in parallel,
+    //  the printer records the requests instead of printing them, and each
+    //  namespace-scope declaration is deferred as a job with a splice in the
+    //  recording where it goes. Then worker threads lower the jobs, recording
+    //  each one's requests, and the recordings are replayed in order into the
+    //  printer, which prints exactly what lowering the declarations serially
+    //  does.
+    //
+    //  Returns:    false if some job couldn't be lowered by itself, so
+    //              lowering needs to be serial after all
+    //
+    auto lower_deferred_jobs(std::vector<lowering_job>& jobs)
+        -> bool
+    {
+        auto trace = trace_scope("lower declarations", "parallel");
+
+        //  Each worker thread starts from this thread's per-compilation
+        //  state (see reset_compilation_state()) that lowering uses
+        auto const& labels          = position_labels;
+        auto const& initializations = definite_initializations;
+        auto const& last_uses       = definite_last_uses;
+        auto const  indent          = indent_spaces;
+        auto const  last_parent     = pretty_print_last_parent_type;
+
+        auto next_job = std::atomic<std::ptrdiff_t>{0};
+        auto threads  = std::vector<std::thread>{};
+        for (auto i = 0; i < std::min<std::ptrdiff_t>(lower_jobs, std::ssize(jobs)); ++i) {
+            threads.emplace_back([&] {
+                position_labels               = labels;
+                definite_initializations      = initializations;
+                definite_last_uses            = last_uses;
+                indent_spaces                 = indent;
+                pretty_print_last_parent_type = last_parent;
+
+                auto worker = cppfront{this};
+                for (
+                    auto job = next_job++;
+                    job < std::ssize(jobs) && worker.lower_job(jobs[job]);
+                    job = next_job++
+                    )
+                { }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        return std::all_of(jobs.begin(), jobs.end(), [](auto const& job) { return job.lowered; });
+    }
+
+public:
     //-----------------------------------------------------------------------
     //  lower_to_cpp1
     //
@@ -1332,7 +3134,7 @@ public:
             if (
                 !source.is_module_cpp2_util()
                 && (
-                    !tokens.get_map().empty()
+                    !tokens.get_sections().empty()
                     || flag_import_std
                     || flag_include_std
                     )
@@ -1346,21 +3148,11 @@ public:
             }
         };
 
-        auto emit_cpp1_line = [&](auto const& line) {
-            if (
-                source.has_cpp2()
-                && line.cat != source_line::category::preprocessor
-                && line.cat != source_line::category::preprocessor_was_emitted
-                )
-            {
-                ++ret.cpp2_lines;
-            }
-            else
-            {
-                ++ret.cpp1_lines;
-            }
-
-            //  In Cpp2-only mode, there should be no nonblank Cpp1-content lines
+        //  In Cpp2-only mode, there should be no nonblank Cpp1-content lines
+        //
+        //  Returns:    the error for a Cpp1 line that is one, else null
+        //
+        auto disallowed_in_pure_cpp2 = [&](source_line const& line) -> char const* {
             if (
                 flag_cpp2_only
                 && !line.text.empty()
@@ -1371,22 +3163,38 @@ public:
                 && std::any_of(line.text.begin(), line.text.end(), [](auto c) { return !std::isspace(c); })
                 )
             {
-                if (line.cat == source_line::category::preprocessor) {
-                    if (!line.text.ends_with(".h2\"")) {
-                        errors.emplace_back(
-                            source_position(curr_lineno, 1),
-                            "pure-cpp2 switch disables the preprocessor, including #include (except of .h2 files) - use import instead (note: 'import std;' is implicit in -pure-cpp2)"
-                        );
-                        return false;
-                    }
-                }
-                else {
-                    errors.emplace_back(
-                        source_position(curr_lineno, 1),
-                        "pure-cpp2 switch disables Cpp1 syntax"
-                    );
-                    return false;
-                }
+                if (line.cat == source_line::category::preprocessor) {
+                    if (!line.text.ends_with(".h2\"")) {
+                        return "pure-cpp2 switch disables the preprocessor, including #include (except of .h2 files) - use import instead (note: 'import std;' is implicit in -pure-cpp2)";
+                    }
+                }
+                else {
+                    return "pure-cpp2 switch disables Cpp1 syntax";
+                }
+            }
+            return nullptr;
+        };
+
+        auto emit_cpp1_line = [&](auto const& line) {
+            if (
+                source.has_cpp2()
+                && line.cat != source_line::category::preprocessor
+                && line.cat != source_line::category::preprocessor_was_emitted
+                )
+            {
+                ++ret.cpp2_lines;
+            }
+            else
+            {
+                ++ret.cpp1_lines;
+            }
+
+            if (auto error = disallowed_in_pure_cpp2(line)) {
+                errors.emplace_back(
+                    source_position(curr_lineno, 1),
+                    error
+                );
+                return false;
             }
 
             if (
@@ -1515,12 +3323,28 @@ public:
             printer.print_extra( "\nimport cpp2.util;\n\n" );
         }
 
-        auto map_iter = tokens.get_map().cbegin();
+        //  Each declaration in each section, in source order
+        auto const section_decls = parser.get_parse_tree_declarations_in_sections(tokens.get_sections());
 
         //---------------------------------------------------------------------
-        //  Do phase0_type_decls
-        assert(printer.get_phase() == printer.phase0_type_decls);
+        //  Lower the declarations
+        //
+        //  Each declaration is lowered for each of the three phases in turn,
+        //  in one walk over the source, and each phase's output goes to its
+        //  own section, which continues from where the previous phase's
+        //  section ends. That's not known until the end of the walk, so the
+        //  printer starts sections 1 and 2 from a guess, and if the guess was
+        //  wrong in a way that matters, prints their first few items again
+        //  from the right start (in the rare case it can't, the walk is done
+        //  again from the right start). Each phase's errors and position labels
+        //  are kept apart too, to come out as if the phases were lowered one
+        //  after the other: errors phase by phase, and labels numbered in the
+        //  order they're first asked for in that way (when they aren't, the
+        //  walk is done again with the labels numbered that way up front).
+        //
+        auto const trace = trace_begin("lower declarations");
 
+        assert(printer.get_phase() == printer.phase0_type_decls);
         if (
             source.has_cpp2()
             && !flag_clean_cpp1
@@ -1541,33 +3365,21 @@ public:
             printer.reset_line_to(1, true);
         }
 
-        for (auto& section : tokens.get_map())
-        {
-            assert (!section.second.empty());
-
-            //  Get the parse tree for this section and emit each forward declaration
-            auto decls = parser.get_parse_tree_declarations_in_range(section.second);
-            for (auto& decl : decls) {
-                assert(decl);
-                emit(*decl);
-            }
-        }
-
-
-        //---------------------------------------------------------------------
-        //  Do phase1_type_defs_func_decls
-        //
-        printer.finalize_phase();
-        printer.next_phase();
-
-        if (
-            source.has_cpp2()
-            && !flag_clean_cpp1
-            )
-        {
-            printer.print_extra( "\n//=== Cpp2 type definitions and function declarations ===========================\n\n" );
-            printer.reset_line_to(1, true);
-        }
+        //  What goes between one phase's section and the next
+        auto print_phase_start = [&](std::string_view banner) {
+            return [&, banner] {
+                if (
+                    source.has_cpp2()
+                    && !flag_clean_cpp1
+                    )
+                {
+                    printer.print_extra( banner );
+                    printer.reset_line_to(1, true);
+                }
+            };
+        };
+        auto const print_phase1_start = print_phase_start( "\n//=== Cpp2 type definitions and function declarations ===========================\n\n" );
+        auto const print_phase2_start = print_phase_start( "\n//=== Cpp2 function definitions =================================================\n\n" );
 
         if (
             !source.has_cpp2()
@@ -1576,114 +3388,310 @@ public:
         {
             curr_lineno -= unchecked_narrow<int>(std::ssize(source.get_module_lines()) - 1);
         }
+        auto const first_lineno = curr_lineno;
 
-        assert (printer.get_phase() == positional_printer::phase1_type_defs_func_decls);
+        //  In Cpp2-only mode, lowering phase1_type_defs_func_decls stops at
+        //  the first Cpp1 line that's disallowed, and phase2_func_defs isn't
+        //  lowered at all
+        auto disallowed_lineno = std::optional<lineno_t>{};
         for (auto const& line : source.get_non_module_lines())
         {
-            //  Skip dummy line we added to make 0-vs-1-based offsets readable
-            if (curr_lineno != 0)
+            if (
+                curr_lineno != 0
+                && line.cat != source_line::category::cpp2
+                && disallowed_in_pure_cpp2(line)
+                )
             {
-                //  If it's a Cpp1 line, emit it
-                if (line.cat != source_line::category::cpp2) {
-                    if (!emit_cpp1_line(line)) {
-                        return {};
-                    }
+                disallowed_lineno = curr_lineno;
+                break;
+            }
+            ++curr_lineno;
+        }
+
+        //  Remember what to restore to lower the declarations again
+        auto const ret_start          = ret;
+        auto const hpp_includes_start = hpp_includes;
+        auto const errors_count       = std::ssize(errors);
+        auto const names_count        = current_names.size();
+        auto const labels_start       = position_labels;
+        auto       labels             = position_labels;
+        auto const definite_init      = in_definite_init;
+        auto const last_was_pointer   = last_postfix_expr_was_pointer;
+        auto const that_function      = emitting_that_function;
+        auto const move_function      = emitting_move_that_function;
+        auto const moved_members      = already_moved_that_members;
+        auto const bounds_violation   = violates_bounds_safety;
+        auto const lifetime_violation = violates_lifetime_safety;
+        auto const init_violation     = violates_initialization_safety;
+        auto       comments_printed   = std::vector<bool>{};
+        for (auto const& c : tokens.get_comments()) {
+            comments_printed.push_back(c.dbg_was_printed);
+        }
+        printer.mark_restart();
+
+        auto phase_errors   = std::array<std::vector<error_entry>, 3>{};
+        auto label_requests = std::array<std::vector<token const*>, 3>{};
+
+        //  With more than one job, phase2_func_defs is recorded instead of
+        //  printed, and namespace-scope declarations are deferred to lower
+        //  on worker threads (see lower_deferred_jobs), unless that fails
+        auto in_parallel       = lower_jobs > 1;
+        auto jobs              = std::vector<lowering_job>{};
+        auto skeleton          = printer_recording{};
+        auto names_popped      = false;
+
+        auto lower = [&](positional_printer::phases phase, declaration_node const& decl) {
+            printer.select_phase(phase);
+            position_label_requests = &label_requests[phase];
+            auto const names_pops = current_names.get_pops();
+            auto const defer      = in_parallel && phase == printer.phase2_func_defs;
+            if (defer) {
+                deferred_jobs = &jobs;
+                printer.record_to(&skeleton);
+            }
+
+            emit(decl);
+
+            if (defer) {
+                printer.record_to({});
+                deferred_jobs = {};
+
+                //  The workers share current_names, which must have only grown
+                names_popped = names_popped || current_names.get_pops() != names_pops;
+            }
+            position_label_requests = {};
+            auto& errors_of_phase = phase_errors[phase];
+            errors_of_phase.insert(
+                errors_of_phase.end(),
+                std::make_move_iterator(errors.begin() + errors_count),
+                std::make_move_iterator(errors.end())
+            );
+            errors.erase(errors.begin() + errors_count, errors.end());
+        };
+
+        auto lower_section = [&](std::ptrdiff_t i, bool with_phase1) {
+            for (auto& decl : section_decls[i]) {
+                assert(decl);
+                lower(printer.phase0_type_decls, *decl);
+                if (with_phase1) {
+                    lower(printer.phase1_type_defs_func_decls, *decl);
+                }
+                if (!disallowed_lineno) {
+                    lower(printer.phase2_func_defs, *decl);
                 }
+            }
+        };
 
-                //  If it's a Cpp2 line...
-                else {
-                    ++ret.cpp2_lines;
+        //  Restore what lowering the declarations changed, to do it again
+        auto restart = [&] {
+            printer.restart();
+            ret          = ret_start;
+            hpp_includes = hpp_includes_start;
+            errors.erase(errors.begin() + errors_count, errors.end());
+            for (auto& e : phase_errors) {
+                e.clear();
+            }
+            for (auto& requests : label_requests) {
+                requests.clear();
+            }
+            current_names.resize(names_count);
+            position_labels                = labels;
+            in_definite_init               = definite_init;
+            last_postfix_expr_was_pointer  = last_was_pointer;
+            emitting_that_function         = that_function;
+            emitting_move_that_function    = move_function;
+            already_moved_that_members     = moved_members;
+            lowering_failed                = false;
+            violates_bounds_safety         = bounds_violation;
+            violates_lifetime_safety       = lifetime_violation;
+            violates_initialization_safety = init_violation;
+            for (
+                auto i = 0;
+                auto const& c : tokens.get_comments()
+                )
+            {
+                c.dbg_was_printed = comments_printed[i++];
+            }
+            jobs.clear();
+            skeleton     = {};
+            names_popped = false;
+        };
 
-                    //  We should be in a position to emit a set of Cpp2 declarations
-                    if (
-                        map_iter != tokens.get_map().cend()
-                        && map_iter->first /*line*/ <= curr_lineno
-                        )
-                    {
-                        //  We should be here only when we're at exactly the first line of a Cpp2 section
-                        assert (map_iter->first == curr_lineno);
-                        assert (!map_iter->second.empty());
-
-                        //  Get the parse tree for this section and emit each forward declaration
-                        auto decls = parser.get_parse_tree_declarations_in_range(map_iter->second);
-                        for (auto& decl : decls) {
-                            assert(decl);
-                            emit(*decl);
+        for (;;)
+        {
+            printer.start_phase(printer.phase1_type_defs_func_decls, print_phase1_start);
+            printer.start_phase(printer.phase2_func_defs,            print_phase2_start);
+
+            //  Walk the source lines, emitting Cpp1 lines as they are, and
+            //  lowering the declarations in each Cpp2 section
+            curr_lineno = first_lineno;
+            auto section_iter = tokens.get_sections().cbegin();
+            for (auto const& line : source.get_non_module_lines())
+            {
+                //  Skip dummy line we added to make 0-vs-1-based offsets readable
+                if (curr_lineno != 0)
+                {
+                    //  If it's a Cpp1 line, emit it, unless lowering stops here
+                    if (line.cat != source_line::category::cpp2) {
+                        if (curr_lineno == disallowed_lineno) {
+                            printer.select_phase(printer.phase1_type_defs_func_decls);
+                            emit_cpp1_line(line);
+                            phase_errors[printer.phase1_type_defs_func_decls].push_back(errors.back());
+                            errors.pop_back();
+                        }
+                        else if (
+                            !disallowed_lineno
+                            || curr_lineno < *disallowed_lineno
+                            )
+                        {
+                            printer.select_phase(printer.phase1_type_defs_func_decls);
+                            emit_cpp1_line(line);
+                        }
+                    }
+
+                    //  If it's a Cpp2 line...
+                    else {
+                        ++ret.cpp2_lines;
+
+                        //  We should be in a position to lower a set of Cpp2 declarations
+                        if (
+                            section_iter != tokens.get_sections().cend()
+                            && section_iter->lineno <= curr_lineno
+                            )
+                        {
+                            //  We should be here only when we're at exactly the first line of a Cpp2 section
+                            assert (section_iter->lineno == curr_lineno);
+                            assert (!section_iter->tokens.empty());
+
+                            lower_section(
+                                section_iter - tokens.get_sections().cbegin(),
+                                !disallowed_lineno || curr_lineno < *disallowed_lineno
+                            );
+                            ++section_iter;
                         }
-                        ++map_iter;
                     }
                 }
+                ++curr_lineno;
             }
-            ++curr_lineno;
-        }
 
-        //  We can stop here if there's no Cpp2 code -- a file with no Cpp2
-        //  should have perfect passthrough verifiable with diff, including
-        //  that we didn't misidentify anything as Cpp2 (even in the
-        //  presence of nonstandard vendor extensions)
-        //
-        if (!source.has_cpp2()) {
-            assert(ret.cpp2_lines == 0);
-            return ret;
-        }
+            //  Any sections the walk didn't reach are still lowered, just
+            //  not for phase1_type_defs_func_decls
+            for (; section_iter != tokens.get_sections().cend(); ++section_iter) {
+                lower_section(section_iter - tokens.get_sections().cbegin(), false);
+            }
 
-        //  If there is Cpp2 code, we have more to do...
+            //  Check the labels are numbered in phase order
+            auto labels_in_phase_order = labels_start;
+            std::swap(position_labels, labels_in_phase_order);
+            for (auto const& requests : label_requests) {
+                for (auto t : requests) {
+                    labelized_position(t);
+                }
+            }
+            std::swap(position_labels, labels_in_phase_order);
+            if (labels_in_phase_order != position_labels) {
+                labels = std::move(labels_in_phase_order);
+                restart();
+                continue;
+            }
 
-        //  First, if this is a .h2 and in a -pure-cpp2 compilation,
-        //  we need to switch filenames
-        if (
-            cpp1_filename.back() == 'h'
-            && flag_cpp2_only
-            )
-        {
-            printer.print_extra( "\n#endif\n" );
+            //  Lower the deferred declarations, or else do it all serially
+            if (in_parallel)
+            {
+                printer.select_phase(printer.phase2_func_defs);
+                if (
+                    lowering_failed
+                    || !phase_errors[printer.phase2_func_defs].empty()
+                    || !skeleton.replayable
+                    || names_popped
+                    || !lower_deferred_jobs(jobs)
+                    )
+                {
+                    in_parallel = false;
+                    restart();
+                    continue;
+                }
+            }
 
-            printer.reopen();
-            if (!printer.is_open()) {
-                errors.emplace_back(
-                    source_position{},
-                    "could not open second output file " + cpp1_filename
+            for (auto& e : phase_errors) {
+                errors.insert(
+                    errors.end(),
+                    std::make_move_iterator(e.begin()),
+                    std::make_move_iterator(e.end())
                 );
+            }
+
+            printer.select_phase(printer.phase0_type_decls);
+            printer.finalize_phase();
+            if (!printer.continue_phase(printer.phase1_type_defs_func_decls, print_phase1_start)) {
+                restart();
+                continue;
+            }
+
+            if (disallowed_lineno) {
                 return {};
             }
 
-            printer.print_extra( "\n#ifndef " + cpp1_FILENAME+"_CPP2" );
-            printer.print_extra( "\n#error This file is part of a '.h2' header compiled to be consumed from another -pure-cpp2 file. To use this file, write '#include \"" + cpp1_filename + "2\"' in a '.h2' or '.cpp2' file compiled with -pure-cpp2."  );
-            printer.print_extra( "\n#endif\n" );
+            //  We can stop here if there's no Cpp2 code -- a file with no Cpp2
+            //  should have perfect passthrough verifiable with diff, including
+            //  that we didn't misidentify anything as Cpp2 (even in the
+            //  presence of nonstandard vendor extensions)
+            //
+            if (!source.has_cpp2()) {
+                assert(ret.cpp2_lines == 0);
+                if (!printer.close()) {
+                    errors.emplace_back(
+                        source_position{},
+                        "could not write output file " + cpp1_filename
+                    );
+                    return {};
+                }
+                return ret;
+            }
 
-            cpp1_FILENAME += "PP";
-            printer.print_extra( "\n#ifndef " + cpp1_FILENAME+"_CPP2" );
-            printer.print_extra( "\n#define " + cpp1_FILENAME+"_CPP2" + "\n\n" );
+            //  If there is Cpp2 code, we have more to do...
 
-            printer.print_extra( hpp_includes );
-        }
+            //  First, if this is a .h2 and in a -pure-cpp2 compilation,
+            //  we need to switch filenames
+            if (
+                cpp1_filename.back() == 'h'
+                && flag_cpp2_only
+                )
+            {
+                printer.print_extra( "\n#endif\n" );
 
+                printer.reopen();
 
-        //---------------------------------------------------------------------
-        //  Do phase2_func_defs
-        //
-        printer.finalize_phase();
-        printer.next_phase();
+                printer.print_extra( "\n#ifndef " + cpp1_FILENAME+"_CPP2" );
+                printer.print_extra( "\n#error This file is part of a '.h2' header compiled to be consumed from another -pure-cpp2 file. To use this file, write '#include \"" + cpp1_filename + "2\"' in a '.h2' or '.cpp2' file compiled with -pure-cpp2."  );
+                printer.print_extra( "\n#endif\n" );
 
-        if (
-            source.has_cpp2()
-            && !flag_clean_cpp1
-            )
-        {
-            printer.print_extra( "\n//=== Cpp2 function definitions =================================================\n\n" );
-            printer.reset_line_to(1, true);
+                auto const hpp_FILENAME = cpp1_FILENAME + "PP";
+                printer.print_extra( "\n#ifndef " + hpp_FILENAME+"_CPP2" );
+                printer.print_extra( "\n#define " + hpp_FILENAME+"_CPP2" + "\n\n" );
+
+                printer.print_extra( hpp_includes );
+            }
+
+            printer.finalize_phase();
+            if (!printer.continue_phase(printer.phase2_func_defs, print_phase2_start)) {
+                restart();
+                continue;
+            }
+            break;
         }
 
-        for (auto& section : tokens.get_map())
+        //  Now that its section starts in the right place, print what was
+        //  recorded for phase2_func_defs, with the deferred declarations
+        if (in_parallel)
         {
-            assert (!section.second.empty());
-
-            //  Get the parse tree for this section and emit each forward declaration
-            auto decls = parser.get_parse_tree_declarations_in_range(section.second);
-            for (auto& decl : decls) {
-                assert(decl);
-                emit(*decl);
+            auto outputs = std::vector<printer_recording>{};
+            for (auto& job : jobs) {
+                outputs.push_back(std::move(job.output));
+                violates_bounds_safety   = violates_bounds_safety   || job.violates_bounds_safety;
+                violates_lifetime_safety = violates_lifetime_safety || job.violates_lifetime_safety;
             }
+            printer.replay(skeleton, outputs);
         }
 
         if (cpp1_filename.back() == 'h') {
@@ -1691,6 +3699,7 @@ public:
         }
 
         printer.finalize_phase( true );
+        trace_end(trace);
 
 
         //---------------------------------------------------------------------
@@ -1706,10 +3715,22 @@ public:
         );
 
 
+        if (!printer.close()) {
+            errors.emplace_back(
+                source_position{},
+                "could not write output file " + printer.get_filename()
+            );
+            return {};
+        }
+
+
         //---------------------------------------------------------------------
         //  Emit any extra build steps
 
         if (!extra_build.empty()) {
+            //  Several files may be compiled in parallel, but they share this output
+            static auto build_mutex = std::mutex{};
+            auto lock  = std::lock_guard{build_mutex};
             auto build = std::ofstream("cpp2_post_build.sh", std::ios::binary);
             for (auto& e: extra_build) {
                 build << e << "\n";
@@ -1892,7 +3913,7 @@ public:
         assert( n.identifier );
         auto last_use = is_definite_last_use(n.identifier);
 
-        auto decl = sema.get_declaration_of(*n.identifier, false, true);
+        auto decl = compilation_sema().get_declaration_of(*n.identifier, false, true);
 
         bool add_forward =
             last_use
@@ -2051,7 +4072,7 @@ public:
         )
         -> void
     {   STACKINSTR
-        if (!sema.check(n)) {
+        if (!sema_check(n)) {
             return;
         }
 
@@ -2582,8 +4603,8 @@ public:
             }
             else if (
                 !is_parameter_name
-                && sema.get_declaration_of(*tok)
-                && !sema.is_captured(*tok)
+                && compilation_sema().get_declaration_of(*tok)
+                && !compilation_sema().is_captured(*tok)
                 )
             {
                 errors.emplace_back(
@@ -3099,40 +5120,99 @@ public:
         if (addr_cnt > deref_cnt) {
             return true;
         }
-        auto decl = sema.get_declaration_of(*t, true);
+        auto decl = compilation_sema().get_declaration_of(*t, true);
         return is_pointer_declaration(decl, deref_cnt, addr_cnt);
     }
 
 
-    auto source_order_name_lookup(std::string_view identifier)
+    auto source_order_name_lookup(token const& identifier)
         -> source_order_name_lookup_res
     {
-        for (
-            auto first = current_names.rbegin(), last = current_names.rend() - 1;
-            first != last;
-            ++first
-            )
+        return current_names.find(identifier);
+    }
+
+    //  The type-scope objects that are declared before a base type, by name
+    //
+    auto get_objects_before_base(declaration_node const& type)
+        -> object_names const&
+    {
+        assert (type.is_type());
+        auto [iter, inserted] = type_objects_before_base.try_emplace(&type);
+        auto& ret = iter->second;
+        if (!inserted) {
+            return ret;
+        }
+
+        //  An object name is before a base type if a base type ('this')
+        //  follows it, and then it names the last object with that name
+        //  before that base type
+        auto names_since_base = object_names{};
+        for (auto const* decl : type.get_nested_declarations())
         {
             if (
-                auto decl = get_if<declaration_node const*>(&*first);
-                decl
-                && *decl
-                && (*decl)->has_name(identifier)
+                decl->is_alias()
+                || !decl->has_name()
                 )
             {
-                return *decl;
+                continue;
             }
-            else if (
-                auto using_ = get_if<active_using_declaration>(&*first);
-                using_
-                && using_->identifier
-                && *using_->identifier == identifier
-                )
-            {
-                return *using_;
+            if (decl->has_name("this")) {
+                for (auto const& [name, object] : names_since_base) {
+                    ret.try_emplace(name, object);
+                }
+                names_since_base.clear();
+            }
+            else {
+                names_since_base[*decl->name()] = decl;
             }
         }
+        return ret;
+    }
+
+    //  Same as n.get_decl_if_type_scope_object_name_before_a_base_type(s)
+    //
+    auto type_scope_object_before_base(
+        declaration_node const& n,
+        std::string_view        s
+    )
+        -> declaration_node const*
+    {
+        if (s == "this") {
+            return {};
+        }
+
+        auto decl = &n;
+        while (
+            !decl->is_type()
+            && decl->parent_declaration
+            )
+        {
+            decl = decl->parent_declaration;
+        }
+        if (!decl->is_type()) {
+            return {};
+        }
 
+        auto const& objects = get_objects_before_base(*decl);
+        auto iter = objects.find(s);
+        return iter != objects.end() ? iter->second : nullptr;
+    }
+
+    //  Same as n.find_parent_declared_value_set_functions()
+    //
+    auto parent_declared_value_set_functions(declaration_node const& n)
+        -> declaration_node::declared_value_set_funcs
+    {
+        if (n.parent_is_type()) {
+            auto iter = type_value_set_functions.find(n.parent_declaration);
+            if (iter == type_value_set_functions.end()) {
+                iter = type_value_set_functions.emplace(
+                    n.parent_declaration,
+                    n.parent_declaration->find_declared_value_set_functions()
+                ).first;
+            }
+            return iter->second;
+        }
         return {};
     }
 
@@ -3227,7 +5307,7 @@ public:
     )
         -> void
     {   STACKINSTR
-        if (!sema.check(n)) {
+        if (!sema_check(n)) {
             return;
         }
 
@@ -3299,7 +5379,7 @@ public:
                 return;
             }
             current_args.back().ptoken = n.expr->get_token();
-            auto decl = sema.get_declaration_of(*current_args.back().ptoken);
+            auto decl = compilation_sema().get_declaration_of(*current_args.back().ptoken);
             if (!(decl && decl->parameter && decl->parameter->pass == passing_style::forward))
             {
                 errors.emplace_back(
@@ -3386,9 +5466,23 @@ public:
             //  First stringize ourselves so that we compare equal against
             //  the first *cap_grp .str_suppressed_move that matches us (which is what the
             //  lambda introducer generator used to create a lambda capture)
-            suppress_move_from_last_use = true;
-            auto my_sym = print_to_string(n, true);
-            suppress_move_from_last_use = false;
+            //
+            //  The lambda introducer generator already stringized us exactly
+            //  this way, so reuse that text instead of lowering us again
+            auto my_sym = std::string{};
+            if (
+                auto me = std::find(n.cap_grp->members.begin(), n.cap_grp->members.end(), &n);
+                me != n.cap_grp->members.end()
+                && !me->str_suppressed_move.empty()
+                )
+            {
+                my_sym = me->str_suppressed_move;
+            }
+            else {
+                suppress_move_from_last_use = true;
+                my_sym = print_to_string(n, true);
+                suppress_move_from_last_use = false;
+            }
 
             auto found = std::find_if(n.cap_grp->members.cbegin(), n.cap_grp->members.cend(), [my_sym](auto& cap) {
                 return cap.str_suppressed_move == my_sym;
@@ -3405,14 +5499,14 @@ public:
 
         //  Otherwise, we're going to have to potentially do some work to change
         //  some Cpp2 postfix operators to Cpp1 prefix operators, so let's set up...
-        auto prefix            = std::vector<text_with_pos>{};
-        auto suffix            = std::vector<text_with_pos>{};
+        auto prefix            = text_chunks{};
+        auto suffix            = text_chunks{};    // in reverse order
 
         auto last_was_prefixed = false;
         auto saw_dollar        = false;
 
         struct text_chunks_with_parens_position {
-            std::vector<text_with_pos> text_chunks;
+            text_chunks                chunks;
             source_position            open_pos;
             source_position            close_pos;
         };
@@ -3422,16 +5516,14 @@ public:
         auto flush_args = [&] {
             if (args) {
                 suffix.emplace_back(")", args.value().close_pos);
-                for (auto&& e: args.value().text_chunks) {
-                    suffix.push_back(e);
-                }
+                suffix.append_reversed(args.value().chunks);
                 suffix.emplace_back("(", args.value().open_pos);
                 args.reset();
             }
         };
 
         auto print_to_text_chunks = [&](auto& i, auto... more) {
-            auto text = std::vector<text_with_pos>{};
+            auto text = text_chunks{};
             printer.emit_to_text_chunks(&text);
             push_need_expression_list_parens(false);
             emit(i, more...);
@@ -3473,7 +5565,7 @@ public:
 
                 assert (i->expr_list);
                 if (!i->expr_list->expressions.empty()) {
-                    local_args.text_chunks = print_to_text_chunks(*i->expr_list);
+                    local_args.chunks = print_to_text_chunks(*i->expr_list);
                 }
 
                 flush_args();
@@ -3492,7 +5584,8 @@ public:
                 )
             {
                 //  The function name is the argument to the macro
-                auto funcname = print_to_string(*i->id_expr);
+                //  (lowered once below, after we know which form it takes)
+                auto funcname = std::string{};
 
                 //  First, build the UFCS macro name
 
@@ -3572,6 +5665,10 @@ public:
                     in_non_rvalue_context.pop_back();
                 }
 
+                if (funcname.empty()) {
+                    funcname = print_to_string(*i->id_expr);
+                }
+
                 //  Second, emit the UFCS argument list
 
                 //  If the computed function name is an explicit member access
@@ -3584,10 +5681,8 @@ public:
                     prefix.emplace_back(ufcs_string + "(" + funcname + ")(", args.value().open_pos );
                 }
                 suffix.emplace_back(")", args.value().close_pos );
-                if (!args.value().text_chunks.empty()) {
-                    for (auto&& e: args.value().text_chunks) {
-                        suffix.push_back(e);
-                    }
+                if (!args.value().chunks.empty()) {
+                    suffix.append_reversed(args.value().chunks);
                     suffix.emplace_back(", ", i->op->position());
                 }
                 args.reset();
@@ -3678,9 +5773,7 @@ public:
                         //  If args are stored it means that this is function or method
                         //  that is not handled by UFCS and args need to be printed
                         suffix.emplace_back(")", args.value().close_pos);
-                        for (auto&& e: args.value().text_chunks) {
-                            suffix.push_back(e);
-                        }
+                        suffix.append_reversed(args.value().chunks);
                         suffix.emplace_back("(", args.value().open_pos);
                         args.reset();
                     }
@@ -3694,10 +5787,7 @@ public:
                 }
 
                 if (i->expr_list) {
-                    auto text = print_to_text_chunks(*i->expr_list);
-                    for (auto&& e: text) {
-                        suffix.push_back(e);
-                    }
+                    suffix.append_reversed(print_to_text_chunks(*i->expr_list));
                 }
 
                 if (i->last_expr)
@@ -3746,8 +5836,8 @@ public:
         }
 
         //  Print the prefixes (in forward order)
-        for (auto& e : prefix) {
-            printer.print_cpp2(e.text, n.position());
+        for (auto i = std::size_t{0}; i < prefix.size(); ++i) {
+            printer.print_cpp2(prefix[i].text, n.position());
         }
 
         //  If this is an --, ++, or &, don't add cpp2::move on the lhs
@@ -4464,16 +6554,16 @@ public:
         return finally([&]{ cont.pop_back(); });
     }
 
-    template<typename T>
-    auto stack_size(std::vector<T>& cont)
+    template<typename Stack>
+    auto stack_size(Stack& cont)
         -> auto
     {
         return finally([&, size = cont.size()]{ cont.resize(size); });
     }
 
-    template<typename T>
+    template<typename Stack>
     auto stack_size_if(
-        std::vector<T>& cont,
+        Stack& cont,
         bool cond
     )
         -> std::optional<decltype(stack_size(cont))>
@@ -4496,7 +6586,7 @@ public:
     )
         -> void
     {   STACKINSTR
-        if (!sema.check(n)) {
+        if (!sema_check(n)) {
             return;
         }
 
@@ -4575,7 +6665,7 @@ public:
     )
         -> void
     {   STACKINSTR
-        if (!sema.check(n)) {
+        if (!sema_check(n)) {
             return;
         }
 
@@ -5124,7 +7214,7 @@ public:
     )
         -> void
     {   STACKINSTR
-        if (!sema.check(n)) {
+        if (!sema_check(n)) {
             return;
         }
 
@@ -5519,7 +7609,7 @@ public:
                 auto object_name = canonize_object_name(*object);
 
                 auto is_object_before_base =
-                    n.get_decl_if_type_scope_object_name_before_a_base_type(*(*object)->name());
+                    type_scope_object_before_base(n, *(*object)->name());
 
                 auto found_explicit_init = false;
                 auto found_default_init  = false;
@@ -5887,9 +7977,59 @@ public:
         };
 
 
+        //  A namespace-scope declaration is lowered from the same state
+        //  whether or not it's lowered by itself (see lower_deferred_jobs)
+        if (
+            !n.is_namespace()
+            && n.parent_is_namespace()
+            )
+        {
+            if (!is_at_namespace_scope_baseline()) {
+                if (deferred_jobs) {
+                    lowering_failed = true;
+                    return;
+                }
+            }
+            else {
+                //  Don't see what lowering the previous declaration left behind
+                in_definite_init              = false;
+                last_postfix_expr_was_pointer = false;
+                emitting_that_function        = false;
+                emitting_move_that_function   = false;
+                already_moved_that_members    = {};
+
+                if (deferred_jobs) {
+                    printer.record_splice( unchecked_narrow<int>(std::ssize(*deferred_jobs)) );
+                    deferred_jobs->push_back({ &n, having_signature_emitted, current_declarations, current_names.size() });
+                    current_names.push_back(&n);
+                    return;
+                }
+            }
+        }
+
+        //  A deferred function body is parsed just before it's lowered,
+        //  and freed after (this can be reentered to lower it again, e.g.,
+        //  to generate a postfix operator from a prefix one)
+        auto const parse_body =
+            n.has_unparsed_body()
+            && printer.get_phase() == printer.phase2_func_defs;
+        if (
+            parse_body
+            && !parse_deferred_body(n)
+            )
+        {
+            return;
+        }
+        auto release_body = finally([&]{
+            if (parse_body) {
+                sema.end_deferred_function();
+                parser.release_deferred_body(n);
+            }
+        });
+
         //  Declarations are handled in multiple passes,
         //  but we only want to emit the error messages once (in phase 2)
-        if (!sema.check(n, printer.get_phase() == printer.phase2_func_defs))
+        if (!sema_check(n, printer.get_phase() == printer.phase2_func_defs))
         {
             return;
         }
@@ -6195,7 +8335,7 @@ public:
                     assert(decl->name());
 
                     auto emit_as_base =
-                        decl->get_decl_if_type_scope_object_name_before_a_base_type(*decl->name());
+                        type_scope_object_before_base(*decl, *decl->name());
 
                     if (emit_as_base) {
                         printer.print_extra(
@@ -6415,14 +8555,14 @@ public:
                 //  and any data members declared before them that we push into private bases
                 assert(decl->name());
                 auto emit_as_base =
-                    decl->get_decl_if_type_scope_object_name_before_a_base_type(*decl->name())
+                    type_scope_object_before_base(*decl, *decl->name())
                     || decl->has_name("this")
                     ;
                 if (emit_as_base)
                 {
                     //  Do the sema check for these declarations here, because we're
                     //  handling them here instead of going through emit() for them
-                    if (!sema.check(*decl)) {
+                    if (!sema_check(*decl)) {
                         return;
                     }
 
@@ -6594,7 +8734,7 @@ public:
             current_functions.push(
                 &n,
                 func.get(),
-                n.find_parent_declared_value_set_functions()
+                parent_declared_value_set_functions(n)
                 );
             auto guard0 = finally([&]{ current_functions.pop(); });
 
@@ -7258,10 +9398,23 @@ public:
     }
 
 
+    //-----------------------------------------------------------------------
+    //  discard_output: Delete the output file, as print_errors does
+    //  when there are errors
+    //
+    auto discard_output()
+        -> void
+    {
+        printer.abandon();
+    }
+
+
     //-----------------------------------------------------------------------
     //  print_errors
     //
-    auto print_errors()
+    //  o   the stream to print to
+    //
+    auto print_errors(std::ostream& o = std::cerr)
         -> void
     {
         if (!errors.empty()) {
@@ -7290,19 +9443,19 @@ public:
                 || error != *prev
                 )
             {
-                error.print(std::cerr, strip_path(sourcefile));
+                error.print(o, strip_path(sourcefile));
             }
             prev = &error;
         }
 
         if (violates_lifetime_safety) {
-            std::cerr << "  ==> program violates lifetime safety guarantee - see previous errors\n";
+            o << "  ==> program violates lifetime safety guarantee - see previous errors\n";
         }
         if (violates_bounds_safety) {
-            std::cerr << "  ==> program violates bounds safety guarantee - see previous errors\n";
+            o << "  ==> program violates bounds safety guarantee - see previous errors\n";
         }
         if (violates_initialization_safety) {
-            std::cerr << "  ==> program violates initialization safety guarantee - see previous errors\n";
+            o << "  ==> program violates initialization safety guarantee - see previous errors\n";
         }
     }
 
@@ -7356,6 +9509,26 @@ public:
     {
         return source.has_cpp2();
     }
+
+
+    //-----------------------------------------------------------------------
+    //  get_written_files: pass through
+    //
+    auto get_written_files() const
+        -> std::vector<std::pair<std::string, std::string>> const&
+    {
+        return printer.get_written_files();
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  has_extra_build: whether this compilation wrote cpp2_post_build.sh
+    //
+    auto has_extra_build() const
+        -> bool
+    {
+        return !extra_build.empty();
+    }
 };
 
 }